@@ -10,6 +10,7 @@
 #include "drake/geometry/render/render_label.h"
 #include "drake/geometry/render_gl/factory.h"
 #include "drake/geometry/render_gltf_client/factory.h"
+#include "drake/geometry/render_raycast/factory.h"
 #include "drake/geometry/render_vtk/factory.h"
 
 namespace drake {
@@ -377,6 +378,21 @@ void DoScalarIndependentDefinitions(py::module m) {
       py::arg("params") = RenderEngineGltfClientParams(),
       doc_geometry.MakeRenderEngineGltfClient.doc);
 
+  {
+    using Class = RenderEngineRaycastParams;
+    constexpr auto& cls_doc = doc_geometry.RenderEngineRaycastParams;
+    py::class_<Class> cls(m, "RenderEngineRaycastParams", cls_doc.doc);
+    cls  // BR
+        .def(ParamInit<Class>());
+    DefAttributesUsingSerialize(&cls, cls_doc);
+    DefReprUsingSerialize(&cls);
+    DefCopyAndDeepCopy(&cls);
+  }
+
+  m.def("MakeRenderEngineRaycast", &MakeRenderEngineRaycast,
+      py::arg("params") = RenderEngineRaycastParams(),
+      doc_geometry.MakeRenderEngineRaycast.doc);
+
   AddValueInstantiation<RenderLabel>(m);
 }
 }  // namespace
@@ -451,7 +451,29 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return img;
             },
             py::arg("camera"), py::arg("parent_frame"), py::arg("X_PC"),
-            cls_doc.RenderLabelImage.doc);
+            cls_doc.RenderLabelImage.doc)
+        .def(
+            "RenderImages",
+            [](const Class* self, const render::ColorRenderCamera& color_camera,
+                const render::DepthRenderCamera& depth_camera,
+                FrameId parent_frame, const math::RigidTransformd& X_PC) {
+              const systems::sensors::CameraInfo& color_intrinsics =
+                  color_camera.core().intrinsics();
+              const systems::sensors::CameraInfo& depth_intrinsics =
+                  depth_camera.core().intrinsics();
+              systems::sensors::ImageRgba8U color(
+                  color_intrinsics.width(), color_intrinsics.height());
+              systems::sensors::ImageDepth32F depth(
+                  depth_intrinsics.width(), depth_intrinsics.height());
+              systems::sensors::ImageLabel16I label(
+                  color_intrinsics.width(), color_intrinsics.height());
+              self->RenderImages(color_camera, depth_camera, parent_frame,
+                  X_PC, &color, &depth, &label);
+              return std::make_tuple(
+                  std::move(color), std::move(depth), std::move(label));
+            },
+            py::arg("color_camera"), py::arg("depth_camera"),
+            py::arg("parent_frame"), py::arg("X_PC"), cls_doc.RenderImages.doc);
 
     if constexpr (scalar_predicate<T>::is_bool) {
       cls  // BR
@@ -91,6 +91,8 @@ void DoScalarDependentDefinitions(py::module m, T) {
             cls_doc.set_point_size.doc)
         .def("set_default_rgba", &Class::set_default_rgba,
             cls_doc.set_default_rgba.doc)
+        .def("set_encoding", &Class::set_encoding, py::arg("encoding"),
+            cls_doc.set_encoding.doc)
         .def("Delete", &Class::Delete, cls_doc.Delete.doc)
         .def("cloud_input_port", &Class::cloud_input_port,
             py_rvp::reference_internal, cls_doc.cloud_input_port.doc)
@@ -220,6 +222,13 @@ void DoScalarIndependentDefinitions(py::module m) {
                 double, const Rgba&>(&Class::SetObject),
             py::arg("path"), py::arg("cloud"), py::arg("point_size") = 0.001,
             py::arg("rgba") = Rgba(.9, .9, .9, 1.), cls_doc.SetObject.doc_cloud)
+        .def("SetObject",
+            py::overload_cast<std::string_view, const perception::PointCloud&,
+                double, const Rgba&, const Meshcat::PointCloudEncoding&>(
+                &Class::SetObject),
+            py::arg("path"), py::arg("cloud"), py::arg("point_size"),
+            py::arg("rgba"), py::arg("encoding"),
+            cls_doc.SetObject.doc_cloud_encoding)
         .def("SetObject",
             py::overload_cast<std::string_view,
                 const TriangleSurfaceMesh<double>&, const Rgba&, bool, double,
@@ -280,6 +289,10 @@ void DoScalarIndependentDefinitions(py::module m) {
             py::overload_cast<std::string_view,
                 const Eigen::Ref<const Eigen::Matrix4d>&>(&Class::SetTransform),
             py::arg("path"), py::arg("matrix"), cls_doc.SetTransform.doc_matrix)
+        .def("SetTransforms", &Class::SetTransforms, py::arg("paths"),
+            py::arg("X_ParentPaths"),
+            py::arg("time_in_recording") = std::nullopt,
+            py::arg("tolerance") = 0.0, cls_doc.SetTransforms.doc)
         .def("Delete", &Class::Delete, py::arg("path") = "", cls_doc.Delete.doc)
         .def("SetRealtimeRate", &Class::SetRealtimeRate, py::arg("rate"),
             cls_doc.SetRealtimeRate.doc)
@@ -383,6 +396,15 @@ void DoScalarIndependentDefinitions(py::module m) {
     DefReprUsingSerialize(&orthographic_camera_cls);
     DefCopyAndDeepCopy(&orthographic_camera_cls);
 
+    const auto& encoding_doc = doc.Meshcat.PointCloudEncoding;
+    py::class_<Meshcat::PointCloudEncoding> encoding_cls(
+        meshcat, "PointCloudEncoding", encoding_doc.doc);
+    encoding_cls  // BR
+        .def(ParamInit<Meshcat::PointCloudEncoding>());
+    DefAttributesUsingSerialize(&encoding_cls, encoding_doc);
+    DefReprUsingSerialize(&encoding_cls);
+    DefCopyAndDeepCopy(&encoding_cls);
+
     const auto& gamepad_doc = doc.Meshcat.Gamepad;
     py::class_<Meshcat::Gamepad> gamepad_cls(
         meshcat, "Gamepad", gamepad_doc.doc);
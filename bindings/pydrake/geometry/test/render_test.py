@@ -244,6 +244,30 @@ class TestGeometryRender(unittest.TestCase):
 
         # TODO(eric, duy): Test more properties.
 
+    def test_render_engine_raycast_params(self):
+        # A default constructor exists.
+        mut.RenderEngineRaycastParams()
+
+        # The kwarg constructor also works.
+        label = mut.RenderLabel(10)
+        params = mut.RenderEngineRaycastParams(
+            default_label=label,
+            num_threads=2,
+        )
+        self.assertEqual(params.default_label, label)
+        self.assertEqual(params.num_threads, 2)
+
+        self.assertIn("num_threads", repr(params))
+        copy.copy(params)
+
+    def test_render_engine_raycast_api(self):
+        scene_graph = mut.SceneGraph()
+        params = mut.RenderEngineRaycastParams(num_threads=2)
+        scene_graph.AddRenderer("raycast_renderer",
+                                mut.MakeRenderEngineRaycast(params=params))
+        self.assertTrue(scene_graph.HasRenderer("raycast_renderer"))
+        self.assertEqual(scene_graph.RendererCount(), 1)
+
     def test_render_engine_gltf_client_api(self):
         scene_graph = mut.SceneGraph()
         params = mut.RenderEngineGltfClientParams()
@@ -567,6 +567,12 @@ class TestGeometrySceneGraph(unittest.TestCase):
             camera=color_camera, parent_frame=SceneGraph.world_frame_id(),
             X_PC=RigidTransform())
         self.assertIsInstance(image, ImageLabel16I)
+        color, depth, label = query_object.RenderImages(
+            color_camera=color_camera, depth_camera=depth_camera,
+            parent_frame=SceneGraph.world_frame_id(), X_PC=RigidTransform())
+        self.assertIsInstance(color, ImageRgba8U)
+        self.assertIsInstance(depth, ImageDepth32F)
+        self.assertIsInstance(label, ImageLabel16I)
 
     @numpy_compare.check_all_types
     def test_value_instantiations(self, T):
@@ -106,11 +106,20 @@ class TestGeometryVisualizers(unittest.TestCase):
                              X_ParentPath=RigidTransform(),
                              time_in_recording=0.2)
         meshcat.SetTransform(path="/test/box", matrix=np.eye(4))
+        meshcat.SetTransforms(paths=["/test/box", "/test/frame"],
+                              X_ParentPaths=[RigidTransform()] * 2,
+                              time_in_recording=0.2, tolerance=1e-6)
         self.assertTrue(meshcat.HasPath("/test/box"))
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
         meshcat.SetObject(path="/test/cloud", cloud=cloud,
                           point_size=0.01, rgba=mut.Rgba(.5, .5, .5))
+        encoding = mut.Meshcat.PointCloudEncoding(
+            quantize=True, max_points=2, max_backlog_bytes=1 << 20)
+        self.assertIn("max_points", repr(encoding))
+        meshcat.SetObject(path="/test/cloud", cloud=cloud,
+                          point_size=0.01, rgba=mut.Rgba(.5, .5, .5),
+                          encoding=encoding)
         mesh = mut.TriangleSurfaceMesh(
             triangles=[mut.SurfaceTriangle(
                 0, 1, 2), mut.SurfaceTriangle(3, 0, 2)],
@@ -283,6 +292,7 @@ class TestGeometryVisualizers(unittest.TestCase):
         params.prefix = "py_visualizer"
         params.delete_on_initialization_event = False
         params.visible_by_default = True
+        params.transform_tolerance = 1e-6
         self.assertIn("publish_period", repr(params))
         copy.copy(params)
         vis = mut.MeshcatVisualizer_[T](meshcat=meshcat, params=params)
@@ -322,6 +332,8 @@ class TestGeometryVisualizers(unittest.TestCase):
             meshcat=meshcat, path="cloud", publish_period=1/12.0)
         visualizer.set_point_size(0.1)
         visualizer.set_default_rgba(mut.Rgba(0, 0, 1, 1))
+        visualizer.set_encoding(
+            encoding=mut.Meshcat.PointCloudEncoding(max_points=2))
         context = visualizer.CreateDefaultContext()
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
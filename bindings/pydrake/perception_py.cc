@@ -4,6 +4,7 @@
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/perception/depth_image_to_point_cloud.h"
 #include "drake/perception/point_cloud.h"
+#include "drake/perception/point_cloud_index.h"
 #include "drake/perception/point_cloud_to_lcm.h"
 
 namespace drake {
@@ -59,6 +60,32 @@ void init_perception(py::module m) {
   py::module::import("pydrake.systems.framework");
   py::module::import("pydrake.systems.sensors");
 
+  {
+    using Class = PointCloudIndex;
+    constexpr auto& cls_doc = doc.PointCloudIndex;
+    py::class_<Class> cls(m, "PointCloudIndex", cls_doc.doc);
+    cls.def(py::init<const Eigen::Ref<const Matrix3X<float>>&, bool>(),
+           py::arg("xyzs"), py::arg("parallelize") = false, cls_doc.ctor.doc)
+        .def("size", &Class::size, cls_doc.size.doc)
+        .def(
+            "FindNearest",
+            [](const Class& self,
+                const Eigen::Ref<const Matrix3X<float>>& queries,
+                int num_closest, double radius, bool parallelize) {
+              Eigen::MatrixXi indices;
+              Eigen::MatrixXf squared_distances;
+              self.FindNearest(queries, num_closest, radius, &indices,
+                  &squared_distances, parallelize);
+              return std::make_pair(indices, squared_distances);
+            },
+            py::arg("queries"), py::arg("num_closest"), py::arg("radius"),
+            py::arg("parallelize") = false, cls_doc.FindNearest.doc)
+        .def("FindWithinRadius", &Class::FindWithinRadius, py::arg("queries"),
+            py::arg("radius"), py::arg("parallelize") = false,
+            cls_doc.FindWithinRadius.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   {
     using Class = PointCloud;
     constexpr auto& cls_doc = doc.PointCloud;
@@ -124,9 +151,15 @@ void init_perception(py::module m) {
         .def("VoxelizedDownSample", &Class::VoxelizedDownSample,
             py::arg("voxel_size"), py::arg("parallelize") = false,
             cls_doc.VoxelizedDownSample.doc)
-        .def("EstimateNormals", &Class::EstimateNormals, py::arg("radius"),
-            py::arg("num_closest"), py::arg("parallelize") = false,
-            cls_doc.EstimateNormals.doc);
+        .def("EstimateNormals",
+            py::overload_cast<double, int, bool>(&Class::EstimateNormals),
+            py::arg("radius"), py::arg("num_closest"),
+            py::arg("parallelize") = false, cls_doc.EstimateNormals.doc_3args)
+        .def("EstimateNormals",
+            py::overload_cast<const PointCloudIndex&, double, int, bool>(
+                &Class::EstimateNormals),
+            py::arg("index"), py::arg("radius"), py::arg("num_closest"),
+            py::arg("parallelize") = false, cls_doc.EstimateNormals.doc_4args);
   }
 
   AddValueInstantiation<PointCloud>(m);
@@ -139,11 +172,11 @@ void init_perception(py::module m) {
     py::class_<Class, LeafSystem<double>>(
         m, "DepthImageToPointCloud", cls_doc.doc)
         .def(py::init<const CameraInfo&, PixelType, float,
-                 pc_flags::BaseFieldT>(),
+                 pc_flags::BaseFieldT, bool>(),
             py::arg("camera_info"),
             py::arg("pixel_type") = PixelType::kDepth32F,
             py::arg("scale") = 1.0, py::arg("fields") = pc_flags::kXYZs,
-            cls_doc.ctor.doc)
+            py::arg("parallelize") = false, cls_doc.ctor.doc)
         .def("depth_image_input_port", &Class::depth_image_input_port,
             py_rvp::reference_internal, cls_doc.depth_image_input_port.doc)
         .def("color_image_input_port", &Class::color_image_input_port,
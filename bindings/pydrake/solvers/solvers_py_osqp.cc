@@ -15,7 +15,11 @@ void DefineSolversOsqp(py::module m) {
 
   py::class_<OsqpSolver, SolverInterface>(m, "OsqpSolver", doc.OsqpSolver.doc)
       .def(py::init<>(), doc.OsqpSolver.ctor.doc)
-      .def_static("id", &OsqpSolver::id, doc.OsqpSolver.id.doc);
+      .def_static("id", &OsqpSolver::id, doc.OsqpSolver.id.doc)
+      .def("set_reuse_workspace", &OsqpSolver::set_reuse_workspace,
+          py::arg("reuse_workspace"), doc.OsqpSolver.set_reuse_workspace.doc)
+      .def("reuse_workspace", &OsqpSolver::reuse_workspace,
+          doc.OsqpSolver.reuse_workspace.doc);
 
   py::class_<OsqpSolverDetails>(
       m, "OsqpSolverDetails", doc.OsqpSolverDetails.doc)
@@ -35,7 +39,12 @@ void DefineSolversOsqp(py::module m) {
           doc.OsqpSolverDetails.polish_time.doc)
       .def_readonly("run_time", &OsqpSolverDetails::run_time,
           doc.OsqpSolverDetails.run_time.doc)
-      .def_readonly("y", &OsqpSolverDetails::y, doc.OsqpSolverDetails.y.doc);
+      .def_readonly("y", &OsqpSolverDetails::y, doc.OsqpSolverDetails.y.doc)
+      .def_readonly("workspace_reused", &OsqpSolverDetails::workspace_reused,
+          doc.OsqpSolverDetails.workspace_reused.doc)
+      .def_readonly("program_parse_reused",
+          &OsqpSolverDetails::program_parse_reused,
+          doc.OsqpSolverDetails.program_parse_reused.doc);
   AddValueInstantiation<OsqpSolverDetails>(m);
 }
 
@@ -51,6 +51,10 @@ class TestMixedIntegerBranchAndBound(unittest.TestCase):
         options.max_explored_nodes = 1
         self.assertEqual(options.max_explored_nodes, 1)
         self.assertIn("max_explored_nodes=", repr(options))
+        self.assertEqual(options.num_threads, 1)
+        options.num_threads = 2
+        self.assertEqual(options.num_threads, 2)
+        options.num_threads = 1
         copy.copy(options)
 
         dut2 = MixedIntegerBranchAndBound(
@@ -30,6 +30,25 @@ class TestOsqpSolver(unittest.TestCase):
             result.get_solver_details().y, np.array([-1., -1.]))
         np.testing.assert_allclose(result.GetDualSolution(constraint1), [1.])
         np.testing.assert_allclose(result.GetDualSolution(constraint2), [1.])
+        self.assertFalse(result.get_solver_details().workspace_reused)
+
+    def test_reuse_workspace(self):
+        prog = MathematicalProgram()
+        x = prog.NewContinuousVariables(2, "x")
+        constraint = prog.AddLinearConstraint(x[0] >= 1)
+        prog.AddQuadraticCost(np.eye(2), np.zeros(2), x)
+        solver = OsqpSolver()
+        self.assertFalse(solver.reuse_workspace())
+        solver.set_reuse_workspace(reuse_workspace=True)
+        self.assertTrue(solver.reuse_workspace())
+        result = solver.Solve(prog, None, None)
+        self.assertFalse(result.get_solver_details().workspace_reused)
+        self.assertFalse(result.get_solver_details().program_parse_reused)
+        constraint.evaluator().UpdateLowerBound([2.])
+        result = solver.Solve(prog, None, None)
+        self.assertTrue(result.get_solver_details().workspace_reused)
+        self.assertTrue(result.get_solver_details().program_parse_reused)
+        self.assertAlmostEqual(result.GetSolution(x[0]), 2., delta=1e-6)
 
     def unavailable(self):
         """Per the BUILD file, this test is only run when OSQP is disabled."""
@@ -271,6 +271,24 @@ PYBIND11_MODULE(controllers, m) {
       py::arg("A"), py::arg("B"), py::arg("Q"), py::arg("R"),
       doc.DiscreteTimeLinearQuadraticRegulator.doc);
 
+  m.def(
+      "DiscreteTimeFiniteHorizonLinearQuadraticRegulator",
+      [](const Eigen::Ref<const Eigen::MatrixXd>& A,
+          const Eigen::Ref<const Eigen::MatrixXd>& B,
+          const Eigen::Ref<const Eigen::MatrixXd>& Q,
+          const Eigen::Ref<const Eigen::MatrixXd>& R,
+          const Eigen::Ref<const Eigen::MatrixXd>& Qf, int num_steps) {
+        std::vector<std::pair<Eigen::MatrixXd, Eigen::MatrixXd>> result;
+        for (auto& step : DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+                 A, B, Q, R, Qf, num_steps)) {
+          result.emplace_back(std::move(step.K), std::move(step.S));
+        }
+        return result;
+      },
+      py::arg("A"), py::arg("B"), py::arg("Q"), py::arg("R"), py::arg("Qf"),
+      py::arg("num_steps"),
+      doc.DiscreteTimeFiniteHorizonLinearQuadraticRegulator.doc);
+
   m.def("LinearQuadraticRegulator",
       py::overload_cast<const systems::LinearSystem<double>&,
           const Eigen::Ref<const Eigen::MatrixXd>&,
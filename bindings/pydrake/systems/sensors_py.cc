@@ -223,7 +223,12 @@ PYBIND11_MODULE(sensors, m) {
       .def("X_BC", &RgbdSensor::X_BC, doc.RgbdSensor.X_BC.doc)
       .def("X_BD", &RgbdSensor::X_BD, doc.RgbdSensor.X_BD.doc)
       .def("parent_frame_id", &RgbdSensor::parent_frame_id,
-          py_rvp::reference_internal, doc.RgbdSensor.parent_frame_id.doc);
+          py_rvp::reference_internal, doc.RgbdSensor.parent_frame_id.doc)
+      .def("set_batch_image_renders", &RgbdSensor::set_batch_image_renders,
+          py::arg("batch_image_renders"),
+          doc.RgbdSensor.set_batch_image_renders.doc)
+      .def("batch_image_renders", &RgbdSensor::batch_image_renders,
+          doc.RgbdSensor.batch_image_renders.doc);
   def_camera_ports(&rgbd_sensor, doc.RgbdSensor);
 
   py::class_<RgbdSensorDiscrete, Diagram<T>> rgbd_camera_discrete(
@@ -404,7 +409,10 @@ PYBIND11_MODULE(sensors, m) {
             py_rvp::reference_internal, cls_doc.label_image_input_port.doc)
         .def("image_array_t_msg_output_port",
             &Class::image_array_t_msg_output_port, py_rvp::reference_internal,
-            cls_doc.image_array_t_msg_output_port.doc);
+            cls_doc.image_array_t_msg_output_port.doc)
+        .def("UseSharedMemory", &Class::UseSharedMemory,
+            py::arg("segment_name"), py::arg("capacity"),
+            cls_doc.UseSharedMemory.doc);
     // Because the public interface requires templates and it's hard to
     // reproduce the logic publicly (e.g. no overload that just takes
     // `AbstractValue` and the pixel type), go ahead and bind the templated
@@ -420,12 +428,57 @@ PYBIND11_MODULE(sensors, m) {
     type_visit(def_image_input_port, PixelTypeList{});
   }
 
+  {
+    using Class = ImageWriterParams;
+    constexpr auto& cls_doc = doc.ImageWriterParams;
+    py::class_<Class> cls(m, "ImageWriterParams", cls_doc.doc);
+    cls  // BR
+        .def(ParamInit<Class>());
+    DefAttributesUsingSerialize(&cls, cls_doc);
+    DefReprUsingSerialize(&cls);
+    DefCopyAndDeepCopy(&cls);
+  }
+
+  {
+    using Class = ImageWriterStatistics;
+    constexpr auto& cls_doc = doc.ImageWriterStatistics;
+    py::class_<Class> cls(m, "ImageWriterStatistics", cls_doc.doc);
+    cls  // BR
+        .def(py::init<>())
+        .def_readwrite("num_submitted", &Class::num_submitted,
+            cls_doc.num_submitted.doc)
+        .def_readwrite(
+            "num_written", &Class::num_written, cls_doc.num_written.doc)
+        .def_readwrite(
+            "num_failed", &Class::num_failed, cls_doc.num_failed.doc)
+        .def_readwrite(
+            "num_dropped", &Class::num_dropped, cls_doc.num_dropped.doc)
+        .def_readwrite(
+            "queue_size", &Class::queue_size, cls_doc.queue_size.doc)
+        .def_readwrite("peak_queue_size", &Class::peak_queue_size,
+            cls_doc.peak_queue_size.doc)
+        .def_readwrite("total_write_time", &Class::total_write_time,
+            cls_doc.total_write_time.doc)
+        .def_readwrite("max_write_time", &Class::max_write_time,
+            cls_doc.max_write_time.doc)
+        .def_readwrite("total_blocked_time", &Class::total_blocked_time,
+            cls_doc.total_blocked_time.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   {
     using Class = ImageWriter;
     constexpr auto& cls_doc = doc.ImageWriter;
     py::class_<Class, LeafSystem<double>> cls(m, "ImageWriter", cls_doc.doc);
     cls  // BR
-        .def(py::init<>(), cls_doc.ctor.doc)
+        .def(py::init<>(), cls_doc.ctor.doc_0args)
+        .def(py::init<const ImageWriterParams&>(), py::arg("params"),
+            cls_doc.ctor.doc_1args)
+        .def("params", &Class::params, py_rvp::reference_internal,
+            cls_doc.params.doc)
+        .def("Flush", &Class::Flush, cls_doc.Flush.doc)
+        .def("GetStatistics", &Class::GetStatistics,
+            cls_doc.GetStatistics.doc)
         .def(
             "DeclareImageInputPort",
             [](Class& self, PixelType pixel_type, std::string port_name,
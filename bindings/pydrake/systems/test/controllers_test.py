@@ -10,6 +10,7 @@ from pydrake.multibody.plant import MultibodyPlant
 from pydrake.multibody.parsing import Parser
 from pydrake.systems.analysis import Simulator
 from pydrake.systems.controllers import (
+    DiscreteTimeFiniteHorizonLinearQuadraticRegulator,
     DiscreteTimeLinearQuadraticRegulator,
     DynamicProgrammingOptions,
     FiniteHorizonLinearQuadraticRegulator,
@@ -372,6 +373,13 @@ class TestControllers(unittest.TestCase):
         self.assertEqual(K.shape, (1, 2))
         self.assertEqual(S.shape, (2, 2))
 
+        result = DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+            A=A, B=B, Q=Q, R=R, Qf=S, num_steps=3)
+        self.assertEqual(len(result), 3)
+        (K0, S0) = result[0]
+        np.testing.assert_allclose(K0, K, atol=1e-8)
+        np.testing.assert_allclose(S0, S, atol=1e-8)
+
     def test_finite_horizon_linear_quadratic_regulator(self):
         A = np.array([[0, 1], [0, 0]])
         B = np.array([[0], [1]])
@@ -2,6 +2,7 @@ import pydrake.systems.sensors as mut
 
 import copy
 import gc
+import os
 import unittest
 
 import numpy as np
@@ -341,6 +342,28 @@ class TestSensors(unittest.TestCase):
                 }[pixel_type]
                 self.assertEqual(image.pixel_format, expected_format)
 
+    def test_image_to_lcm_image_array_shared_memory(self):
+        dut = mut.ImageToLcmImageArrayT(
+            color_frame_name="color", depth_frame_name="depth",
+            label_frame_name="label")
+        dut.UseSharedMemory(
+            segment_name=f"/drake_sensors_test_{os.getpid()}", capacity=4096)
+        context = dut.CreateDefaultContext()
+        dut.color_image_input_port().FixValue(
+            context, mut.ImageRgba8U(width=2, height=2))
+        dut.depth_image_input_port().FixValue(
+            context, mut.ImageDepth32F(width=2, height=2))
+        dut.label_image_input_port().FixValue(
+            context, mut.ImageLabel16I(width=2, height=2))
+        output = dut.AllocateOutput()
+        dut.CalcOutput(context, output)
+        serializer = _Serializer_[lcmt_image_array]()
+        message = lcmt_image_array.decode(
+            serializer.Serialize(output.get_data(0)))
+        for image in message.images:
+            self.assertEqual(image.compression_method,
+                             lcmt_image.COMPRESSION_METHOD_SHARED_MEMORY)
+
     def test_lcm_image_array_to_images_basic(self):
         """Tests all API calls as well as runtime functionality."""
         dut = mut.LcmImageArrayToImages()
@@ -446,6 +469,9 @@ class TestSensors(unittest.TestCase):
             self.assertIsInstance(sensor.X_BD(),
                                   RigidTransform)
             self.assertEqual(sensor.parent_frame_id(), parent_id)
+            self.assertFalse(sensor.batch_image_renders())
+            sensor.set_batch_image_renders(batch_image_renders=True)
+            self.assertTrue(sensor.batch_image_renders())
             check_ports(sensor)
 
         # Test discrete camera. We'll simply use the last sensor constructed.
@@ -506,3 +532,34 @@ class TestSensors(unittest.TestCase):
             file_name_format="/tmp/{port_name}-{time_usec}",
             publish_period=0.125,
             start_time=0.0)
+
+    def test_image_writer_params(self):
+        params = mut.ImageWriterParams(
+            num_threads=2,
+            max_queue_size=4,
+            drop_oldest_when_full=True,
+            compression_level=1)
+        self.assertEqual(params.num_threads, 2)
+        self.assertIn("max_queue_size", repr(params))
+        copy.copy(params)
+
+        writer = mut.ImageWriter(params=params)
+        self.assertEqual(writer.params().max_queue_size, 4)
+        writer.DeclareImageInputPort(
+            pixel_type=mut.PixelType.kRgba8U,
+            port_name="color",
+            file_name_format="/tmp/{port_name}-{time_usec}",
+            publish_period=0.125,
+            start_time=0.0)
+        writer.Flush()
+        statistics = writer.GetStatistics()
+        self.assertIsInstance(statistics, mut.ImageWriterStatistics)
+        self.assertEqual(statistics.num_submitted, 0)
+        self.assertEqual(statistics.num_written, 0)
+        self.assertEqual(statistics.num_failed, 0)
+        self.assertEqual(statistics.num_dropped, 0)
+        self.assertEqual(statistics.queue_size, 0)
+        self.assertEqual(statistics.peak_queue_size, 0)
+        self.assertEqual(statistics.total_write_time, 0)
+        self.assertEqual(statistics.max_write_time, 0)
+        self.assertEqual(statistics.total_blocked_time, 0)
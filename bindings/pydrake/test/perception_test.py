@@ -1,5 +1,6 @@
 import pydrake.perception as mut
 
+import copy
 import unittest
 
 import numpy as np
@@ -126,6 +127,21 @@ class TestPerception(unittest.TestCase):
             radius=1, num_closest=50, parallelize=False)
         self.assertTrue(pc_merged_2.has_normals())
 
+        index = mut.PointCloudIndex(
+            xyzs=pc_merged_2.xyzs(), parallelize=False)
+        self.assertEqual(index.size(), pc_merged_2.size())
+        pc_merged_2.EstimateNormals(
+            index=index, radius=1, num_closest=50, parallelize=False)
+        indices, squared_distances = index.FindNearest(
+            queries=pc_merged_2.xyzs(), num_closest=3, radius=np.inf,
+            parallelize=False)
+        self.assertEqual(indices.shape, (3, pc_merged_2.size()))
+        self.assertEqual(squared_distances.shape, (3, pc_merged_2.size()))
+        neighbors = index.FindWithinRadius(
+            queries=pc_merged_2.xyzs(), radius=np.inf, parallelize=False)
+        self.assertEqual(len(neighbors), pc_merged_2.size())
+        copy.copy(index)
+
     def test_depth_image_to_point_cloud_api(self):
         camera_info = CameraInfo(width=640, height=480, fov_y=np.pi / 4)
         dut = mut.DepthImageToPointCloud(camera_info=camera_info)
@@ -137,7 +153,8 @@ class TestPerception(unittest.TestCase):
             camera_info=camera_info,
             pixel_type=PixelType.kDepth16U,
             scale=0.001,
-            fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs)
+            fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs,
+            parallelize=True)
 
     def test_point_cloud_to_lcm(self):
         dut = mut.PointCloudToLcm(frame_name="world")
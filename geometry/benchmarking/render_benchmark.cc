@@ -7,6 +7,7 @@
 #include <gflags/gflags.h>
 
 #include "drake/geometry/render_gl/factory.h"
+#include "drake/geometry/render_raycast/factory.h"
 #include "drake/geometry/render_vtk/factory.h"
 #include "drake/systems/sensors/image_writer.h"
 
@@ -37,6 +38,7 @@ using math::RotationMatrixd;
 using render::ColorRenderCamera;
 using render::DepthRange;
 using render::DepthRenderCamera;
+using render::ImageRenderRequest;
 using render::RenderCameraCore;
 using render::RenderEngine;
 using render::RenderEngineTester;
@@ -61,7 +63,7 @@ const double kFovY = M_PI_4;
 
 /* The render engines generally supported by this benchmark; not all
  renderers are supported by all operating systems.  */
-enum class EngineType { Vtk, Gl };
+enum class EngineType { Vtk, Gl, Raycast };
 
 /* Creates a render engine of the given type with the given background color. */
 template <EngineType engine_type>
@@ -75,6 +77,11 @@ std::unique_ptr<RenderEngine> MakeEngine(const Vector3d& bg_rgb) {
     params.default_clear_color.set(bg_rgb[0], bg_rgb[1], bg_rgb[2], 1.0);
     return MakeRenderEngineGl(params);
   }
+  if constexpr (engine_type == EngineType::Raycast) {
+    // The ray-casting engine doesn't render color, so it has no background.
+    // It renders serially by default; we measure it with all of the threads.
+    return MakeRenderEngineRaycast({.num_threads = 0});
+  }
 }
 
 class RenderBenchmark : public benchmark::Fixture {
@@ -182,6 +189,52 @@ class RenderBenchmark : public benchmark::Fixture {
     }
   }
 
+  /* Renders the color, depth, and label images for all of the cameras as a
+   single batch via RenderEngine::RenderImages(), writing into the same output
+   images on every iteration. This is the throughput-oriented use case (e.g.,
+   dataset generation) in which a simulation consumes all three images.  */
+  template <EngineType engine_type>
+  // NOLINTNEXTLINE(runtime/references)
+  void RgbdImage(::benchmark::State& state, const std::string& name) {
+    auto renderer = MakeEngine<engine_type>(bg_rgb_);
+    auto [sphere_count, camera_count, width, height] = ReadState(state);
+    SetupScene(sphere_count, camera_count, width, height, renderer.get());
+    std::vector<ImageRgba8U> color_images(camera_count,
+                                          ImageRgba8U(width, height));
+    std::vector<ImageDepth32F> depth_images(camera_count,
+                                            ImageDepth32F(width, height));
+    std::vector<ImageLabel16I> label_images(camera_count,
+                                            ImageLabel16I(width, height));
+    std::vector<ImageRenderRequest> requests;
+    for (int i = 0; i < camera_count; ++i) {
+      requests.push_back(
+          {.X_WC = X_WC_,
+           .color_camera =
+               ColorRenderCamera(depth_cameras_[i].core(), FLAGS_show_window),
+           .depth_camera = depth_cameras_[i],
+           .color_image = &color_images[i],
+           .depth_image = &depth_images[i],
+           .label_image = &label_images[i]});
+    }
+
+    /* See ColorImage() for the warm start rationale. */
+    for (int i = 0; i < 2; ++i) {
+      renderer->RenderImages(requests);
+    }
+
+    /* Now the timed loop. */
+    for (auto _ : state) {
+      renderer->UpdatePoses(poses_);
+      renderer->RenderImages(requests);
+    }
+    if (!FLAGS_save_image_path.empty()) {
+      SaveToPng(color_images[0], image_path_name(name + "Color", state, "png"));
+      SaveToTiff(depth_images[0],
+                 image_path_name(name + "Depth", state, "tiff"));
+      SaveToPng(label_images[0], image_path_name(name + "Label", state, "png"));
+    }
+  }
+
   /* Parse arguments from the benchmark state.
    @return A tuple representing the sphere count, camera count, width, and
            height.  */
@@ -296,9 +349,9 @@ class RenderBenchmark : public benchmark::Fixture {
     const Vector3d Cx_W{1, 0, 0};
     const Vector3d Cy_W{0, -1, 0};
     const Vector3d Cz_W{0, 0, -1};
-    RigidTransformd X_WC{
+    X_WC_ = RigidTransformd{
         RotationMatrixd::MakeFromOrthonormalColumns(Cx_W, Cy_W, Cz_W)};
-    engine->UpdateViewpoint(X_WC);
+    engine->UpdateViewpoint(X_WC_);
 
     // Add the cameras.
     for (int i = 0; i < camera_count; ++i) {
@@ -320,6 +373,8 @@ class RenderBenchmark : public benchmark::Fixture {
   }
 
   std::vector<DepthRenderCamera> depth_cameras_;
+  // The pose of all of the cameras; see SetupScene().
+  RigidTransformd X_WC_;
   PerceptionProperties material_;
   const Vector3d bg_rgb_{200 / 255., 0, 250 / 255.};
   const Rgba sphere_rgba_{0, 0.8, 0.5, 1};
@@ -339,7 +394,7 @@ class RenderBenchmark : public benchmark::Fixture {
    MAKE_BENCHMARK(Foo, ImageType)
 
  such that there must be a `EngineType::Foo` enum and mageType must be one of
- (Color, Depth, or Label). Capitalization matters.
+ (Color, Depth, Label, or Rgbd). Capitalization matters.
 
  N.B. The macro STR converts a single macro parameter into a string and we use
  it to make a string out of the concatenation of two macro parameters (i.e., we
@@ -373,13 +428,19 @@ BENCHMARK_REGISTER_F(RenderBenchmark, Renderer##ImageT) \
 MAKE_BENCHMARK(Vtk, Color);
 MAKE_BENCHMARK(Vtk, Depth);
 MAKE_BENCHMARK(Vtk, Label);
+MAKE_BENCHMARK(Vtk, Rgbd);
 
 #ifndef __APPLE__
 MAKE_BENCHMARK(Gl, Color);
 MAKE_BENCHMARK(Gl, Depth);
 MAKE_BENCHMARK(Gl, Label);
+MAKE_BENCHMARK(Gl, Rgbd);
 #endif
 
+// RenderEngineRaycast only renders depth and label images.
+MAKE_BENCHMARK(Raycast, Depth);
+MAKE_BENCHMARK(Raycast, Label);
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
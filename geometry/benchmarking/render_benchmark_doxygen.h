@@ -51,7 +51,10 @@ namespace render {
        with both simple and complex scenes.
 
  We examine those same properties for all three image types: color, depth, and
- label.
+ label, and for rendering all three images together as a single batch (see
+ RenderEngine::RenderImages()). The CPU ray-casting engine (see
+ MakeRenderEngineRaycast()) only renders depth and label images, so only those
+ benchmarks are run for it.
 
  <h2>Running the benchmark</h2>
 
@@ -134,9 +137,13 @@ namespace render {
      - __VtkColor__: Renders the color image from RenderEngineVtk.
      - __VtkDepth__: Renders the depth image from RenderEngineVtk.
      - __VtkLabel__: Renders the label image from RenderEngineVtk.
+     - __VtkRgbd__: Renders the color, depth, and label images from
+       RenderEngineVtk as a single batch.
      - __GlColor__: Renders the color image from RenderEngineGl.
      - __GlDepth__: Renders the depth image from RenderEngineGl.
      - __GlLabel__: Renders the label image from RenderEngineGl.
+     - __GlRgbd__: Renders the color, depth, and label images from
+       RenderEngineGl as a single batch.
    - __sphere_count__: The total number of spheres.
    - __camera_count__: Simply the number of independent cameras being rendered.
      The cameras are all co-located (same position, same view direction) so
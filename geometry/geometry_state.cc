@@ -1266,6 +1266,61 @@ void GeometryState<T>::RenderLabelImage(const ColorRenderCamera& camera,
   engine.RenderLabelImage(camera, label_image_out);
 }
 
+template <typename T>
+void GeometryState<T>::RenderImages(const ColorRenderCamera& color_camera,
+                                    const DepthRenderCamera& depth_camera,
+                                    FrameId parent_frame,
+                                    const RigidTransformd& X_PC,
+                                    ImageRgba8U* color_image_out,
+                                    ImageDepth32F* depth_image_out,
+                                    ImageLabel16I* label_image_out) const {
+  // The color and label images come from the color camera; the depth image
+  // from the depth camera.
+  std::vector<render::ImageRenderRequest> color_requests;
+  std::vector<render::ImageRenderRequest> depth_requests;
+  const render::RenderEngine* color_engine{};
+  const render::RenderEngine* depth_engine{};
+  if (color_image_out != nullptr || label_image_out != nullptr) {
+    color_engine = &GetRenderEngineOrThrow(color_camera.core().renderer_name());
+    color_requests.push_back(
+        {.X_WC = CalcCameraWorldPose(color_camera.core(), parent_frame, X_PC),
+         .color_camera = color_camera,
+         .color_image = color_image_out,
+         .label_image = label_image_out});
+  }
+  if (depth_image_out != nullptr) {
+    depth_engine = &GetRenderEngineOrThrow(depth_camera.core().renderer_name());
+    depth_requests.push_back(
+        {.X_WC = CalcCameraWorldPose(depth_camera.core(), parent_frame, X_PC),
+         .depth_camera = depth_camera,
+         .depth_image = depth_image_out});
+  }
+
+  // When both cameras use the same engine, all of the images go to it in a
+  // single batch -- in a single request if the cameras share a viewpoint.
+  if (color_engine != nullptr && color_engine == depth_engine) {
+    render::ImageRenderRequest& color_request = color_requests.front();
+    render::ImageRenderRequest& depth_request = depth_requests.front();
+    if (color_request.X_WC.IsExactlyEqualTo(depth_request.X_WC)) {
+      color_request.depth_camera = std::move(depth_request.depth_camera);
+      color_request.depth_image = depth_request.depth_image;
+    } else {
+      color_requests.push_back(std::move(depth_request));
+    }
+    depth_requests.clear();
+  }
+
+  // See note in RenderColorImage() about these const casts.
+  if (!color_requests.empty()) {
+    const_cast<render::RenderEngine*>(color_engine)
+        ->RenderImages(color_requests);
+  }
+  if (!depth_requests.empty()) {
+    const_cast<render::RenderEngine*>(depth_engine)
+        ->RenderImages(depth_requests);
+  }
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>>
 GeometryState<T>::ToAutoDiffXd() const {
@@ -596,6 +596,15 @@ class GeometryState {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Implementation of QueryObject::RenderImages().
+   @pre All poses have already been updated.  */
+  void RenderImages(const render::ColorRenderCamera& color_camera,
+                    const render::DepthRenderCamera& depth_camera,
+                    FrameId parent_frame, const math::RigidTransformd& X_PC,
+                    systems::sensors::ImageRgba8U* color_image_out,
+                    systems::sensors::ImageDepth32F* depth_image_out,
+                    systems::sensors::ImageLabel16I* label_image_out) const;
+
   //@}
 
   /** @name Scalar conversion */
@@ -1,6 +1,7 @@
 #include "drake/geometry/meshcat.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cctype>
 #include <exception>
@@ -8,6 +9,7 @@
 #include <fstream>
 #include <functional>
 #include <future>
+#include <limits>
 #include <map>
 #include <optional>
 #include <regex>
@@ -114,6 +116,22 @@ struct PerSocketData {
 using WebSocket = uWS::WebSocket<kSsl, kIsServer, PerSocketData>;
 using MsgPackMap = std::map<std::string, msgpack::object>;
 
+// When any connection has more than this many bytes waiting to be sent, the
+// transforms from SetTransforms() are held back (and coalesced) until it
+// drains.
+constexpr int kMaxTransformBackpressure = 1 << 20;
+
+// Returns `path` with any repeated '/' collapsed, so that equivalent spellings
+// of a (full) path compare equal.
+std::string CollapseSlashes(std::string path) {
+  path.erase(std::unique(path.begin(), path.end(),
+                         [](char a, char b) {
+                           return a == '/' && b == '/';
+                         }),
+             path.end());
+  return path;
+}
+
 // Encode the meshcat command into a Javascript fetch() command.  The particular
 // syntax using `fetch()` was replicated from the corresponding functionality in
 // meshcat-python.
@@ -751,8 +769,22 @@ class Meshcat::Impl {
     do {
       std::promise<int> p;
       std::future<int> f = p.get_future();
-      Defer([this, p = std::move(p)]() mutable {
+      // Sending the transforms held back by SetTransforms() doesn't change
+      // what has been set, so it's fine to do even though we're const.
+      Impl* const self = const_cast<Impl*>(this);
+      Defer([this, self, p = std::move(p)]() mutable {
         DRAKE_DEMAND(IsThread(websocket_thread_id_));
+        // Any transforms that SetTransforms() is holding back for a backlogged
+        // connection are sent now, so that they are drained along with
+        // everything else.
+        bool flush_scheduled{};
+        {
+          std::lock_guard<std::mutex> lock(self->pending_transforms_mutex_);
+          flush_scheduled = self->transforms_flush_scheduled_;
+        }
+        if (flush_scheduled) {
+          self->FlushPendingTransforms(/* ignore_backpressure = */ true);
+        }
         int websocket_backpressure = 0;
         for (WebSocket* ws : websockets_) {
           websocket_backpressure += ws->getBufferedAmount();
@@ -842,44 +874,100 @@ class Meshcat::Impl {
   void SetObject(std::string_view path, const perception::PointCloud& cloud,
                  double point_size, const Rgba& rgba) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
-
-    uuids::uuid_random_generator uuid_generator{generator_};
-    internal::SetObjectData data;
-    data.path = FullPath(path);
-
     auto geometry = std::make_unique<internal::BufferGeometryData>();
-    geometry->uuid = uuids::to_string(uuid_generator());
     geometry->position = cloud.xyzs();
     if (cloud.has_rgbs()) {
       geometry->color = cloud.rgbs().cast<float>()/255.0;
     }
-    data.object.geometry = std::move(geometry);
+    SetPoints(path, std::move(geometry), internal::MeshData{}, point_size,
+              rgba, cloud.has_rgbs());
+  }
 
-    auto material = std::make_unique<internal::MaterialData>();
-    material->uuid = uuids::to_string(uuid_generator());
-    material->type = "PointsMaterial";
-    material->color = ToMeshcatColor(rgba);
-    material->transparent = (rgba.a() != 1.0);
-    material->opacity = rgba.a();
-    material->size = point_size;
-    material->vertexColors = cloud.has_rgbs();
-    data.object.material = std::move(material);
+  // This function is public via the PIMPL.
+  void SetObject(std::string_view path, const perception::PointCloud& cloud,
+                 double point_size, const Rgba& rgba,
+                 const PointCloudEncoding& encoding) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
 
-    internal::MeshData mesh;
-    mesh.uuid = uuids::to_string(uuid_generator());
-    mesh.type = "Points";
-    mesh.geometry = data.object.geometry->uuid;
-    mesh.material = data.object.material->uuid;
-    data.object.object = std::move(mesh);
+    // Choose which points to send: every stride'th point that is finite.
+    int stride = 1;
+    if (encoding.max_points.has_value() &&
+        cloud.size() > *encoding.max_points) {
+      stride = (cloud.size() + *encoding.max_points - 1) / *encoding.max_points;
+    }
+    if (encoding.max_backlog_bytes.has_value()) {
+      stride *= 1 + max_buffered_amount_ / *encoding.max_backlog_bytes;
+    }
+    const Eigen::Ref<const Matrix3X<float>> xyzs = cloud.xyzs();
+    std::vector<int> indices;
+    indices.reserve(cloud.size() / stride + 1);
+    for (int i = 0; i < cloud.size(); i += stride) {
+      if (xyzs.col(i).allFinite()) {
+        indices.push_back(i);
+      }
+    }
+    const int num_points = static_cast<int>(indices.size());
 
-    Defer([this, data = std::move(data)]() {
-      std::stringstream message_stream;
-      msgpack::pack(message_stream, data);
-      std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
-      SceneTreeElement& e = scene_tree_root_[data.path];
-      e.object() = std::move(message);
-    });
+    auto geometry = std::make_unique<internal::BufferGeometryData>();
+    internal::MeshData mesh;
+    if (encoding.quantize) {
+      // The positions are quantized relative to their bounding box; the
+      // object's matrix scales the unit cube back up to that box.
+      Eigen::Vector3f lower = Eigen::Vector3f::Zero();
+      Eigen::Vector3f upper = Eigen::Vector3f::Zero();
+      if (num_points > 0) {
+        lower = upper = xyzs.col(indices[0]);
+      }
+      for (int i : indices) {
+        lower = lower.cwiseMin(xyzs.col(i));
+        upper = upper.cwiseMax(xyzs.col(i));
+      }
+      Eigen::Vector3f scale = upper - lower;
+      for (int k = 0; k < 3; ++k) {
+        // A flat box quantizes every coordinate along that axis to zero; any
+        // non-zero scale serves, and keeps the matrix invertible.
+        if (!(scale[k] > 0)) {
+          scale[k] = 1;
+        }
+      }
+      constexpr float kMaxStep = std::numeric_limits<uint16_t>::max();
+      const Eigen::Vector3f steps_per_meter = scale.cwiseInverse() * kMaxStep;
+      geometry->quantized_position.resize(3, num_points);
+      for (int j = 0; j < num_points; ++j) {
+        const Eigen::Vector3f steps = (xyzs.col(indices[j]) - lower)
+                                          .cwiseProduct(steps_per_meter)
+                                          .array()
+                                          .round()
+                                          .matrix();
+        geometry->quantized_position.col(j) =
+            steps.cwiseMin(kMaxStep).cast<uint16_t>();
+      }
+      std::fill(std::begin(mesh.matrix), std::end(mesh.matrix), 0.0);
+      for (int k = 0; k < 3; ++k) {
+        mesh.matrix[5 * k] = scale[k];
+        mesh.matrix[12 + k] = lower[k];
+      }
+      mesh.matrix[15] = 1.0;
+      if (cloud.has_rgbs()) {
+        geometry->quantized_color.resize(3, num_points);
+        for (int j = 0; j < num_points; ++j) {
+          geometry->quantized_color.col(j) = cloud.rgb(indices[j]);
+        }
+      }
+    } else {
+      geometry->position.resize(3, num_points);
+      for (int j = 0; j < num_points; ++j) {
+        geometry->position.col(j) = xyzs.col(indices[j]);
+      }
+      if (cloud.has_rgbs()) {
+        geometry->color.resize(3, num_points);
+        for (int j = 0; j < num_points; ++j) {
+          geometry->color.col(j) = cloud.rgb(indices[j]).cast<float>() / 255.0;
+        }
+      }
+    }
+    SetPoints(path, std::move(geometry), std::move(mesh), point_size, rgba,
+              cloud.has_rgbs());
   }
 
   // This function is public via the PIMPL.
@@ -927,6 +1015,46 @@ class Meshcat::Impl {
     SetLineImpl(path, vertices, line_width, rgba, kLineSegments);
   }
 
+  // Sets the object at `path` to a three.js Points object drawing the given
+  // `geometry`; the uuids of `geometry` and `mesh` are filled in here.
+  void SetPoints(std::string_view path,
+                 std::unique_ptr<internal::BufferGeometryData> geometry,
+                 internal::MeshData mesh, double point_size, const Rgba& rgba,
+                 bool vertex_colors) {
+    uuids::uuid_random_generator uuid_generator{generator_};
+    internal::SetObjectData data;
+    data.path = FullPath(path);
+
+    geometry->uuid = uuids::to_string(uuid_generator());
+    data.object.geometry = std::move(geometry);
+
+    auto material = std::make_unique<internal::MaterialData>();
+    material->uuid = uuids::to_string(uuid_generator());
+    material->type = "PointsMaterial";
+    material->color = ToMeshcatColor(rgba);
+    material->transparent = (rgba.a() != 1.0);
+    material->opacity = rgba.a();
+    material->size = point_size;
+    material->vertexColors = vertex_colors;
+    data.object.material = std::move(material);
+
+    mesh.uuid = uuids::to_string(uuid_generator());
+    mesh.type = "Points";
+    mesh.geometry = data.object.geometry->uuid;
+    mesh.material = data.object.material->uuid;
+    data.object.object = std::move(mesh);
+
+    Defer([this, data = std::move(data)]() {
+      std::stringstream message_stream;
+      msgpack::pack(message_stream, data);
+      std::string message = message_stream.str();
+      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      SceneTreeElement& e = scene_tree_root_[data.path];
+      e.object() = std::move(message);
+      UpdateMaxBufferedAmount();
+    });
+  }
+
   // This function is internal to the PIMPL, used to implement the prior two
   // functions (SetLine and SetLineSegments).
   void SetLineImpl(std::string_view path,
@@ -1099,6 +1227,14 @@ class Meshcat::Impl {
     data.path = FullPath(path);
     Eigen::Map<Eigen::Matrix4d>(data.matrix) = matrix;
 
+    // This transform supersedes any that SetTransforms() has not yet sent.
+    const std::string key = CollapseSlashes(data.path);
+    sent_transforms_[key] = matrix;
+    {
+      std::lock_guard<std::mutex> lock(pending_transforms_mutex_);
+      pending_transforms_.erase(key);
+    }
+
     Defer([this, data = std::move(data)]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
       DRAKE_DEMAND(app_ != nullptr);
@@ -1111,6 +1247,37 @@ class Meshcat::Impl {
     });
   }
 
+  // This function is public via the PIMPL.
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<RigidTransformd>& X_ParentPaths,
+                     double tolerance) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+    DRAKE_DEMAND(paths.size() == X_ParentPaths.size());
+
+    std::lock_guard<std::mutex> lock(pending_transforms_mutex_);
+    bool any_changed = false;
+    for (size_t i = 0; i < paths.size(); ++i) {
+      std::string full_path = CollapseSlashes(FullPath(paths[i]));
+      const Eigen::Matrix4d matrix = X_ParentPaths[i].GetAsMatrix4();
+      auto [iter, inserted] = sent_transforms_.try_emplace(full_path, matrix);
+      if (!inserted) {
+        if ((iter->second - matrix).cwiseAbs().maxCoeff() <= tolerance) {
+          continue;
+        }
+        iter->second = matrix;
+      }
+      Eigen::Map<Eigen::Matrix4d>(
+          pending_transforms_[std::move(full_path)].data()) = matrix;
+      any_changed = true;
+    }
+    if (any_changed && !transforms_flush_scheduled_) {
+      transforms_flush_scheduled_ = true;
+      Defer([this]() {
+        FlushPendingTransforms(/* ignore_backpressure = */ false);
+      });
+    }
+  }
+
   // This function is public via the PIMPL.
   void Delete(std::string_view path) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
@@ -1118,6 +1285,30 @@ class Meshcat::Impl {
     internal::DeleteData data;
     data.path = FullPath(path);
 
+    // Forget the transforms at or beneath the deleted path, so they'll be sent
+    // again (even if unchanged) when the path is repopulated.
+    const std::string deleted = CollapseSlashes(data.path);
+    const auto is_deleted = [&deleted](const std::string& key) {
+      return key.compare(0, deleted.size(), deleted) == 0 &&
+             (key.size() == deleted.size() ||
+              (!deleted.empty() && deleted.back() == '/') ||
+              key[deleted.size()] == '/');
+    };
+    const auto erase_deleted = [&is_deleted](auto* transforms) {
+      for (auto iter = transforms->begin(); iter != transforms->end();) {
+        if (is_deleted(iter->first)) {
+          iter = transforms->erase(iter);
+        } else {
+          ++iter;
+        }
+      }
+    };
+    erase_deleted(&sent_transforms_);
+    {
+      std::lock_guard<std::mutex> lock(pending_transforms_mutex_);
+      erase_deleted(&pending_transforms_);
+    }
+
     Defer([this, data = std::move(data)]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
       DRAKE_DEMAND(app_ != nullptr);
@@ -1742,6 +1933,11 @@ class Meshcat::Impl {
       unused(message);
       HandleSocketClose(ws);
     };
+    behavior.drain = [this](WebSocket* ws) {
+      // IsThread(websocket_thread_id_) is checked by the Handle... function.
+      unused(ws);
+      HandleSocketDrain();
+    };
     behavior.message = [this](WebSocket* ws, std::string_view message,
                               uWS::OpCode op_code) {
       // IsThread(websocket_thread_id_) is checked by the Handle... function.
@@ -1851,6 +2047,79 @@ class Meshcat::Impl {
     const int new_count = --num_websockets_;
     DRAKE_DEMAND(new_count >= 0);
     DRAKE_DEMAND(new_count == static_cast<int>(websockets_.size()));
+    // The closed connection might have been the one holding back transforms.
+    HandleSocketDrain();
+  }
+
+  // This function is a callback from a WebSocketBehavior, invoked when a
+  // connection's backlog has (at least partially) drained.
+  void HandleSocketDrain() {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    UpdateMaxBufferedAmount();
+    bool flush_scheduled{};
+    {
+      std::lock_guard<std::mutex> lock(pending_transforms_mutex_);
+      flush_scheduled = transforms_flush_scheduled_;
+    }
+    if (flush_scheduled) {
+      FlushPendingTransforms(/* ignore_backpressure = */ false);
+    }
+  }
+
+  // Records the largest backlog among the current connections, for use by the
+  // adaptive decimation of point clouds.
+  void UpdateMaxBufferedAmount() {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    int max_buffered_amount = 0;
+    for (WebSocket* ws : websockets_) {
+      max_buffered_amount =
+          std::max<int>(max_buffered_amount, ws->getBufferedAmount());
+    }
+    max_buffered_amount_ = max_buffered_amount;
+  }
+
+  // Publishes all of the transforms accumulated by SetTransforms() as a single
+  // message. Unless `ignore_backpressure` is set, if a connection is too
+  // backlogged then they instead remain pending (and continue to be coalesced)
+  // until HandleSocketDrain() or Flush() retries.
+  void FlushPendingTransforms(bool ignore_backpressure) {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    DRAKE_DEMAND(app_ != nullptr);
+    if (!ignore_backpressure) {
+      for (WebSocket* ws : websockets_) {
+        if (ws->getBufferedAmount() > kMaxTransformBackpressure) {
+          return;
+        }
+      }
+    }
+
+    std::map<std::string, std::array<double, 16>> pending;
+    {
+      std::lock_guard<std::mutex> lock(pending_transforms_mutex_);
+      pending.swap(pending_transforms_);
+      transforms_flush_scheduled_ = false;
+    }
+    if (pending.empty()) {
+      return;
+    }
+
+    internal::SetTransformsData data;
+    data.paths.reserve(pending.size());
+    data.matrices.reserve(16 * pending.size());
+    internal::SetTransformData single;
+    for (auto& [path, matrix] : pending) {
+      data.matrices.insert(data.matrices.end(), matrix.begin(), matrix.end());
+      // New connections are sent each path's transform individually.
+      single.path = path;
+      std::copy(matrix.begin(), matrix.end(), single.matrix);
+      std::stringstream single_stream;
+      msgpack::pack(single_stream, single);
+      scene_tree_root_[path].transform() = single_stream.str();
+      data.paths.push_back(std::move(path));
+    }
+    std::stringstream message_stream;
+    msgpack::pack(message_stream, data);
+    app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
   }
 
   // This function is a callback from a WebSocketBehavior.
@@ -1981,6 +2250,19 @@ class Meshcat::Impl {
   int port_{};
   std::mt19937 generator_{};
   double realtime_rate_{0.0};
+  // The transform most recently set for each (full) path, used by
+  // SetTransforms() to skip unchanged transforms.
+  std::map<std::string, Eigen::Matrix4d> sent_transforms_;
+
+  // Both threads access the following variables, guarded by
+  // pending_transforms_mutex_. The transforms from SetTransforms() that have
+  // not yet been sent are keyed by full path. When the flag is set, either a
+  // FlushPendingTransforms() is queued in the websocket thread or the flush is
+  // waiting for the connections to drain; either way, the main thread need not
+  // queue another.
+  std::mutex pending_transforms_mutex_;
+  std::map<std::string, std::array<double, 16>> pending_transforms_;
+  bool transforms_flush_scheduled_{false};
 
   // These variables should only be accessed in the websocket thread.
   std::thread::id websocket_thread_id_{};
@@ -1990,9 +2272,12 @@ class Meshcat::Impl {
   us_listen_socket_t* listen_socket_{nullptr};
   std::set<WebSocket*> websockets_{};
 
-  // This variable may be accessed from any thread, but should only be modified
-  // in the websocket thread.
+  // These variables may be accessed from any thread, but should only be
+  // modified in the websocket thread.
   std::atomic<int> num_websockets_{0};
+  // The largest number of bytes queued for any one connection, as of the most
+  // recent publication of a point cloud or drain of a connection.
+  std::atomic<int> max_buffered_amount_{0};
 
   // The loop_ pointer is used to pass functors from the main thread into the
   // websocket worker thread, via loop_->defer(...). See the documentation of
@@ -2142,6 +2427,23 @@ void Meshcat::SetObject(std::string_view path,
   impl().SetObject(path, cloud, point_size, rgba);
 }
 
+void Meshcat::SetObject(std::string_view path,
+                        const perception::PointCloud& cloud, double point_size,
+                        const Rgba& rgba, const PointCloudEncoding& encoding) {
+  if (encoding.max_points.has_value() && *encoding.max_points <= 0) {
+    throw std::logic_error(fmt::format(
+        "Meshcat::SetObject(): max_points ({}) must be positive",
+        *encoding.max_points));
+  }
+  if (encoding.max_backlog_bytes.has_value() &&
+      *encoding.max_backlog_bytes <= 0) {
+    throw std::logic_error(fmt::format(
+        "Meshcat::SetObject(): max_backlog_bytes ({}) must be positive",
+        *encoding.max_backlog_bytes));
+  }
+  impl().SetObject(path, cloud, point_size, rgba, encoding);
+}
+
 void Meshcat::SetObject(std::string_view path,
                         const TriangleSurfaceMesh<double>& mesh,
                         const Rgba& rgba, bool wireframe,
@@ -2268,6 +2570,31 @@ void Meshcat::SetTransform(std::string_view path,
   impl().SetTransform(path, matrix);
 }
 
+void Meshcat::SetTransforms(const std::vector<std::string>& paths,
+                            const std::vector<RigidTransformd>& X_ParentPaths,
+                            const std::optional<double>& time,
+                            double tolerance) {
+  if (paths.size() != X_ParentPaths.size()) {
+    throw std::logic_error(fmt::format(
+        "Meshcat::SetTransforms(): got {} paths but {} transforms",
+        paths.size(), X_ParentPaths.size()));
+  }
+  if (!(tolerance >= 0.0)) {
+    throw std::logic_error(fmt::format(
+        "Meshcat::SetTransforms(): the tolerance ({}) must be non-negative",
+        tolerance));
+  }
+  if (recording_ && time) {
+    const int frame = animation_->frame(*time);
+    for (size_t i = 0; i < paths.size(); ++i) {
+      animation_->SetTransform(frame, paths[i], X_ParentPaths[i]);
+    }
+  }
+  if (!recording_ || !time || set_visualizations_while_recording_) {
+    impl().SetTransforms(paths, X_ParentPaths, tolerance);
+  }
+}
+
 void Meshcat::Delete(std::string_view path) {
   impl().Delete(path);
 }
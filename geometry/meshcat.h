@@ -169,7 +169,9 @@ class Meshcat {
   has been sent to any connected clients. This can be especially useful when
   sending many or large mesh files / texture maps, to avoid large "backpressure"
   and/or simply to make sure that the simulation does not get far ahead of the
-  visualization. */
+  visualization. This includes any transforms from SetTransforms() that are
+  still being held back for a backlogged connection; they are sent (and then
+  drained) before this returns. */
   void Flush() const;
 
   /** Sets the 3D object at a given `path` in the scene tree.  Note that
@@ -208,6 +210,50 @@ class Meshcat {
                  double point_size = 0.001,
                  const Rgba& rgba = Rgba(.9, .9, .9, 1.));
 
+  /** Options for sending a point cloud in a more compact form than the
+   default (which sends every point's position and color as 32-bit floats).
+   Large clouds, e.g., those produced by depth cameras at a high rate, can
+   otherwise saturate the connection to the browser. */
+  struct PointCloudEncoding {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+      a->Visit(DRAKE_NVP(quantize));
+      a->Visit(DRAKE_NVP(max_points));
+      a->Visit(DRAKE_NVP(max_backlog_bytes));
+    }
+
+    /** When true, each position is quantized to 16 bits per coordinate
+    relative to the axis-aligned bounding box of the (finite) points, and each
+    color is sent as 8 bits per channel. The position error is at most 1/131070
+    of the bounding box's extent along each axis. */
+    bool quantize{true};
+
+    /** If set, clouds with more points than this are decimated (by keeping
+    every k'th point) so that at most this many points are sent. Must be
+    positive. */
+    std::optional<int> max_points;
+
+    /** If set, the cloud is adaptively decimated whenever the data queued for
+    (but not yet received by) some browser exceeds this many bytes: a backlog
+    of n times this limit keeps only every (n+1)'th point. A slow connection
+    therefore sees a sparser cloud rather than an ever-growing delay. Must be
+    positive. */
+    std::optional<int> max_backlog_bytes;
+  };
+
+  /** Sets the "object" at `path` in the scene tree to be `point_cloud`,
+  exactly like the overload above, but sent using the given `encoding`. Points
+  with non-finite positions are omitted.
+  @throws std::exception if `encoding` has a non-positive `max_points` or
+  `max_backlog_bytes`.
+  @pydrake_mkdoc_identifier{cloud_encoding}
+  */
+  void SetObject(std::string_view path,
+                 const perception::PointCloud& point_cloud, double point_size,
+                 const Rgba& rgba, const PointCloudEncoding& encoding);
+
   /** Sets the "object" at `path` in the scene tree to a TriangleSurfaceMesh.
 
   @param path a "/"-delimited string indicating the path in the scene tree. See
@@ -473,6 +519,41 @@ class Meshcat {
   void SetTransform(std::string_view path,
                     const Eigen::Ref<const Eigen::Matrix4d>& matrix);
 
+  /** Sets the RigidTransform for many paths at once; this is the preferred way
+  to move a large number of objects on every publish. The effect is as if
+  SetTransform() were called for each pair of `paths[i]` and
+  `X_ParentPaths[i]`, except that:
+  - the changed transforms are sent to the browsers in a single message,
+  - a transform whose 4x4 homogeneous matrix differs from the one most
+    recently set for the same path by no more than `tolerance` in every element
+    is not sent at all (for two RigidTransforms, this is the same measure as
+    math::RigidTransform::IsNearlyEqualTo()), and
+  - transforms that have not yet been sent when newer ones arrive for the same
+    path (e.g., because a browser has fallen behind and its connection is
+    backlogged) are replaced, so that only the newest transform for each path
+    is eventually sent.
+
+  Deleting a path (see Delete()) forgets the transforms previously set at or
+  beneath it, so they will be sent again even if unchanged.
+
+  @param paths "/"-delimited strings indicating paths in the scene tree. See
+              @ref meshcat_path "Meshcat paths" for the semantics.
+  @param X_ParentPaths the relative transforms from each path to its immediate
+              parent.
+  @param time_in_recording (optional). If recording (see StartRecording()), then
+              every transform (changed or not) is also saved to the current
+              animation at `time_in_recording`.
+  @param tolerance the non-negative tolerance below which changes are not
+              sent. The default of zero skips only transforms that are
+              exactly unchanged.
+  @throws std::exception if the sizes of `paths` and `X_ParentPaths` differ,
+              or if `tolerance` is negative. */
+  void SetTransforms(
+      const std::vector<std::string>& paths,
+      const std::vector<math::RigidTransformd>& X_ParentPaths,
+      const std::optional<double>& time_in_recording = std::nullopt,
+      double tolerance = 0.0);
+
   /** Deletes the object at the given `path` as well as all of its children.
   See @ref meshcat_path for the detailed semantics of deletion. */
   void Delete(std::string_view path = "");
@@ -47,6 +47,7 @@ MeshcatPointCloudVisualizer<T>::MeshcatPointCloudVisualizer(
                                   other.publish_period_) {
   set_point_size(other.point_size_);
   set_default_rgba(other.default_rgba_);
+  set_encoding(other.encoding_);
 }
 
 template <typename T>
@@ -59,7 +60,11 @@ systems::EventStatus MeshcatPointCloudVisualizer<T>::UpdateMeshcat(
     const systems::Context<T>& context) const {
   const auto& cloud =
       cloud_input_port().template Eval<perception::PointCloud>(context);
-  meshcat_->SetObject(path_, cloud, point_size_, default_rgba_);
+  if (encoding_.has_value()) {
+    meshcat_->SetObject(path_, cloud, point_size_, default_rgba_, *encoding_);
+  } else {
+    meshcat_->SetObject(path_, cloud, point_size_, default_rgba_);
+  }
 
   const math::RigidTransformd X_ParentCloud =
       pose_input_port().HasValue(context)
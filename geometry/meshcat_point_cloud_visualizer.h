@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -62,6 +63,14 @@ class MeshcatPointCloudVisualizer final : public systems::LeafSystem<T> {
   `has_rgbs() == false` for the cloud on the input port. */
   void set_default_rgba(const Rgba& rgba) { default_rgba_ = rgba; }
 
+  /** Sets the encoding used to send each cloud to Meshcat, e.g., to quantize
+   and decimate the large clouds produced by depth cameras. By default (or
+   after passing nullopt), clouds are sent in full. See
+   Meshcat::PointCloudEncoding. */
+  void set_encoding(std::optional<Meshcat::PointCloudEncoding> encoding) {
+    encoding_ = std::move(encoding);
+  }
+
   /** Calls Meshcat::Delete(path), where `path` is the value passed in the
    constructor. */
   void Delete() const;
@@ -102,6 +111,7 @@ class MeshcatPointCloudVisualizer final : public systems::LeafSystem<T> {
   /* Visualization parameters. */
   double point_size_{0.001};
   Rgba default_rgba_{.9, .9, .9, 1.0};
+  std::optional<Meshcat::PointCloudEncoding> encoding_;
 
   /* We store the arguments passed in the constructor to support scalar
   conversion. */
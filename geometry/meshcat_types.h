@@ -261,12 +261,71 @@ struct MeshFileGeometryData : public GeometryData {
   }
 };
 
+// Packs `mat` as a three.js BufferAttribute, with one column per item. When
+// `normalized` is true, integer values are mapped by the shader onto [0, 1]
+// (for unsigned types), e.g., a uint8_t value v is seen as v / 255.
+template <typename Stream, typename Derived>
+void PackBufferAttribute(
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of msgpack.
+    msgpack::packer<Stream>& o, const Eigen::MatrixBase<Derived>& mat,
+    bool normalized) {
+  using Scalar = typename Derived::Scalar;
+  o.pack_map(4);
+  o.pack("itemSize");
+  o.pack(mat.rows());
+  o.pack("type");
+  int8_t ext;
+  // Based on pack_numpy_array method in meshcat-python geometry.py. See also
+  // https://github.com/msgpack/msgpack/blob/master/spec.md#extension-types
+  if constexpr (std::is_floating_point_v<Scalar>) {
+    o.pack("Float32Array");
+    ext = 0x17;
+  } else if constexpr (std::is_same_v<Scalar, uint8_t>) {
+    o.pack("Uint8Array");
+    ext = 0x12;
+  } else if constexpr (std::is_same_v<Scalar, uint16_t>) {
+    o.pack("Uint16Array");
+    ext = 0x14;
+  } else if constexpr (std::is_same_v<Scalar, uint32_t>) {
+    o.pack("Uint32Array");
+    ext = 0x16;
+  } else {
+    throw std::runtime_error("Unsupported Scalar " +
+                             drake::NiceTypeName::Get(typeid(Scalar)));
+  }
+  o.pack("array");
+  if constexpr (std::is_floating_point_v<Scalar>) {
+    // Three.js only uses float, and meshcat only parses Float32Array (not
+    // doubles).
+    size_t s = mat.size() * sizeof(float);
+    o.pack_ext(s, ext);
+    const Eigen::Matrix<float, Derived::RowsAtCompileTime,
+                        Derived::ColsAtCompileTime>
+        mat_float = mat.template cast<float>();
+    o.pack_ext_body(reinterpret_cast<const char*>(mat_float.data()), s);
+  } else {
+    size_t s = mat.size() * sizeof(Scalar);
+    o.pack_ext(s, ext);
+    const Eigen::Matrix<Scalar, Derived::RowsAtCompileTime,
+                        Derived::ColsAtCompileTime>
+        mat_dense = mat;
+    o.pack_ext_body(reinterpret_cast<const char*>(mat_dense.data()), s);
+  }
+  o.pack("normalized");
+  o.pack(normalized);
+}
+
 struct BufferGeometryData : public GeometryData {
   // We deviate from the meshcat data structure, since it is an unnecessarily
   // deep hierarchy of dictionaries, and simply implement the packer manually.
   Eigen::Matrix3Xf position;
   Eigen::Matrix3Xf color;
   Eigen::Matrix<uint32_t, 3, Eigen::Dynamic> faces;
+  // When non-empty, these replace `position` and `color` (respectively) with
+  // normalized attributes, i.e., the shader sees each coordinate as a value in
+  // [0, 1]; the object's matrix must map that unit cube to the bounding box.
+  Eigen::Matrix<uint16_t, 3, Eigen::Dynamic> quantized_position;
+  Eigen::Matrix<uint8_t, 3, Eigen::Dynamic> quantized_color;
 
   // NOLINTNEXTLINE(runtime/references) cpplint disapproves of msgpack choices.
   void msgpack_pack(msgpack::packer<std::stringstream>& o) const override {
@@ -283,13 +342,22 @@ struct BufferGeometryData : public GeometryData {
       o.pack_map(1);
     }
     o.pack("attributes");
-    if (color.cols() > 0) {
+    if (quantized_color.cols() > 0) {
+      o.pack_map(2);
+      o.pack("color");
+      PackBufferAttribute(o, quantized_color, true);
+    } else if (color.cols() > 0) {
       o.pack_map(2);
       PACK_MAP_VAR(o, color);
     } else {
       o.pack_map(1);
     }
-    PACK_MAP_VAR(o, position);
+    if (quantized_position.cols() > 0) {
+      o.pack("position");
+      PackBufferAttribute(o, quantized_position, true);
+    } else {
+      PACK_MAP_VAR(o, position);
+    }
   }
 };
 
@@ -387,6 +455,17 @@ struct SetTransformData {
   MSGPACK_DEFINE_MAP(type, path, matrix);
 };
 
+// Note that this struct is unique to Drake's integration of meshcat; it is not
+// part of upstream meshcat.js. We handle it within meshcat.html by feeding one
+// set_transform command per path into meshcat.js.
+struct SetTransformsData {
+  std::string type{"set_transforms"};
+  std::vector<std::string> paths;
+  // The (column-major) matrices for each of the paths, concatenated.
+  std::vector<double> matrices;
+  MSGPACK_DEFINE_MAP(type, paths, matrices);
+};
+
 // Note that this struct is unique to Drake's integration of meshcat; it is not
 // part of upstream meshcat.js. We handle it directly within meshcat.html,
 // without ever feeding it into meshcat.js.
@@ -504,43 +583,7 @@ struct pack<Eigen::Matrix<Scalar, RowsAtCompileTime, ColsAtCompileTime, Options,
       const Eigen::Matrix<Scalar, RowsAtCompileTime, ColsAtCompileTime, Options,
                           MaxRowsAtCompileTime, MaxColsAtCompileTime>& mat)
       const {
-    o.pack_map(4);
-    o.pack("itemSize");
-    o.pack(mat.rows());
-    o.pack("type");
-    int8_t ext;
-    // Based on pack_numpy_array method in meshcat-python geometry.py. See also
-    // https://github.com/msgpack/msgpack/blob/master/spec.md#extension-types
-    if (std::is_floating_point_v<Scalar>) {
-      o.pack("Float32Array");
-      ext = 0x17;
-    } else if (std::is_same_v<std::remove_cv<Scalar>, uint8_t>) {
-      o.pack("Uint8Array");
-      ext = 0x12;
-    } else if (std::is_same_v<Scalar, uint32_t>) {
-      // TODO(russt): Using std::remove_cv<Scalar> did not work here (it failed
-      // to match).  Need to understand and resolve this.
-      o.pack("Uint32Array");
-      ext = 0x16;
-    } else {
-      throw std::runtime_error("Unsupported Scalar " +
-                               drake::NiceTypeName::Get(typeid(Scalar)));
-    }
-    o.pack("array");
-    if (std::is_same_v<std::remove_cv<Scalar>, double>) {
-      // Three.js only uses float, and meshcat only parses Float32Array (not
-      // doubles).
-      size_t s = mat.size() * sizeof(float);
-      o.pack_ext(s, ext);
-      auto mat_float = mat.template cast<float>().eval();
-      o.pack_ext_body(reinterpret_cast<const char*>(mat_float.data()), s);
-    } else {
-      size_t s = mat.size() * sizeof(Scalar);
-      o.pack_ext(s, ext);
-      o.pack_ext_body(reinterpret_cast<const char*>(mat.data()), s);
-    }
-    o.pack("normalized");
-    o.pack(false);
+    drake::geometry::internal::PackBufferAttribute(o, mat, false);
     return o;
   }
 };
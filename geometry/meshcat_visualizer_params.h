@@ -24,6 +24,7 @@ struct MeshcatVisualizerParams {
     a->Visit(DRAKE_NVP(visible_by_default));
     a->Visit(DRAKE_NVP(show_hydroelastic));
     a->Visit(DRAKE_NVP(include_unspecified_accepting));
+    a->Visit(DRAKE_NVP(transform_tolerance));
   }
 
   /** The duration (in simulation seconds) between attempts to update poses in
@@ -81,6 +82,12 @@ struct MeshcatVisualizerParams {
    is absent then the geometry will be shown only if
    `include_unspecified_accepting` is true. */
   bool include_unspecified_accepting{true};
+
+  /** On each publish, a frame whose pose differs from the pose most recently
+   sent to Meshcat by no more than this tolerance is not sent again. The
+   default of zero skips only frames that have not moved at all. See
+   Meshcat::SetTransforms() for details. */
+  double transform_tolerance{0.0};
 };
 
 }  // namespace geometry
@@ -1,5 +1,7 @@
 #include "drake/geometry/proximity/boxes_overlap.h"
 
+#include "drake/common/drake_assert.h"
+
 namespace drake {
 namespace geometry {
 namespace internal {
@@ -66,6 +68,89 @@ bool BoxesOverlap(const Vector3d& half_size_a, const Vector3d& half_size_b,
   return true;
 }
 
+void BoxPairBatch::Add(const Vector3d& half_size_a_in,
+                       const Vector3d& half_size_b_in,
+                       const RigidTransformd& X_AB) {
+  DRAKE_ASSERT(size < kBoxPairBatchSize);
+  half_size_a.row(size) = half_size_a_in.transpose();
+  half_size_b.row(size) = half_size_b_in.transpose();
+  p_AB.row(size) = X_AB.translation().transpose();
+  // The rotation matrix is stored in column-major order, which is the order of
+  // the columns of R_AB.
+  R_AB.row(size) =
+      Eigen::Map<const Eigen::Matrix<double, 1, 9>>(
+          X_AB.rotation().matrix().data())
+          .array();
+  ++size;
+}
+
+int BoxesOverlap(const BoxPairBatch& batch) {
+  using Lanes = Eigen::Array<double, kBoxPairBatchSize, 1>;
+  using LaneMask = Eigen::Array<bool, kBoxPairBatchSize, 1>;
+  DRAKE_ASSERT(batch.size <= kBoxPairBatchSize);
+
+  // This mirrors the single-pair BoxesOverlap() above, computing each
+  // separating axis test for all of the pairs at once. Unused lanes hold zeros
+  // or a pair from before the last clear(), so their arithmetic is on finite
+  // values; their results are never inspected.
+  const auto& a = batch.half_size_a;
+  const auto& b = batch.half_size_b;
+  const auto& t = batch.p_AB;
+  const auto r = [&batch](int i, int j) {
+    return batch.R_AB.col(i + 3 * j);
+  };
+  const double kEpsilon = 0.000001;
+  Eigen::Array<double, kBoxPairBatchSize, 9> abs_r_storage =
+      batch.R_AB.abs() + kEpsilon;
+  const auto abs_r = [&abs_r_storage](int i, int j) {
+    return abs_r_storage.col(i + 3 * j);
+  };
+  const auto to_mask = [&batch](const LaneMask& separated) {
+    int mask = 0;
+    for (int k = 0; k < batch.size; ++k) {
+      mask |= separated[k] ? 0 : (1 << k);
+    }
+    return mask;
+  };
+
+  // First category of cases separating along a's axes.
+  LaneMask separated = LaneMask::Constant(false);
+  for (int i = 0; i < 3; ++i) {
+    const Lanes extent = a.col(i) + b.col(0) * abs_r(i, 0) +
+                         b.col(1) * abs_r(i, 1) + b.col(2) * abs_r(i, 2);
+    separated = separated || (t.col(i).abs() > extent);
+  }
+
+  // Second category of cases separating along b's axes.
+  for (int i = 0; i < 3; ++i) {
+    const Lanes projection =
+        t.col(0) * r(0, i) + t.col(1) * r(1, i) + t.col(2) * r(2, i);
+    const Lanes extent = b.col(i) + a.col(0) * abs_r(0, i) +
+                         a.col(1) * abs_r(1, i) + a.col(2) * abs_r(2, i);
+    separated = separated || (projection.abs() > extent);
+  }
+  if (to_mask(separated) == 0) return 0;
+
+  // Third category of cases separating along the axes formed from the cross
+  // products of a's and b's axes.
+  int i1 = 1;
+  for (int i = 0; i < 3; ++i) {
+    const int i2 = (i1 + 1) % 3;
+    int j1 = 1;
+    for (int j = 0; j < 3; ++j) {
+      const int j2 = (j1 + 1) % 3;
+      const Lanes projection = t.col(i2) * r(i1, j) - t.col(i1) * r(i2, j);
+      const Lanes extent = a.col(i1) * abs_r(i2, j) + a.col(i2) * abs_r(i1, j) +
+                           b.col(j1) * abs_r(i, j2) + b.col(j2) * abs_r(i, j1);
+      separated = separated || (projection.abs() > extent);
+      j1 = j2;
+    }
+    i1 = i2;
+  }
+
+  return to_mask(separated);
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -21,6 +21,42 @@ bool BoxesOverlap(const Vector3<double>& half_size_a,
                   const Vector3<double>& half_size_b,
                   const math::RigidTransformd& X_AB);
 
+/* The inputs to BoxesOverlap() for up to kBoxPairBatchSize pairs of boxes at
+ once, stored as a "structure of arrays" so that the pairs can be tested in
+ parallel SIMD lanes: row k of each array belongs to the k'th pair. */
+constexpr int kBoxPairBatchSize = 4;
+struct BoxPairBatch {
+  /* Clears the batch. */
+  void clear() { size = 0; }
+
+  /* Appends a pair of boxes to the batch, with the same meaning as the
+   parameters of BoxesOverlap().
+   @pre size < kBoxPairBatchSize. */
+  void Add(const Vector3<double>& half_size_a_in,
+           const Vector3<double>& half_size_b_in,
+           const math::RigidTransformd& X_AB);
+
+  int size{0};
+  // All lanes start zeroed, so that the lanes past `size` never hold
+  // uninitialized memory (which could be NaN or denormal and slow down the
+  // arithmetic on the whole batch).
+  Eigen::Array<double, kBoxPairBatchSize, 3> half_size_a{
+      Eigen::Array<double, kBoxPairBatchSize, 3>::Zero()};
+  Eigen::Array<double, kBoxPairBatchSize, 3> half_size_b{
+      Eigen::Array<double, kBoxPairBatchSize, 3>::Zero()};
+  // Column i is the i'th component of p_AB.
+  Eigen::Array<double, kBoxPairBatchSize, 3> p_AB{
+      Eigen::Array<double, kBoxPairBatchSize, 3>::Zero()};
+  // Column i + 3j is the (i, j) entry of R_AB.
+  Eigen::Array<double, kBoxPairBatchSize, 9> R_AB{
+      Eigen::Array<double, kBoxPairBatchSize, 9>::Zero()};
+};
+
+/* Batched form of BoxesOverlap(), performing the same separating axis tests on
+ every pair in `batch`. Returns a bit mask whose k'th bit is set iff the k'th
+ pair of boxes overlaps. */
+int BoxesOverlap(const BoxPairBatch& batch);
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
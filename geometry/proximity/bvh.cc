@@ -1,8 +1,8 @@
 #include "drake/geometry/proximity/bvh.h"
 
 #include <algorithm>
-#include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "drake/geometry/utilities.h"
@@ -25,16 +25,20 @@ Bvh<BvType, SourceMeshType>::Bvh(const SourceMeshType& mesh) {
     element_centroids.emplace_back(i, ComputeCentroid(mesh, i));
   }
 
-  root_node_ =
-      BuildBvTree(mesh, element_centroids.begin(), element_centroids.end());
+  // A binary tree whose leaves each hold at least one element has fewer than
+  // twice as many nodes as elements.
+  nodes_.reserve(2 * std::max(num_elements, 1));
+  BuildBvTree(mesh, element_centroids.begin(), element_centroids.end(),
+              &nodes_);
+  nodes_.shrink_to_fit();
 }
 
 template <class BvType, class SourceMeshType>
-std::unique_ptr<BvNode<BvType, SourceMeshType>>
-Bvh<BvType, SourceMeshType>::BuildBvTree(
+void Bvh<BvType, SourceMeshType>::BuildBvTree(
     const SourceMeshType& mesh_M,
     const typename std::vector<CentroidPair>::iterator& start,
-    const typename std::vector<CentroidPair>::iterator& end) {
+    const typename std::vector<CentroidPair>::iterator& end,
+    std::vector<NodeType>* nodes) {
   // Generate bounding volume.
   BvType bv_M = ComputeBoundingVolume(mesh_M, start, end);
 
@@ -45,7 +49,7 @@ Bvh<BvType, SourceMeshType>::BuildBvTree(
       data.indices[i] = (start + i)->first;
     }
     // Store element indices in this leaf node.
-    return std::make_unique<NodeType>(bv_M, data);
+    nodes->emplace_back(std::move(bv_M), data);
   } else {
     // Sort the elements by centroid along the axis of greatest spread.
     // Note: We tried an alternative strategy for building the BVH using a
@@ -95,11 +99,16 @@ Bvh<BvType, SourceMeshType>::BuildBvTree(
                 return Baxis_M.dot(a.second) < Baxis_M.dot(b.second);
               });
 
-    // Continue with the next branches.
+    // Continue with the next branches. The left subtree immediately follows
+    // this node; once it's built, we know where the right one starts.
     const typename std::vector<CentroidPair>::iterator mid =
         start + num_elements / 2;
-    return std::make_unique<NodeType>(bv_M, BuildBvTree(mesh_M, start, mid),
-                                      BuildBvTree(mesh_M, mid, end));
+    const int index = nodes->size();
+    nodes->emplace_back(bv_M, 2 /* placeholder right_offset */);
+    BuildBvTree(mesh_M, start, mid, nodes);
+    const int right_offset = static_cast<int>(nodes->size()) - index;
+    (*nodes)[index] = NodeType(std::move(bv_M), right_offset);
+    BuildBvTree(mesh_M, mid, end, nodes);
   }
 }
 
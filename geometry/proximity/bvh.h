@@ -1,17 +1,19 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
-#include <memory>
+#include <optional>
 #include <stack>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/proximity/aabb.h"
+#include "drake/geometry/proximity/boxes_overlap.h"
 #include "drake/geometry/proximity/obb.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 #include "drake/geometry/proximity/volume_mesh.h"
@@ -60,15 +62,20 @@ class BvNode {
   BvNode(BvType bv, LeafData data)
       : bv_(std::move(bv)), child_(std::move(data)) {}
 
-  /* Constructor for branch/internal nodes.
+  /* Constructor for branch/internal nodes. Branch nodes don't own their
+   children; instead, all of a Bvh's nodes are stored in a single array in
+   depth-first order, so that a branch's left child immediately follows it and
+   its right child follows the whole left subtree. Therefore, branch nodes are
+   only meaningful as elements of such an array.
    @param bv The bounding volume encompassing the elements in child branches.
-   @param left Unique pointer to the left child branch.
-   @param right Unique pointer to the right child branch.
-   @pre Both children must be distinct and not null.   */
-  BvNode(BvType bv, std::unique_ptr<BvNode<BvType, MeshType>> left,
-         std::unique_ptr<BvNode<BvType, MeshType>> right)
-      : bv_(std::move(bv)),
-        child_(NodeChildren(std::move(left), std::move(right))) {}
+   @param right_offset The distance from this node to its right child in the
+                       node array (i.e., the size of the left subtree plus
+                       one).
+   @pre right_offset >= 2.   */
+  BvNode(BvType bv, int right_offset)
+      : bv_(std::move(bv)), child_(NodeChildren{right_offset}) {
+    DRAKE_DEMAND(right_offset >= 2);
+  }
 
   /* Returns the bounding volume.  */
   const BvType& bv() const { return bv_; }
@@ -90,13 +97,14 @@ class BvNode {
   /* Returns the left child branch.
    @pre is_leaf() returns false.  */
   const BvNode<BvType, MeshType>& left() const {
-    return *(std::get<NodeChildren>(child_).left);
+    DRAKE_ASSERT(!is_leaf());
+    return *(this + 1);
   }
 
   /* Returns the right child branch.
    @pre is_leaf() returns false.  */
   const BvNode<BvType, MeshType>& right() const {
-    return *(std::get<NodeChildren>(child_).right);
+    return *(this + std::get<NodeChildren>(child_).right_offset);
   }
 
   /* Returns whether this is a leaf node as opposed to a branch node.  */
@@ -135,37 +143,27 @@ class BvNode {
 
   /* Provide disciplined access to BvhUpdater to a mutable child node. */
   BvNode<BvType, MeshType>& left() {
-    return *(std::get<NodeChildren>(child_).left);
+    DRAKE_ASSERT(!is_leaf());
+    return *(this + 1);
   }
 
   /* Provide disciplined access to BvhUpdater to a mutable child node. */
   BvNode<BvType, MeshType>& right() {
-    return *(std::get<NodeChildren>(child_).right);
+    return *(this + std::get<NodeChildren>(child_).right_offset);
   }
 
   /* Provide disciplined access to BvhUpdater to a mutable bounding volume. */
   BvType& bv() { return bv_; }
 
   struct NodeChildren {
-    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(NodeChildren)
-
-    NodeChildren(std::unique_ptr<BvNode> left_in,
-                 std::unique_ptr<BvNode> right_in)
-        : left(std::move(left_in)), right(std::move(right_in)) {
-      DRAKE_DEMAND(left != nullptr);
-      DRAKE_DEMAND(right != nullptr);
-      DRAKE_DEMAND(left != right);
-    }
-
-    copyable_unique_ptr<BvNode> left;
-    copyable_unique_ptr<BvNode> right;
+    int right_offset{};
   };
 
   BvType bv_;
 
   // If this is a leaf node then the child refers to indices into the mesh's
   // elements (i.e., triangles or tetrahedra) bounded by the node's bounding
-  // volume. Otherwise, it refers to child nodes further down the tree.
+  // volume. Otherwise, it locates the child nodes further down the tree.
   std::variant<LeafData, NodeChildren> child_;
 };
 
@@ -183,6 +181,56 @@ enum BvttCallbackResult {
  the elements of the *second* mesh. */
 using BvttCallback = std::function<BvttCallbackResult(int, int)>;
 
+/* The "front" of a bounding volume tree traversal (BVTT) of two hierarchies:
+ the node pairs at which the most recent traversal stopped descending, either
+ because their bounding volumes were disjoint or because both nodes were
+ leaves. Every path from the root pair to a pair of leaves passes through
+ exactly one pair of the front.
+
+ Between consecutive queries of two moving geometries the front barely changes,
+ so a traversal can start from the previous front instead of from the roots
+ (see Bvh::Collide()), skipping the overlap tests of all of the front's
+ ancestors. A front is opaque to its users; it only remembers what it needs to
+ decide whether it can be reused for the next query.  */
+class BvttFront {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BvttFront)
+
+  BvttFront() = default;
+
+  /* Reports the number of node pairs in the front; zero if no traversal has
+   been recorded (or the last one was abandoned).  */
+  int size() const { return static_cast<int>(node_pairs_.size()); }
+
+  /* Forgets the recorded traversal, so the next one starts from the roots.  */
+  void clear() {
+    node_pairs_.clear();
+    num_overlapping_leaf_pairs_ = 0;
+  }
+
+ private:
+  template <class, class> friend class Bvh;
+
+  // The indices of the two nodes of each pair in their hierarchy's node array,
+  // in the order in which a depth-first traversal from the roots visits them.
+  std::vector<std::pair<int, int>> node_pairs_;
+
+  // The sizes of the hierarchies the front was recorded for; a front never
+  // applies to a differently-sized pair of hierarchies.
+  int num_nodes_a_{};
+  int num_nodes_b_{};
+
+  // The relative pose of the hierarchies when the front was recorded.
+  math::RigidTransformd X_AB_;
+
+  // The number of pairs of the front whose nodes are overlapping leaves.
+  int num_overlapping_leaf_pairs_{};
+
+  // The number of bounding volume overlap tests performed by the last
+  // traversal that started from the roots.
+  int full_traversal_cost_{};
+};
+
 /* %Bvh is an acceleration structure for performing spatial queries against a
  collection of objects (in this case, triangles or tetrahedra). Specifically,
  for identifying those objects in or near a particular region of interest. It
@@ -192,7 +240,8 @@ using BvttCallback = std::function<BvttCallbackResult(int, int)>;
  mesh elements. The bounding volumes are all measured and expressed in this
  hierarchy's frame H. Leaf nodes contain element indices into elements of the
  mesh. The BVH needs a reference to the mesh in order to build the tree, but
- does not own the mesh.
+ does not own the mesh. The tree's nodes are stored contiguously in
+ depth-first order, so traversals don't chase pointers across the heap.
  @pre    The mesh is not mutable. Modifications to the mesh after
          constructing the BVH will make the BVH invalid.
  @tparam BvType           The bounding volume type (e.g., Aabb, Obb).
@@ -208,7 +257,7 @@ class Bvh {
 
   explicit Bvh(const MeshType& mesh);
 
-  const NodeType& root_node() const { return *root_node_; }
+  const NodeType& root_node() const { return nodes_.front(); }
 
   /* Perform a query of this %Bvh's mesh elements (measured and expressed in
    Frame A) against the given %Bvh's mesh elements (measured and expressed in
@@ -224,45 +273,94 @@ class Bvh {
   void Collide(
       const OtherBvhType& bvh_B, const math::RigidTransformd& X_AB,
       BvttCallback callback) const {
-    using NodePair =
-        std::pair<const NodeType&, const typename OtherBvhType::NodeType&>;
-    std::stack<NodePair, std::vector<NodePair>> node_pairs;
-    node_pairs.emplace(root_node(), bvh_B.root_node());
+    using OtherNodeType = typename OtherBvhType::NodeType;
+    using NodePair = std::pair<const NodeType*, const OtherNodeType*>;
 
-    while (!node_pairs.empty()) {
-      const auto& [node_a, node_b] = node_pairs.top();
-      node_pairs.pop();
+    if (!BvType::HasOverlap(root_node().bv(), bvh_B.root_node().bv(), X_AB)) {
+      return;
+    }
+    Traverse(bvh_B, NodePair{&root_node(), &bvh_B.root_node()}, X_AB, callback,
+             nullptr);
+  }
 
-      // Check if the bounding volumes overlap.
-      if (!BvType::HasOverlap(node_a.bv(), node_b.bv(), X_AB)) {
-        continue;
-      }
+  /* Variant of Collide() that exploits temporal coherence: the traversal
+   starts from the `front` recorded by the previous query of the same two
+   hierarchies (rather than from their roots) and records its own front in its
+   place. The callback is invoked on the same element pairs, in the same order,
+   as by the Collide() above, possibly along with some additional pairs whose
+   bounding volumes overlap but whose ancestors' do not. Since bounding volumes
+   contain their elements, those additional pairs are always disjoint.
+
+   The traversal starts from the roots instead (as if `front` were empty)
+   whenever the front is unlikely to pay off: if it was recorded for different
+   hierarchies, if the relative pose changed by a large fraction of the
+   hierarchies' extents since it was recorded, if it reached no overlapping
+   leaves, or if it has grown to require more overlap tests than a traversal
+   from the roots did. If the callback terminates the traversal early, the
+   front is cleared.
 
-      // Run the callback on the pair if they are both leaf nodes, otherwise
-      // check each branch.
-      if (node_a.is_leaf() && node_b.is_leaf()) {
-        const int num_a_elements = node_a.num_element_indices();
-        const int num_b_elements = node_b.num_element_indices();
-        for (int a = 0; a < num_a_elements; ++a) {
-          for (int b = 0; b < num_b_elements; ++b) {
-            const BvttCallbackResult result =
-                callback(node_a.element_index(a), node_b.element_index(b));
-            if (result == BvttCallbackResult::Terminate) return;
-          }
+   @param bvh_B           The bounding volume hierarchy to collide with.
+   @param X_AB            The relative pose of the two hierarchies.
+   @param callback        The callback to invoke on each unculled pair.
+   @param front           The front of the previous query of this hierarchy
+                          against `bvh_B` (empty for the first), which is
+                          replaced by this query's front. If nullptr, this is
+                          the same as Collide() without a front.
+   @tparam OtherBvhType   The type of Bvh to collide against this.
+   @pre A non-empty `front` was recorded for these two hierarchies (fronts of
+        differently-sized hierarchies are detected and ignored, but not those
+        of other hierarchies of the same sizes).  */
+  template <class OtherBvhType>
+  void Collide(
+      const OtherBvhType& bvh_B, const math::RigidTransformd& X_AB,
+      BvttCallback callback, BvttFront* front) const {
+    if (front == nullptr) {
+      Collide(bvh_B, X_AB, std::move(callback));
+      return;
+    }
+    using OtherNodeType = typename OtherBvhType::NodeType;
+    using NodePair = std::pair<const NodeType*, const OtherNodeType*>;
+
+    const bool resume = CanResume(bvh_B, X_AB, *front);
+    std::vector<std::pair<int, int>> previous_pairs;
+    if (resume) {
+      previous_pairs = std::move(front->node_pairs_);
+    } else {
+      previous_pairs.emplace_back(0, 0);
+    }
+    front->clear();
+    front->num_nodes_a_ = static_cast<int>(nodes_.size());
+    front->num_nodes_b_ = static_cast<int>(bvh_B.nodes_.size());
+    front->X_AB_ = X_AB;
+
+    // Test the pairs of the previous front in batches; pairs that still don't
+    // overlap remain in the front, the others are traversed further.
+    int cost = 0;
+    const int num_previous = static_cast<int>(previous_pairs.size());
+    std::array<NodePair, kBoxPairBatchSize> batch;
+    for (int i = 0; i < num_previous; i += kBoxPairBatchSize) {
+      const int num_pairs = std::min(kBoxPairBatchSize, num_previous - i);
+      for (int k = 0; k < num_pairs; ++k) {
+        const auto [index_a, index_b] = previous_pairs[i + k];
+        batch[k] = {&nodes_[index_a], &bvh_B.nodes_[index_b]};
+      }
+      const int overlaps = TestOverlaps(batch, num_pairs, X_AB);
+      cost += num_pairs;
+      for (int k = 0; k < num_pairs; ++k) {
+        if (!(overlaps & (1 << k))) {
+          front->node_pairs_.push_back(previous_pairs[i + k]);
+          continue;
         }
-      } else if (node_b.is_leaf()) {
-        node_pairs.emplace(node_a.left(), node_b);
-        node_pairs.emplace(node_a.right(), node_b);
-      } else if (node_a.is_leaf()) {
-        node_pairs.emplace(node_a, node_b.left());
-        node_pairs.emplace(node_a, node_b.right());
-      } else {
-        node_pairs.emplace(node_a.left(), node_b.left());
-        node_pairs.emplace(node_a.right(), node_b.left());
-        node_pairs.emplace(node_a.left(), node_b.right());
-        node_pairs.emplace(node_a.right(), node_b.right());
+        const std::optional<int> subtree_cost =
+            Traverse(bvh_B, batch[k], X_AB, callback, front);
+        if (!subtree_cost.has_value()) {
+          front->clear();
+          return;
+        }
+        cost += *subtree_cost;
       }
     }
+    if (!resume) front->full_traversal_cost_ = cost;
   }
 
   /* Culls the nodes of the BVH based on the nodes' bounding volumes'
@@ -345,14 +443,168 @@ class Bvh {
 
   template <typename> friend class BvhUpdater;
 
-  NodeType& mutable_root_node() { return *root_node_; }
+  template <class, class> friend class Bvh;
+
+  NodeType& mutable_root_node() { return nodes_.front(); }
+
+  /* A front is only reused while the relative motion of the hierarchies since
+   it was recorded is bounded by this fraction of the smaller root bounding
+   volume's radius.  */
+  static constexpr double kMaxFrontMotion = 0.1;
+
+  /* Traverses the BVTT below the given pair of nodes of this hierarchy and
+   `bvh_B`, whose bounding volumes must overlap, and invokes the callback on
+   every unculled pair of elements. If `front` is non-null, the pairs at which
+   the traversal stops are appended to it in depth-first order. Returns the
+   number of overlap tests performed, or nullopt if the callback terminated the
+   traversal.  */
+  template <class OtherBvhType, class NodePair>
+  std::optional<int> Traverse(const OtherBvhType& bvh_B, const NodePair& start,
+                              const math::RigidTransformd& X_AB,
+                              const BvttCallback& callback,
+                              BvttFront* front) const {
+    // Every pair on the stack is paired with whether its bounding volumes
+    // overlap; the disjoint ones are only pushed (when recording a front) so
+    // that they join the front in depth-first order. When a pair is expanded,
+    // all of its (two or four) child pairs are tested together, which lets
+    // the overlap tests share work (see TestOverlaps()).
+    using StackEntry = std::pair<NodePair, bool>;
+    std::stack<StackEntry, std::vector<StackEntry>> node_pairs;
+    node_pairs.emplace(start, true);
+    std::array<NodePair, kBoxPairBatchSize> children;
+    int cost = 0;
+
+    while (!node_pairs.empty()) {
+      const auto [node_pair, overlapping] = node_pairs.top();
+      const auto [node_a, node_b] = node_pair;
+      node_pairs.pop();
+      const bool is_front =
+          !overlapping || (node_a->is_leaf() && node_b->is_leaf());
+      if (front != nullptr && is_front) {
+        front->node_pairs_.emplace_back(
+            static_cast<int>(node_a - nodes_.data()),
+            static_cast<int>(node_b - bvh_B.nodes_.data()));
+        if (overlapping) ++front->num_overlapping_leaf_pairs_;
+      }
+      if (!overlapping) continue;
+
+      // Run the callback on the pair if they are both leaf nodes, otherwise
+      // check each branch.
+      int num_children = 0;
+      if (node_a->is_leaf() && node_b->is_leaf()) {
+        const int num_a_elements = node_a->num_element_indices();
+        const int num_b_elements = node_b->num_element_indices();
+        for (int a = 0; a < num_a_elements; ++a) {
+          for (int b = 0; b < num_b_elements; ++b) {
+            const BvttCallbackResult result =
+                callback(node_a->element_index(a), node_b->element_index(b));
+            if (result == BvttCallbackResult::Terminate) return std::nullopt;
+          }
+        }
+        continue;
+      } else if (node_b->is_leaf()) {
+        children[num_children++] = {&node_a->left(), node_b};
+        children[num_children++] = {&node_a->right(), node_b};
+      } else if (node_a->is_leaf()) {
+        children[num_children++] = {node_a, &node_b->left()};
+        children[num_children++] = {node_a, &node_b->right()};
+      } else {
+        children[num_children++] = {&node_a->left(), &node_b->left()};
+        children[num_children++] = {&node_a->right(), &node_b->left()};
+        children[num_children++] = {&node_a->left(), &node_b->right()};
+        children[num_children++] = {&node_a->right(), &node_b->right()};
+      }
+      // N.B. Pushing the children in this order visits the pairs in the same
+      // order as testing each pair when it is popped would.
+      const int overlaps = TestOverlaps(children, num_children, X_AB);
+      cost += num_children;
+      for (int k = 0; k < num_children; ++k) {
+        const bool child_overlapping = overlaps & (1 << k);
+        if (child_overlapping || front != nullptr) {
+          node_pairs.emplace(children[k], child_overlapping);
+        }
+      }
+    }
+    return cost;
+  }
+
+  /* Reports whether the traversal of this hierarchy against `bvh_B` at the
+   relative pose X_AB should start from the given front (see Collide()).  */
+  template <class OtherBvhType>
+  bool CanResume(const OtherBvhType& bvh_B, const math::RigidTransformd& X_AB,
+                 const BvttFront& front) const {
+    if (front.node_pairs_.empty() || front.num_overlapping_leaf_pairs_ == 0 ||
+        front.num_nodes_a_ != static_cast<int>(nodes_.size()) ||
+        front.num_nodes_b_ != static_cast<int>(bvh_B.nodes_.size()) ||
+        front.size() > front.full_traversal_cost_) {
+      return false;
+    }
+    // Bound how far any point of B's root bounding volume has moved relative
+    // to A since the front was recorded.
+    const auto& bv_B = bvh_B.root_node().bv();
+    const double radius_A = root_node().bv().half_width().norm();
+    const double radius_B = bv_B.half_width().norm();
+    const double distance =
+        (X_AB * bv_B.center() - front.X_AB_ * bv_B.center()).norm();
+    const double angle = front.X_AB_.rotation()
+                             .InvertAndCompose(X_AB.rotation())
+                             .ToAngleAxis()
+                             .angle();
+    return distance + angle * radius_B <=
+           kMaxFrontMotion * std::min(radius_A, radius_B);
+  }
+
+  /* Returns a bit mask whose k'th bit is set iff the bounding volumes of the
+   k'th of the first `num_pairs` node pairs overlap (with the pose X_AB as in
+   Collide()). For a pair of Obb hierarchies, this tests the pairs in a single
+   batch, so that they share the work of composing poses and their separating
+   axis tests run in parallel SIMD lanes. */
+  template <class NodePair>
+  static int TestOverlaps(
+      const std::array<NodePair, kBoxPairBatchSize>& node_pairs,
+      int num_pairs, const math::RigidTransformd& X_AB) {
+    using OtherBvType = std::remove_cv_t<
+        std::remove_reference_t<decltype(node_pairs[0].second->bv())>>;
+    int overlaps = 0;
+    if constexpr (std::is_same_v<BvType, Obb> &&
+                  std::is_same_v<OtherBvType, Obb>) {
+      // The box of a node from this hierarchy has canonical frame Ba, posed in
+      // hierarchy frame A, and similarly for Bb and B.
+      BoxPairBatch batch;
+      typename NodePair::second_type last_b{};
+      math::RigidTransformd X_ABb;
+      for (int k = 0; k < num_pairs; ++k) {
+        const auto& [node_a, node_b] = node_pairs[k];
+        if (node_b != last_b) {
+          X_ABb = X_AB * node_b->bv().pose();
+          last_b = node_b;
+        }
+        const math::RigidTransformd X_BaBb =
+            node_a->bv().pose().InvertAndCompose(X_ABb);
+        batch.Add(node_a->bv().half_width(), node_b->bv().half_width(),
+                  X_BaBb);
+      }
+      overlaps = BoxesOverlap(batch);
+    } else {
+      for (int k = 0; k < num_pairs; ++k) {
+        const auto& [node_a, node_b] = node_pairs[k];
+        if (BvType::HasOverlap(node_a->bv(), node_b->bv(), X_AB)) {
+          overlaps |= 1 << k;
+        }
+      }
+    }
+    return overlaps;
+  }
 
   using CentroidPair = std::pair<int, Vector3<double>>;
 
-  static std::unique_ptr<NodeType> BuildBvTree(
+  // Appends the nodes of the subtree bounding the elements in [start, end)
+  // to `nodes`, in depth-first order.
+  static void BuildBvTree(
       const MeshType& mesh,
       const typename std::vector<CentroidPair>::iterator& start,
-      const typename std::vector<CentroidPair>::iterator& end);
+      const typename std::vector<CentroidPair>::iterator& end,
+      std::vector<NodeType>* nodes);
 
   static BvType ComputeBoundingVolume(
       const MeshType& mesh,
@@ -392,7 +644,9 @@ class Bvh {
 
   static constexpr int kElementVertexCount = MeshType::kVertexPerElement;
 
-  copyable_unique_ptr<NodeType> root_node_;
+  // All of the nodes of the tree, in depth-first order (see BvNode); the root
+  // is the first.
+  std::vector<NodeType> nodes_;
 };
 
 }  // namespace internal
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
+#include <common_robotics_utilities/openmp_helpers.hpp>
+
+#include "drake/common/ssize.h"
 #include "drake/geometry/proximity/aabb.h"
 #include "drake/geometry/proximity/bvh.h"
 
@@ -18,6 +22,19 @@ namespace internal {
  This will frequently be combined with a MeshDeformer so that when a mesh is
  updated, the corresponding Bvh can likewise be updated.
 
+ An update first refits every bounding volume to the deformed mesh, keeping the
+ hierarchy's topology. Refitting is cheap, but as the mesh deforms, sibling
+ volumes can come to overlap more and more, and the hierarchy culls less and
+ less. So the update then measures the quality of each branch node as the
+ total surface area of its children's volumes relative to its own. Wherever
+ that ratio has grown by more than a factor of kMaxQualityLoss since the
+ branch was (re)built, the branch's subtree is rebuilt from the current
+ positions of its elements; the rest of the hierarchy is left as refit.
+
+ Both steps are parallelized (with OpenMP) for large hierarchies: the refit
+ proceeds level by level, from the leaves up, refitting the nodes of a level
+ concurrently; and distinct subtrees are rebuilt concurrently.
+
  This current incarnation only supports Bvhs constructed with axis-aligned
  bounding boxes.
 
@@ -33,6 +50,10 @@ class BvhUpdater {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BvhUpdater)
 
+  /* A branch whose quality ratio (see the class documentation) exceeds this
+   multiple of its value when the branch was built gets rebuilt. */
+  static constexpr double kMaxQualityLoss = 1.25;
+
   /* Constructs a %BvhUpdater for the given BVH and its corresponding mesh.
    Both the mesh and the bvh must remain alive at least as long as this
    updater.
@@ -46,6 +67,7 @@ class BvhUpdater {
       : mesh_(*mesh_M), bvh_(*bvh_M) {
     DRAKE_DEMAND(mesh_M != nullptr);
     DRAKE_DEMAND(bvh_M != nullptr);
+    AnalyzeTopology();
   }
 
   const MeshType& mesh() const { return mesh_; }
@@ -58,12 +80,52 @@ class BvhUpdater {
     const auto& vertices = GetMeshVertices(mesh_.vertices());
     if (vertices.size() == 0) return;
 
-    /* This implementation doesn't change the bvh topology; it simply passes
-     through each box in a bottom-up manner refitting the box to the data. */
-    UpdateRecursive(&bvh_.mutable_root_node(), vertices);
+    /* The bvh may have been assigned a different tree since the last update
+     (e.g., see DeformableVolumeMesh's assignment operators). */
+    if (static_cast<int>(bvh_.nodes_.size()) != num_nodes()) {
+      AnalyzeTopology();
+    }
+
+    /* Refit every box, one level at a time, so that all of a node's children
+     have been refit before it is. */
+    for (int level = 0; level + 1 < ssize(level_starts_); ++level) {
+      const int begin = level_starts_[level];
+      const int end = level_starts_[level + 1];
+      CRU_OMP_PARALLEL_FOR_IF(end - begin >= kMinParallelSize)
+      for (int k = begin; k < end; ++k) {
+        RefitNode(nodes_by_level_[k], vertices);
+      }
+    }
+
+    /* Find the topmost degraded branches and rebuild their subtrees. */
+    std::vector<int> degraded;
+    for (int i = 0; i < num_nodes();) {
+      if (!bvh_.nodes_[i].is_leaf() &&
+          CalcQualityRatio(i) > kMaxQualityLoss * built_quality_ratios_[i]) {
+        degraded.push_back(i);
+        i = subtree_ends_[i];
+      } else {
+        ++i;
+      }
+    }
+    const int num_degraded = ssize(degraded);
+    CRU_OMP_PARALLEL_FOR_IF(num_degraded > 1 &&
+                            num_nodes() >= kMinParallelSize)
+    for (int k = 0; k < num_degraded; ++k) {
+      RebuildSubtree(degraded[k], vertices);
+    }
   }
 
  private:
+  using BvhType = Bvh<Aabb, MeshType>;
+  using NodeType = typename BvhType::NodeType;
+
+  // Below this many nodes, refitting or rebuilding in parallel costs more than
+  // it saves.
+  static constexpr int kMinParallelSize = 1024;
+
+  int num_nodes() const { return ssize(subtree_ends_); }
+
   // If the mesh type is already double-valued, simply return the mesh vertices.
   static const std::vector<Vector3<double>>& GetMeshVertices(
       const std::vector<Vector3<double>>& vertices) {
@@ -81,41 +143,144 @@ class BvhUpdater {
     return vertices_dbl;
   }
 
-  // Helper function to perform a bottom-up refit.
-  void UpdateRecursive(typename Bvh<Aabb, MeshType>::NodeType* node,
-                       const std::vector<Vector3<double>>& vertices) {
+  // Computes the quantities that depend only on the bvh's topology: the
+  // extent of each node's subtree and the grouping of nodes into levels. Also
+  // records each branch's current quality ratio as its reference.
+  void AnalyzeTopology() {
+    const std::vector<NodeType>& nodes = bvh_.nodes_;
+    const int count = ssize(nodes);
+    // A node's children follow it in depth-first order, so visiting the nodes
+    // in reverse handles children before their parents.
+    subtree_ends_.resize(count);
+    std::vector<int> heights(count);
+    for (int i = count - 1; i >= 0; --i) {
+      if (nodes[i].is_leaf()) {
+        subtree_ends_[i] = i + 1;
+        heights[i] = 0;
+      } else {
+        const int right = right_index(i);
+        subtree_ends_[i] = subtree_ends_[right];
+        heights[i] = 1 + std::max(heights[i + 1], heights[right]);
+      }
+    }
+    // Group the nodes by height, leaves first (a counting sort).
+    const int num_levels = count > 0 ? heights[0] + 1 : 0;
+    level_starts_.assign(num_levels + 1, 0);
+    for (int i = 0; i < count; ++i) {
+      ++level_starts_[heights[i] + 1];
+    }
+    for (int level = 0; level < num_levels; ++level) {
+      level_starts_[level + 1] += level_starts_[level];
+    }
+    std::vector<int> next(level_starts_.begin(), level_starts_.end() - 1);
+    nodes_by_level_.resize(count);
+    for (int i = 0; i < count; ++i) {
+      nodes_by_level_[next[heights[i]]++] = i;
+    }
+    built_quality_ratios_.resize(count);
+    for (int i = 0; i < count; ++i) {
+      built_quality_ratios_[i] = nodes[i].is_leaf() ? 0 : CalcQualityRatio(i);
+    }
+  }
+
+  // Returns the index of the right child of the branch node with index i.
+  int right_index(int i) const {
+    const NodeType& node = bvh_.nodes_[i];
+    return i + static_cast<int>(&node.right() - &node);
+  }
+
+  // Returns half the surface area of the given box.
+  static double CalcHalfArea(const Aabb& box) {
+    const Vector3<double>& h = box.half_width();
+    return h.x() * h.y() + h.y() * h.z() + h.z() * h.x();
+  }
+
+  // Returns the total surface area of branch i's children's boxes relative
+  // to its own box's. It ranges from about one, when the children split the
+  // branch cleanly, to two, when each child spans the whole branch.
+  double CalcQualityRatio(int i) const {
+    const NodeType& node = bvh_.nodes_[i];
+    const double area = CalcHalfArea(node.bv());
+    if (!(area > 0)) return 0;
+    return (CalcHalfArea(node.left().bv()) + CalcHalfArea(node.right().bv())) /
+           area;
+  }
+
+  // Refits node i's box to its elements (for a leaf) or to its children's
+  // boxes (for a branch, whose children must have been refit already).
+  void RefitNode(int i, const std::vector<Vector3<double>>& vertices) {
+    NodeType& node = bvh_.nodes_[i];
     /* Intentionally uninitialized. */
     Eigen::Vector3d lower, upper;
     constexpr int kElementVertexCount = MeshType::kVertexPerElement;
     constexpr double kInf = std::numeric_limits<double>::infinity();
-    if (node->is_leaf()) {
+    if (node.is_leaf()) {
       // TODO(SeanCurtis-TRI): This is the limiting factor on supporting Obb.
       //  This functionality needs to be a function of the bounding volume type
       //  and not encoded in this class.
       lower << kInf, kInf, kInf;
       upper = -lower;
-      const int num_elements = node->num_element_indices();
+      const int num_elements = node.num_element_indices();
       for (int e = 0; e < num_elements; ++e) {
-        const auto& element = mesh_.element(node->element_index(e));
-        for (int i = 0; i < kElementVertexCount; ++i) {
-          const Eigen::Vector3d& p_MV =
-              convert_to_double(vertices[element.vertex(i)]);
+        const auto& element = mesh_.element(node.element_index(e));
+        for (int v = 0; v < kElementVertexCount; ++v) {
+          const Eigen::Vector3d& p_MV = vertices[element.vertex(v)];
           lower = lower.cwiseMin(p_MV);
           upper = upper.cwiseMax(p_MV);
         }
       }
     } else {
-      UpdateRecursive(&node->left(), vertices);
-      UpdateRecursive(&node->right(), vertices);
       // Update box on child boxes.
-      lower = node->left().bv().lower().cwiseMin(node->right().bv().lower());
-      upper = node->left().bv().upper().cwiseMax(node->right().bv().upper());
+      lower = node.left().bv().lower().cwiseMin(node.right().bv().lower());
+      upper = node.left().bv().upper().cwiseMax(node.right().bv().upper());
+    }
+    node.bv().set_bounds(lower, upper);
+  }
+
+  // Rebuilds the subtree rooted at node i from the current positions of its
+  // elements, in place. Bvh's median split makes the shape of a subtree
+  // depend only on its number of elements, so the rebuilt subtree occupies
+  // exactly the same nodes, and the levels and subtree extents still hold.
+  void RebuildSubtree(int i, const std::vector<Vector3<double>>& vertices) {
+    const int end = subtree_ends_[i];
+    std::vector<typename BvhType::CentroidPair> centroids;
+    for (int j = i; j < end; ++j) {
+      const NodeType& node = bvh_.nodes_[j];
+      if (!node.is_leaf()) continue;
+      for (int k = 0; k < node.num_element_indices(); ++k) {
+        const int e = node.element_index(k);
+        centroids.emplace_back(e, BvhType::ComputeCentroid(mesh_, e));
+      }
+    }
+    std::vector<NodeType> subtree;
+    subtree.reserve(end - i);
+    BvhType::BuildBvTree(mesh_, centroids.begin(), centroids.end(), &subtree);
+    DRAKE_DEMAND(ssize(subtree) == end - i);
+    std::copy(subtree.begin(), subtree.end(), bvh_.nodes_.begin() + i);
+    // Fit the boxes the same way Update() does, and take the new topology's
+    // quality as its reference.
+    for (int j = end - 1; j >= i; --j) {
+      RefitNode(j, vertices);
+      if (!bvh_.nodes_[j].is_leaf()) {
+        built_quality_ratios_[j] = CalcQualityRatio(j);
+      }
     }
-    node->bv().set_bounds(lower, upper);
   }
 
   const MeshType& mesh_;
   Bvh<Aabb, MeshType>& bvh_;
+
+  // For each node, the index one past the last node of its subtree.
+  std::vector<int> subtree_ends_;
+
+  // The node indices, grouped by height above the leaves; the nodes of level
+  // `l` are nodes_by_level_[level_starts_[l]] to
+  // nodes_by_level_[level_starts_[l + 1] - 1].
+  std::vector<int> nodes_by_level_;
+  std::vector<int> level_starts_;
+
+  // For each branch node, its quality ratio when it was last (re)built.
+  std::vector<double> built_quality_ratios_;
 };
 
 }  // namespace internal
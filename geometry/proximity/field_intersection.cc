@@ -75,26 +75,26 @@ bool CalcEquilibriumPlane(int element0,
 }
 
 template <typename T>
-std::vector<Vector3<T>> IntersectTetrahedra(
+void IntersectTetrahedra(
     int element0, const VolumeMesh<double>& mesh0_M,
     int element1, const VolumeMesh<double>& mesh1_N,
-    const math::RigidTransform<T>& X_MN, const Plane<T>& equilibrium_plane_M) {
-  // TODO(DamrongGuoy): Refactor this buffer from being a function-local
-  //  variable to a class member variable to reduce heap allocations. Then,
-  //  return the const reference. I cannot make them static function-local
-  //  because it will create race condition in multithreading environment.
-
-  // We use two alternating buffers to reduce heap allocations.
-  std::vector<Vector3<T>> polygon_buffer[2];
+    const math::RigidTransform<T>& X_MN, const Plane<T>& equilibrium_plane_M,
+    std::vector<Vector3<T>>* polygon_M, std::vector<Vector3<T>>* scratch_M) {
+  DRAKE_DEMAND(polygon_M != nullptr);
+  DRAKE_DEMAND(scratch_M != nullptr);
+  // The clipping alternates between the two buffers; they are owned by the
+  // caller so that their capacity is reused across many pairs of tetrahedra.
 
   // Intersects the equilibrium plane with the tetrahedron element0.
-  std::vector<Vector3<T>>* polygon_M = &(polygon_buffer[0]);
+  polygon_M->clear();
   SliceTetrahedronWithPlane(element0, mesh0_M, equilibrium_plane_M,
                             polygon_M);
   RemoveNearlyDuplicateVertices(polygon_M);
   // Null polygon
-  if (polygon_M->size() < 3)
-    return {};
+  if (polygon_M->size() < 3) {
+    polygon_M->clear();
+    return;
+  }
 
   // Positions of vertices of tetrahedral element1 in mesh1_N expressed in
   // frame M.
@@ -107,10 +107,11 @@ std::vector<Vector3<T>> IntersectTetrahedra(
   // vector points outward from the tetrahedron.
   constexpr int kFaceVertexLocalIndex[4][3] = {
       {1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
-  std::vector<Vector3<T>>* in_M = polygon_M;
-  std::vector<Vector3<T>>* out_M = &(polygon_buffer[1]);
   // Intersects the polygon with the four halfspaces of the four triangles
-  // of the tetrahedral element1.
+  // of the tetrahedral element1. There is an even number of halfspaces, so
+  // the final result lands back in polygon_M.
+  std::vector<Vector3<T>>* in_M = polygon_M;
+  std::vector<Vector3<T>>* out_M = scratch_M;
   for (const auto& face_vertices : kFaceVertexLocalIndex) {
     const Vector3<T>& p_MA = p_MVs[face_vertices[0]];
     const Vector3<T>& p_MB = p_MVs[face_vertices[1]];
@@ -121,13 +122,12 @@ std::vector<Vector3<T>> IntersectTetrahedra(
     ClipPolygonByHalfSpace(*in_M, half_space_M, out_M);
     RemoveNearlyDuplicateVertices(out_M);
     if (out_M->size() < 3) {
-      return {};  // Empty intersection; no contact here.
+      polygon_M->clear();
+      return;  // Empty intersection; no contact here.
     }
     std::swap(in_M, out_M);
   }
-  polygon_M = in_M;
-
-  return *polygon_M;
+  DRAKE_ASSERT(in_M == polygon_M);
 }
 
 template <typename T>
@@ -157,7 +157,7 @@ void IntersectFields(const VolumeMeshFieldLinear<double, double>& field0_M,
                      std::unique_ptr<MeshType>* surface_01_M,
                      std::unique_ptr<FieldType>* e_01_M,
                      std::vector<Vector3<T>>* grad_e0_Ms,
-                     std::vector<Vector3<T>>* grad_e1_Ms) {
+                     std::vector<Vector3<T>>* grad_e1_Ms, BvttFront* front) {
   DRAKE_DEMAND(surface_01_M != nullptr);
   DRAKE_DEMAND(e_01_M != nullptr);
   DRAKE_DEMAND(grad_e0_Ms != nullptr);
@@ -173,7 +173,7 @@ void IntersectFields(const VolumeMeshFieldLinear<double, double>& field0_M,
     candidate_tetrahedra.emplace_back(tet0, tet1);
     return BvttCallbackResult::Continue;
   };
-  bvh0_M.Collide(bvh1_N, convert_to_double(X_MN), callback);
+  bvh0_M.Collide(bvh1_N, convert_to_double(X_MN), callback, front);
 
   MeshBuilder builder;
   std::vector<SurfaceTriangle> surface_faces;
@@ -187,6 +187,12 @@ void IntersectFields(const VolumeMeshFieldLinear<double, double>& field0_M,
   // vertices. That convex polygon intersects a tetrahedron into at most four
   // more vertices.
   contact_polygon.reserve(8);
+  // Scratch for the intersection of each pair of tetrahedra, reused by all of
+  // them.
+  std::vector<Vector3<T>> polygon_vertices_M;
+  std::vector<Vector3<T>> polygon_scratch_M;
+  polygon_vertices_M.reserve(8);
+  polygon_scratch_M.reserve(8);
   const math::RotationMatrix<T> R_NM = X_MN.rotation().inverse();
   for (const auto& [tet0, tet1] : candidate_tetrahedra) {
     // Initialize the plane with a non-zero-length normal vector
@@ -205,24 +211,23 @@ void IntersectFields(const VolumeMeshFieldLinear<double, double>& field0_M,
                                             field1_N)) {
       continue;
     }
-    const std::vector<Vector3<T>>& polygon_vertices_M =
-        IntersectTetrahedra(tet0, field0_M.mesh(), tet1, field1_N.mesh(), X_MN,
-                            equilibrium_plane_M);
+    IntersectTetrahedra(tet0, field0_M.mesh(), tet1, field1_N.mesh(), X_MN,
+                        equilibrium_plane_M, &polygon_vertices_M,
+                        &polygon_scratch_M);
 
     if (polygon_vertices_M.size() < 3)
       continue;
 
     // Add the vertices to the builder (with corresponding pressure values)
     // and construct index-based polygon representation.
-    std::vector<int> polygon_vertex_indices;
-    polygon_vertex_indices.reserve(polygon_vertices_M.size());
+    contact_polygon.clear();
     for (const auto& p_MV : polygon_vertices_M) {
-      polygon_vertex_indices.push_back(
+      contact_polygon.push_back(
           builder.AddVertex(p_MV, field0_M.EvaluateCartesian(tet0, p_MV)));
     }
 
     const Vector3<T>& grad_field0_M = field0_M.EvaluateGradient(tet0);
-    const int num_new_faces = builder.AddPolygon(polygon_vertex_indices,
+    const int num_new_faces = builder.AddPolygon(contact_polygon,
                                                  polygon_nhat_M, grad_field0_M);
 
     const Vector3<T>& grad_field1_N = field1_N.EvaluateGradient(tet1);
@@ -246,7 +251,7 @@ std::unique_ptr<ContactSurface<T>> IntersectCompliantVolumes(
     const math::RigidTransform<T>& X_WF,
     GeometryId id1, const VolumeMeshFieldLinear<double, double>& field1_G,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_G,
-    const math::RigidTransform<T>& X_WG) {
+    const math::RigidTransform<T>& X_WG, BvttFront* front) {
   const math::RigidTransform<T> X_FG = X_WF.InvertAndCompose(X_WG);
 
   // The computation will be in Frame F and then transformed to the world frame.
@@ -256,7 +261,8 @@ std::unique_ptr<ContactSurface<T>> IntersectCompliantVolumes(
   std::vector<Vector3<T>> grad_field1_Fs;
   IntersectFields<MeshType, MeshBuilder>(field0_F, bvh0_F, field1_G, bvh1_G,
                                          X_FG, &surface01_F, &field01_F,
-                                         &grad_field0_Fs, &grad_field1_Fs);
+                                         &grad_field0_Fs, &grad_field1_Fs,
+                                         front);
 
   if (surface01_F == nullptr)
     return nullptr;
@@ -296,13 +302,13 @@ ComputeContactSurfaceFromCompliantVolumes(
     GeometryId id1, const VolumeMeshFieldLinear<double, double>& field1_G,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_G,
     const math::RigidTransform<T>& X_WG,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation, BvttFront* front) {
   if (representation == HydroelasticContactRepresentation::kTriangle) {
     return IntersectCompliantVolumes<TriangleSurfaceMesh<T>, TriMeshBuilder<T>>(
-        id0, field0_F, bvh0_F, X_WF, id1, field1_G, bvh1_G, X_WG);
+        id0, field0_F, bvh0_F, X_WF, id1, field1_G, bvh1_G, X_WG, front);
   } else {
     return IntersectCompliantVolumes<PolygonSurfaceMesh<T>, PolyMeshBuilder<T>>(
-        id0, field0_F, bvh0_F, X_WF, id1, field1_G, bvh1_G, X_WG);
+        id0, field0_F, bvh0_F, X_WF, id1, field1_G, bvh1_G, X_WG, front);
   }
 }
 
@@ -321,7 +327,7 @@ IntersectFields<TriangleSurfaceMesh<double>, TriMeshBuilder<double>>(
     std::unique_ptr<TriangleSurfaceMesh<double>>* surface_01_M,
     std::unique_ptr<TriangleSurfaceMeshFieldLinear<double, double>>* e_01_M,
     std::vector<Vector3<double>>* grad_e0_Ms,
-    std::vector<Vector3<double>>* grad_e1_Ms);
+    std::vector<Vector3<double>>* grad_e1_Ms, BvttFront* front);
 // Polygon, double
 template void
 IntersectFields<PolygonSurfaceMesh<double>, PolyMeshBuilder<double>>(
@@ -333,7 +339,7 @@ IntersectFields<PolygonSurfaceMesh<double>, PolyMeshBuilder<double>>(
     std::unique_ptr<PolygonSurfaceMesh<double>>* surface_01_M,
     std::unique_ptr<PolygonSurfaceMeshFieldLinear<double, double>>* e_01_M,
     std::vector<Vector3<double>>* grad_e0_Ms,
-    std::vector<Vector3<double>>* grad_e1_Ms);
+    std::vector<Vector3<double>>* grad_e1_Ms, BvttFront* front);
 // Triangle, AutoDiffXd
 template void
 IntersectFields<TriangleSurfaceMesh<AutoDiffXd>, TriMeshBuilder<AutoDiffXd>>(
@@ -346,7 +352,7 @@ IntersectFields<TriangleSurfaceMesh<AutoDiffXd>, TriMeshBuilder<AutoDiffXd>>(
     std::unique_ptr<TriangleSurfaceMeshFieldLinear<AutoDiffXd, AutoDiffXd>>*
         e_01_M,
     std::vector<Vector3<AutoDiffXd>>* grad_e0_Ms,
-    std::vector<Vector3<AutoDiffXd>>* grad_e1_Ms);
+    std::vector<Vector3<AutoDiffXd>>* grad_e1_Ms, BvttFront* front);
 // Polygon, AutoDiffXd
 template void
 IntersectFields<PolygonSurfaceMesh<AutoDiffXd>, PolyMeshBuilder<AutoDiffXd>>(
@@ -359,7 +365,7 @@ IntersectFields<PolygonSurfaceMesh<AutoDiffXd>, PolyMeshBuilder<AutoDiffXd>>(
     std::unique_ptr<PolygonSurfaceMeshFieldLinear<AutoDiffXd, AutoDiffXd>>*
         e_01_M,
     std::vector<Vector3<AutoDiffXd>>* grad_e0_Ms,
-    std::vector<Vector3<AutoDiffXd>>* grad_e1_Ms);
+    std::vector<Vector3<AutoDiffXd>>* grad_e1_Ms, BvttFront* front);
 
 // Triangle, double
 template std::unique_ptr<ContactSurface<double>>
@@ -369,7 +375,7 @@ IntersectCompliantVolumes<TriangleSurfaceMesh<double>, TriMeshBuilder<double>>(
     const math::RigidTransform<double>& X_WF, GeometryId id1,
     const VolumeMeshFieldLinear<double, double>& field1_G,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_G,
-    const math::RigidTransform<double>& X_WG);
+    const math::RigidTransform<double>& X_WG, BvttFront* front);
 // Polygon, double
 template std::unique_ptr<ContactSurface<double>>
 IntersectCompliantVolumes<PolygonSurfaceMesh<double>, PolyMeshBuilder<double>>(
@@ -378,7 +384,7 @@ IntersectCompliantVolumes<PolygonSurfaceMesh<double>, PolyMeshBuilder<double>>(
     const math::RigidTransform<double>& X_WF, GeometryId id1,
     const VolumeMeshFieldLinear<double, double>& field1_G,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_G,
-    const math::RigidTransform<double>& X_WG);
+    const math::RigidTransform<double>& X_WG, BvttFront* front);
 // Triangle, AutoDiffXd
 template std::unique_ptr<ContactSurface<AutoDiffXd>> IntersectCompliantVolumes<
     TriangleSurfaceMesh<AutoDiffXd>, TriMeshBuilder<AutoDiffXd>>(
@@ -387,7 +393,7 @@ template std::unique_ptr<ContactSurface<AutoDiffXd>> IntersectCompliantVolumes<
     const math::RigidTransform<AutoDiffXd>& X_WF, GeometryId id1,
     const VolumeMeshFieldLinear<double, double>& field1_G,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_G,
-    const math::RigidTransform<AutoDiffXd>& X_WG);
+    const math::RigidTransform<AutoDiffXd>& X_WG, BvttFront* front);
 // Polygon, AutoDiffXd
 template std::unique_ptr<ContactSurface<AutoDiffXd>> IntersectCompliantVolumes<
     PolygonSurfaceMesh<AutoDiffXd>, PolyMeshBuilder<AutoDiffXd>>(
@@ -396,7 +402,7 @@ template std::unique_ptr<ContactSurface<AutoDiffXd>> IntersectCompliantVolumes<
     const math::RigidTransform<AutoDiffXd>& X_WF, GeometryId id1,
     const VolumeMeshFieldLinear<double, double>& field1_G,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_G,
-    const math::RigidTransform<AutoDiffXd>& X_WG);
+    const math::RigidTransform<AutoDiffXd>& X_WG, BvttFront* front);
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS((
   &CalcEquilibriumPlane<T>,
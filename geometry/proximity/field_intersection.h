@@ -64,19 +64,24 @@ bool CalcEquilibriumPlane(int element0,
  @param[in] X_MN      Pose of frame N in frame M.
  @param[in] plane_M   The plane between the two tetrahedra, expressed in
                       frame M.
-
- @retval `polygon_M`  A sequence of vertex positions of the intersecting
-                      polygon expressed in frame M. Its unit normal vector
-                      in CCW winding order convention is in the same direction
-                      as the plane's normal vector.
-
+ @param[out] polygon_M  A sequence of vertex positions of the intersecting
+                      polygon expressed in frame M; it is empty if there is
+                      no intersection. Its unit normal vector in CCW winding
+                      order convention is in the same direction as the plane's
+                      normal vector.
+ @param[in, out] scratch_M  Working storage for the clipping; its contents on
+                      input and output are unspecified. Passing the same
+                      buffers to many calls saves reallocating them.
+
+ @pre `polygon_M` and `scratch_M` are not null and are distinct.
  @tparam T A valid Eigen scalar.
  */
 template <typename T>
-std::vector<Vector3<T>> IntersectTetrahedra(
+void IntersectTetrahedra(
     int element0, const VolumeMesh<double>& mesh0_M,
     int element1, const VolumeMesh<double>& mesh1_N,
-    const math::RigidTransform<T>& X_MN, const Plane<T>& equilibrium_plane_M);
+    const math::RigidTransform<T>& X_MN, const Plane<T>& equilibrium_plane_M,
+    std::vector<Vector3<T>>* polygon_M, std::vector<Vector3<T>>* scratch_M);
 
 // TODO(DamrongGuoy): Move IsPlaneNormalAlongPressureGradient() into
 //  contact_surface_utility for code reuse if and when we work on compliant
@@ -126,6 +131,9 @@ bool IsPlaneNormalAlongPressureGradient(
  @param[out] grad_e1_Ms  The pressure gradients of `field1` on the mesh of
                      the contact surface, expressed in frame M (one sample
                      per face in `surface_01_M`).
+ @param[in, out] front  If non-null, the front of the previous traversal of
+                     `bvh0_M` and `bvh1_N`, which is replaced by this one's
+                     (see Bvh::Collide()). The result doesn't depend on it.
  @note  The output surface mesh may have duplicate vertices.
  @tparam MeshType    Type of output surface mesh: TriangleSurfaceMesh<T> or
                      PolygonSurfaceMesh<T>, where T is double or AutoDiffXd.
@@ -147,7 +155,8 @@ void IntersectFields(
     std::unique_ptr<MeshType>* surface_01_M,
     std::unique_ptr<FieldType>* e_01_M,
     std::vector<Vector3<T>>* grad_e0_Ms,
-    std::vector<Vector3<T>>* grad_e1_Ms);
+    std::vector<Vector3<T>>* grad_e1_Ms,
+    BvttFront* front = nullptr);
 
 /* Computes the contact surface between two compliant hydroelastic geometries
  given a specific mesh-builder instance. The output contact surface is posed
@@ -167,6 +176,9 @@ void IntersectFields(
  @param[in] X_WG       The pose of the second geometry in World.
  @param[in] builder   The builder of the output mesh and the contact pressure
                       field.
+ @param[in, out] front  If non-null, the front of the previous traversal of
+                      `bvh0_F` and `bvh1_G`, which is replaced by this one's
+                      (see IntersectFields()).
  @returns The contact surface, whose type (e.g., triangles or polygons) depends
           on the given MeshBuilder. It is expressed in World frame.
           If there is no contact, nullptr is returned.
@@ -186,7 +198,8 @@ std::unique_ptr<ContactSurface<T>> IntersectCompliantVolumes(
     const math::RigidTransform<T>& X_WF,
     GeometryId id1, const VolumeMeshFieldLinear<double, double>& field1_G,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_G,
-    const math::RigidTransform<T>& X_WG);
+    const math::RigidTransform<T>& X_WG,
+    BvttFront* front = nullptr);
 
 /* Computes the contact surface between two compliant hydroelastic geometries
  with the requested representation. The output contact surface is posed
@@ -206,6 +219,9 @@ std::unique_ptr<ContactSurface<T>> IntersectCompliantVolumes(
  @param[in] X_WG       The pose of the second geometry in World.
  @param[in] representation  The preferred representation of each contact
                             polygon.
+ @param[in, out] front  If non-null, the front of the previous traversal of
+                        `bvh0_F` and `bvh1_G`, which is replaced by this one's
+                        (see IntersectFields()).
 
  @returns the contact surface between the two geometries (see ContactSurface)
           in the requested representation. It is expressed in World frame.
@@ -227,7 +243,8 @@ ComputeContactSurfaceFromCompliantVolumes(
   GeometryId id1, const VolumeMeshFieldLinear<double, double>& field1_G,
   const Bvh<Obb, VolumeMesh<double>>& bvh1_G,
   const math::RigidTransform<T>& X_WG,
-  HydroelasticContactRepresentation representation);
+  HydroelasticContactRepresentation representation,
+  BvttFront* front = nullptr);
 
 }  // namespace internal
 }  // namespace geometry
@@ -10,6 +10,7 @@
 
 #include "drake/common/drake_export.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/collision_filter.h"
 #include "drake/geometry/proximity/field_intersection.h"
@@ -29,6 +30,10 @@ namespace geometry {
 namespace internal {
 namespace hydroelastic DRAKE_NO_EXPORT {
 
+/* The fronts of the bounding volume tree traversals (see BvttFront) that
+ computed the contact surfaces of pairs of geometries, keyed by the pairs.  */
+using BvttFronts = std::unordered_map<SortedPair<GeometryId>, BvttFront>;
+
 /* Supporting data for the shape-to-shape hydroelastic contact callback (see
  Callback below). It includes:
 
@@ -40,6 +45,8 @@ namespace hydroelastic DRAKE_NO_EXPORT {
     - The choice of how to represent contact polygons.
     - A vector of contact surfaces -- one instance of ContactSurface for
       every supported, unfiltered penetrating pair.
+    - Optionally, the traversal fronts of the previous query and those of
+      this one, which let consecutive queries exploit temporal coherence.
 
  @tparam T The computation scalar.  */
 template <typename T>
@@ -57,18 +64,24 @@ struct CallbackData {
                                   @ref contact_surface_discrete_representation
                                   "contact surface representation" for more
                                   details.
-   @param surfaces_in             The output results. Aliased.  */
+   @param surfaces_in             The output results. Aliased.
+   @param previous_fronts_in      The traversal fronts recorded by the
+                                  previous query, or nullptr to not use them.
+                                  The fronts used by this query are moved to
+                                  `fronts`. Aliased.  */
   CallbackData(
       const CollisionFilter* collision_filter_in,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>* X_WGs_in,
       const Geometries* geometries_in,
       HydroelasticContactRepresentation representation_in,
-      std::vector<ContactSurface<T>>* surfaces_in)
+      std::vector<ContactSurface<T>>* surfaces_in,
+      BvttFronts* previous_fronts_in = nullptr)
       : collision_filter(*collision_filter_in),
         X_WGs(*X_WGs_in),
         geometries(*geometries_in),
         representation(representation_in),
-        surfaces(*surfaces_in) {
+        surfaces(*surfaces_in),
+        previous_fronts(previous_fronts_in) {
     DRAKE_DEMAND(collision_filter_in != nullptr);
     DRAKE_DEMAND(X_WGs_in != nullptr);
     DRAKE_DEMAND(geometries_in != nullptr);
@@ -89,6 +102,28 @@ struct CallbackData {
 
   /* The results of the distance query.  */
   std::vector<ContactSurface<T>>& surfaces;
+
+  /* Returns the traversal front for the contact surface computation of the
+   given pair of geometries, or nullptr if fronts are not being used. The
+   front starts as the pair's front from `previous_fronts` (if any) and is
+   stored in `fronts`.  */
+  BvttFront* front(GeometryId id_A, GeometryId id_B) {
+    if (previous_fronts == nullptr) return nullptr;
+    const SortedPair<GeometryId> key(id_A, id_B);
+    BvttFront& result = fronts[key];
+    auto iter = previous_fronts->find(key);
+    if (iter != previous_fronts->end()) {
+      result = std::move(iter->second);
+    }
+    return &result;
+  }
+
+  /* The traversal fronts of the previous query (optional).  */
+  BvttFronts* const previous_fronts;
+
+  /* The traversal fronts of this query; only populated if `previous_fronts`
+   is not nullptr.  */
+  BvttFronts fronts;
 };
 
 enum class CalcContactSurfaceResult {
@@ -110,7 +145,8 @@ std::unique_ptr<ContactSurface<T>> DispatchRigidSoftCalculation(
     const SoftGeometry& soft, const math::RigidTransform<T>& X_WS,
     GeometryId id_S, const RigidGeometry& rigid,
     const math::RigidTransform<T>& X_WR, GeometryId id_R,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    BvttFront* front = nullptr) {
   if (soft.is_half_space() || rigid.is_half_space()) {
     if (soft.is_half_space()) {
       DRAKE_DEMAND(!rigid.is_half_space());
@@ -137,7 +173,8 @@ std::unique_ptr<ContactSurface<T>> DispatchRigidSoftCalculation(
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R = rigid.bvh();
 
     return ComputeContactSurfaceFromSoftVolumeRigidSurface(
-        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation);
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation,
+        front);
   }
 }
 
@@ -149,7 +186,8 @@ std::unique_ptr<ContactSurface<T>> DispatchCompliantCompliantCalculation(
     const SoftGeometry& compliant0_F, const math::RigidTransform<T>& X_WF,
     GeometryId id0, const SoftGeometry& compliant1_G,
     const math::RigidTransform<T>& X_WG, GeometryId id1,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    BvttFront* front = nullptr) {
   DRAKE_DEMAND(!compliant0_F.is_half_space() && !compliant1_G.is_half_space());
 
   const VolumeMeshFieldLinear<double, double>& field0_F =
@@ -161,7 +199,7 @@ std::unique_ptr<ContactSurface<T>> DispatchCompliantCompliantCalculation(
 
   return ComputeContactSurfaceFromCompliantVolumes(
       id0, field0_F, bvh0_F, X_WF, id1, field1_G, bvh1_G, X_WG,
-      representation);
+      representation, front);
 }
 
 /* Calculates the contact surface (if it exists) between two potentially
@@ -230,7 +268,8 @@ CalcContactSurfaceResult MaybeCalcContactSurface(
     std::unique_ptr<ContactSurface<T>> surface =
         DispatchCompliantCompliantCalculation(soft0, data->X_WGs.at(id0), id0,
                                               soft1, data->X_WGs.at(id1), id1,
-                                              data->representation);
+                                              data->representation,
+                                              data->front(id0, id1));
     if (surface != nullptr) {
       DRAKE_DEMAND(surface->id_M() < surface->id_N());
       data->surfaces.emplace_back(std::move(*surface));
@@ -259,7 +298,8 @@ CalcContactSurfaceResult MaybeCalcContactSurface(
   const math::RigidTransform<T>& X_WR(data->X_WGs.at(id_R));
 
   std::unique_ptr<ContactSurface<T>> surface = DispatchRigidSoftCalculation(
-      soft, X_WS, id_S, rigid, X_WR, id_R, data->representation);
+      soft, X_WS, id_S, rigid, X_WR, id_R, data->representation,
+      data->front(id_S, id_R));
 
   if (surface != nullptr) {
     DRAKE_DEMAND(surface->id_M() < surface->id_N());
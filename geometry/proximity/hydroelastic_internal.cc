@@ -1,11 +1,24 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
+#include <picosha2.h>
 
+#include "drake/common/find_cache.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/geometry/proximity/make_box_field.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_capsule_field.h"
@@ -30,19 +43,241 @@ namespace internal {
 namespace hydroelastic {
 
 using std::make_unique;
+namespace fs = std::filesystem;
+
+SoftMesh::SoftMesh(
+    std::unique_ptr<VolumeMesh<double>> mesh,
+    std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure) {
+  DRAKE_DEMAND(mesh != nullptr && pressure != nullptr);
+  DRAKE_ASSERT(mesh.get() == &pressure->mesh());
+  auto data = std::make_shared<Data>();
+  data->bvh = make_unique<Bvh<Obb, VolumeMesh<double>>>(*mesh);
+  data->mesh = std::move(mesh);
+  data->pressure = std::move(pressure);
+  data_ = std::move(data);
+}
 
-SoftMesh& SoftMesh::operator=(const SoftMesh& s) {
-  if (this == &s) return *this;
+namespace {
+
+// Bump this whenever the generated meshes and fields, or the layout of their
+// cache files, change; it invalidates all previously cached entries. The disk
+// cache keys only on the inputs of the generating functions, not on their
+// code, so this is the only guard against reading stale meshes. The functions
+// whose output is cached on disk are MakeVolumeMeshFromVtk(),
+// MakeVolumeMeshPressureField(), MakeConvexVolumeMesh(), and
+// MakeConvexPressureField(); each of them notes this requirement.
+constexpr int64_t kSoftMeshCacheVersion = 1;
+
+// Returns the contents of the named file, or nullopt if it can't be read.
+std::optional<std::string> ReadFileContents(const std::string& filename) {
+  std::ifstream input(filename, std::ios::binary);
+  if (!input.good()) {
+    return std::nullopt;
+  }
+  std::stringstream contents;
+  contents << input.rdbuf();
+  if (input.bad()) {
+    return std::nullopt;
+  }
+  return std::move(contents).str();
+}
 
-  mesh_ = make_unique<VolumeMesh<double>>(s.mesh());
-  // We can't simply copy the mesh field; the copy must contain a pointer to
-  // the new mesh. So, we use CloneAndSetMesh() instead.
-  pressure_ = s.pressure().CloneAndSetMesh(mesh_.get());
-  bvh_ = make_unique<Bvh<Obb, VolumeMesh<double>>>(s.bvh());
+// Returns the directory of the on-disk cache, or nullopt if that cache is
+// not enabled or is unavailable.
+std::optional<fs::path> FindSoftMeshCacheDirectory() {
+  const char* const enabled = std::getenv("DRAKE_HYDROELASTIC_CACHE");
+  if (enabled == nullptr || std::string_view(enabled) != "1") {
+    return std::nullopt;
+  }
+  drake::internal::PathOrError try_cache =
+      drake::internal::FindOrCreateCache("hydroelastic");
+  if (!try_cache.error.empty()) {
+    log()->debug("Hydroelastic meshes won't be cached on disk: {}",
+                 try_cache.error);
+    return std::nullopt;
+  }
+  return std::move(try_cache.abspath);
+}
 
-  return *this;
+template <typename T>
+void WriteValues(const T* values, int64_t count, std::ostream* output) {
+  output->write(reinterpret_cast<const char*>(values), count * sizeof(T));
 }
 
+template <typename T>
+bool ReadValues(int64_t count, T* values, std::istream* input) {
+  input->read(reinterpret_cast<char*>(values), count * sizeof(T));
+  return input->good();
+}
+
+}  // namespace
+
+// The process-wide cache of soft meshes described in the header. The on-disk
+// entries are named by their keys and hold, in native binary format: the
+// cache version, the numbers of vertices and tetrahedra, the vertex
+// positions, the tetrahedra's vertex indices, the pressure values at the
+// vertices, and the pressure gradients of the tetrahedra.
+class SoftMeshCache {
+ public:
+  // Returns the soft mesh of the shape described by `description`, calling
+  // `make` only if there is no such mesh in memory or, when `use_disk` is
+  // true, on disk. The description must identify everything that `make`
+  // depends on.
+  static SoftMesh GetOrMake(std::string_view description,
+                            const std::function<SoftMesh()>& make,
+                            bool use_disk = false) {
+    const std::string key = picosha2::hash256_hex_string(
+        fmt::format("{}\n{}", kSoftMeshCacheVersion, description));
+    InMemory& in_memory = in_memory_entries();
+    {
+      std::lock_guard<std::mutex> lock(in_memory.mutex);
+      auto iter = in_memory.entries.find(key);
+      if (iter != in_memory.entries.end()) {
+        if (std::shared_ptr<const SoftMesh::Data> data = iter->second.lock()) {
+          return SoftMesh(std::move(data));
+        }
+      }
+    }
+
+    const std::optional<fs::path> directory =
+        use_disk ? FindSoftMeshCacheDirectory() : std::nullopt;
+    const fs::path filename =
+        directory.has_value() ? *directory / (key + ".bin") : fs::path{};
+    std::optional<SoftMesh> result;
+    if (directory.has_value()) {
+      result = Read(filename);
+    }
+    if (!result.has_value()) {
+      result = make();
+      if (directory.has_value()) {
+        Write(*result, filename);
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(in_memory.mutex);
+    for (auto iter = in_memory.entries.begin();
+         iter != in_memory.entries.end();) {
+      if (iter->second.expired()) {
+        iter = in_memory.entries.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    in_memory.entries[key] = result->data_;
+    return *result;
+  }
+
+ private:
+  struct InMemory {
+    std::mutex mutex;
+    std::unordered_map<std::string, std::weak_ptr<const SoftMesh::Data>>
+        entries;
+  };
+
+  static InMemory& in_memory_entries() {
+    static never_destroyed<InMemory> in_memory;
+    return in_memory.access();
+  }
+
+  static std::optional<SoftMesh> Read(const fs::path& filename) {
+    std::ifstream input(filename, std::ios::binary);
+    if (!input.good()) {
+      return std::nullopt;
+    }
+    int64_t header[3];
+    if (!ReadValues(3, header, &input) || header[0] != kSoftMeshCacheVersion) {
+      return std::nullopt;
+    }
+    const int64_t num_vertices = header[1];
+    const int64_t num_elements = header[2];
+    // Validate the sizes before allocating anything.
+    if (num_vertices <= 0 || num_elements <= 0 ||
+        num_vertices > std::numeric_limits<int>::max() ||
+        num_elements > std::numeric_limits<int>::max()) {
+      return std::nullopt;
+    }
+    const uintmax_t expected_size =
+        sizeof(header) + num_vertices * 4 * sizeof(double) +
+        num_elements * (4 * sizeof(int) + 3 * sizeof(double));
+    std::error_code error;
+    if (fs::file_size(filename, error) != expected_size || error) {
+      return std::nullopt;
+    }
+
+    std::vector<Eigen::Vector3d> vertices(num_vertices);
+    std::vector<int> indices(4 * num_elements);
+    std::vector<double> values(num_vertices);
+    std::vector<Eigen::Vector3d> gradients(num_elements);
+    if (!ReadValues(3 * num_vertices, vertices.front().data(), &input) ||
+        !ReadValues(4 * num_elements, indices.data(), &input) ||
+        !ReadValues(num_vertices, values.data(), &input) ||
+        !ReadValues(3 * num_elements, gradients.front().data(), &input)) {
+      return std::nullopt;
+    }
+    std::vector<VolumeElement> elements;
+    elements.reserve(num_elements);
+    for (int e = 0; e < num_elements; ++e) {
+      const int* const v = &indices[4 * e];
+      if (!std::all_of(v, v + 4, [num_vertices](int i) {
+            return 0 <= i && i < num_vertices;
+          })) {
+        return std::nullopt;
+      }
+      elements.emplace_back(v);
+    }
+
+    auto mesh = make_unique<VolumeMesh<double>>(std::move(elements),
+                                                std::move(vertices));
+    auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+        std::move(values), mesh.get(), std::move(gradients));
+    return SoftMesh(std::move(mesh), std::move(pressure));
+  }
+
+  // Writes to a temporary file which then replaces the entry, so that
+  // concurrent readers never see a partial entry.
+  static void Write(const SoftMesh& soft_mesh, const fs::path& filename) {
+    const VolumeMesh<double>& mesh = soft_mesh.mesh();
+    const VolumeMeshFieldLinear<double, double>& pressure =
+        soft_mesh.pressure();
+    const int64_t header[3] = {kSoftMeshCacheVersion, mesh.num_vertices(),
+                               mesh.num_elements()};
+    std::vector<int> indices;
+    indices.reserve(4 * mesh.num_elements());
+    std::vector<Eigen::Vector3d> gradients;
+    gradients.reserve(mesh.num_elements());
+    for (int e = 0; e < mesh.num_elements(); ++e) {
+      for (int i = 0; i < 4; ++i) {
+        indices.push_back(mesh.element(e).vertex(i));
+      }
+      gradients.push_back(pressure.EvaluateGradient(e));
+    }
+
+    fs::path temp_filename = filename;
+    temp_filename += fmt::format(".{}.tmp", std::random_device{}());
+    {
+      std::ofstream output(temp_filename, std::ios::binary);
+      WriteValues(header, 3, &output);
+      WriteValues(mesh.vertices().front().data(), 3 * mesh.num_vertices(),
+                  &output);
+      WriteValues(indices.data(), 4 * mesh.num_elements(), &output);
+      WriteValues(pressure.values().data(), mesh.num_vertices(), &output);
+      WriteValues(gradients.front().data(), 3 * mesh.num_elements(), &output);
+      output.close();
+      if (output.good()) {
+        std::error_code error;
+        fs::rename(temp_filename, filename, error);
+        if (!error) {
+          return;
+        }
+      }
+    }
+    log()->debug("Could not write the hydroelastic mesh cache entry {}",
+                 filename.string());
+    std::error_code ignored;
+    fs::remove(temp_filename, ignored);
+  }
+};
+
 HydroelasticType Geometries::hydroelastic_type(GeometryId id) const {
   auto iter = supported_geometries_.find(id);
   if (iter != supported_geometries_.end()) return iter->second;
@@ -289,93 +524,107 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Sphere& sphere, const ProximityProperties& props) {
   PositiveDouble validator("Sphere", "soft");
-  // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
   // If nothing is said, let's go for the *cheap* tessellation strategy.
   const TessellationStrategy strategy =
       props.GetPropertyOrDefault(kHydroGroup, "tessellation_strategy",
                                  TessellationStrategy::kSingleInteriorVertex);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeSphereVolumeMesh<double>(sphere, edge_length, strategy));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeSpherePressureField(sphere, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(SoftMeshCache::GetOrMake(
+      fmt::format("Sphere({}) {} {} {}", sphere.radius(), edge_length,
+                  static_cast<int>(strategy), hydroelastic_modulus),
+      [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeSphereVolumeMesh<double>(sphere, edge_length, strategy));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeSpherePressureField(sphere, mesh.get(), hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Box& box, const ProximityProperties& props) {
   PositiveDouble validator("Box", "soft");
-  // First, create the mesh.
-  auto mesh =
-      make_unique<VolumeMesh<double>>(MakeBoxVolumeMeshWithMa<double>(box));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeBoxPressureField(box, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(SoftMeshCache::GetOrMake(
+      fmt::format("Box({}, {}, {}) {}", box.width(), box.depth(), box.height(),
+                  hydroelastic_modulus),
+      [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeBoxVolumeMeshWithMa<double>(box));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeBoxPressureField(box, mesh.get(), hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Cylinder& cylinder, const ProximityProperties& props) {
   PositiveDouble validator("Cylinder", "soft");
-  // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeCylinderVolumeMeshWithMa<double>(cylinder, edge_length));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeCylinderPressureField(cylinder, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(SoftMeshCache::GetOrMake(
+      fmt::format("Cylinder({}, {}) {} {}", cylinder.radius(),
+                  cylinder.length(), edge_length, hydroelastic_modulus),
+      [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeCylinderVolumeMeshWithMa<double>(cylinder, edge_length));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeCylinderPressureField(cylinder, mesh.get(),
+                                      hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Capsule& capsule, const ProximityProperties& props) {
   PositiveDouble validator("Capsule", "soft");
-  // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeCapsuleVolumeMesh<double>(capsule, edge_length));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeCapsulePressureField(capsule, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(SoftMeshCache::GetOrMake(
+      fmt::format("Capsule({}, {}) {} {}", capsule.radius(), capsule.length(),
+                  edge_length, hydroelastic_modulus),
+      [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeCapsuleVolumeMesh<double>(capsule, edge_length));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeCapsulePressureField(capsule, mesh.get(),
+                                     hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Ellipsoid& ellipsoid, const ProximityProperties& props) {
   PositiveDouble validator("Ellipsoid", "soft");
-  // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
   // If nothing is said, let's go for the *cheap* tessellation strategy.
   const TessellationStrategy strategy =
       props.GetPropertyOrDefault(kHydroGroup, "tessellation_strategy",
                                  TessellationStrategy::kSingleInteriorVertex);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeEllipsoidVolumeMesh<double>(ellipsoid, edge_length, strategy));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeEllipsoidPressureField(ellipsoid, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(SoftMeshCache::GetOrMake(
+      fmt::format("Ellipsoid({}, {}, {}) {} {} {}", ellipsoid.a(),
+                  ellipsoid.b(), ellipsoid.c(), edge_length,
+                  static_cast<int>(strategy), hydroelastic_modulus),
+      [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeEllipsoidVolumeMesh<double>(ellipsoid, edge_length, strategy));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeEllipsoidPressureField(ellipsoid, mesh.get(),
+                                       hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -394,33 +643,51 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Convex& convex_spec, const ProximityProperties& props) {
   PositiveDouble validator("Convex", "soft");
-
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeConvexVolumeMesh<double>(convex_spec));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeConvexPressureField(mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  const auto make = [&]() {
+    auto mesh = make_unique<VolumeMesh<double>>(
+        MakeConvexVolumeMesh<double>(convex_spec));
+    auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+        MakeConvexPressureField(mesh.get(), hydroelastic_modulus));
+    return SoftMesh(std::move(mesh), std::move(pressure));
+  };
+  // Without the file contents there is no key; let make() report the error.
+  const std::optional<std::string> contents =
+      ReadFileContents(convex_spec.filename());
+  if (!contents.has_value()) {
+    return SoftGeometry(make());
+  }
+  return SoftGeometry(SoftMeshCache::GetOrMake(
+      fmt::format("Convex({}) {}\n{}", convex_spec.scale(),
+                  hydroelastic_modulus, *contents),
+      make, /* use_disk = */ true));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Mesh& mesh_specification, const ProximityProperties& props) {
   PositiveDouble validator("Mesh", "soft");
-
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeVolumeMeshFromVtk<double>(mesh_specification));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeVolumeMeshPressureField(mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  const auto make = [&]() {
+    auto mesh = make_unique<VolumeMesh<double>>(
+        MakeVolumeMeshFromVtk<double>(mesh_specification));
+    auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+        MakeVolumeMeshPressureField(mesh.get(), hydroelastic_modulus));
+    return SoftMesh(std::move(mesh), std::move(pressure));
+  };
+  // Without the file contents there is no key; let make() report the error.
+  const std::optional<std::string> contents =
+      ReadFileContents(mesh_specification.filename());
+  if (!contents.has_value()) {
+    return SoftGeometry(make());
+  }
+  return SoftGeometry(SoftMeshCache::GetOrMake(
+      fmt::format("Mesh({}) {}\n{}", mesh_specification.scale(),
+                  hydroelastic_modulus, *contents),
+      make, /* use_disk = */ true));
 }
 
 
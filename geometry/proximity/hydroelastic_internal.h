@@ -27,41 +27,46 @@ namespace hydroelastic {
 /* Defines a soft mesh -- a mesh, its linearized pressure field, p̃(e), and its
  bounding volume hierarchy. While this class retains ownership of the mesh,
  we assume that both the pressure field and the bounding volume hierarchy
- are derived from the mesh. */
+ are derived from the mesh.
+
+ The mesh, field, and hierarchy are immutable, so copies of a %SoftMesh share
+ them; copying is cheap. */
 class SoftMesh {
  public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SoftMesh)
+
   SoftMesh() = default;
 
   SoftMesh(std::unique_ptr<VolumeMesh<double>> mesh,
-           std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure)
-      : mesh_(std::move(mesh)),
-        pressure_(std::move(pressure)),
-        bvh_(std::make_unique<Bvh<Obb, VolumeMesh<double>>>(*mesh_)) {
-    DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
-  }
-
-  SoftMesh(const SoftMesh& s) { *this = s; }
-  SoftMesh& operator=(const SoftMesh& s);
-  SoftMesh(SoftMesh&&) = default;
-  SoftMesh& operator=(SoftMesh&&) = default;
+           std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure);
 
   const VolumeMesh<double>& mesh() const {
-    DRAKE_DEMAND(mesh_ != nullptr);
-    return *mesh_;
+    DRAKE_DEMAND(data_ != nullptr);
+    return *data_->mesh;
   }
   const VolumeMeshFieldLinear<double, double>& pressure() const {
-    DRAKE_DEMAND(pressure_ != nullptr);
-    return *pressure_;
+    DRAKE_DEMAND(data_ != nullptr);
+    return *data_->pressure;
   }
   const Bvh<Obb, VolumeMesh<double>>& bvh() const {
-    DRAKE_DEMAND(bvh_ != nullptr);
-    return *bvh_;
+    DRAKE_DEMAND(data_ != nullptr);
+    return *data_->bvh;
   }
 
  private:
-  std::unique_ptr<VolumeMesh<double>> mesh_;
-  std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure_;
-  std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh_;
+  friend class SoftMeshCache;
+
+  struct Data {
+    std::unique_ptr<VolumeMesh<double>> mesh;
+    std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure;
+    std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh;
+  };
+
+  explicit SoftMesh(std::shared_ptr<const Data> data) : data_(std::move(data)) {
+    DRAKE_DEMAND(data_ != nullptr);
+  }
+
+  std::shared_ptr<const Data> data_;
 };
 
 /* Defines a soft half space. The half space is defined such that the half
@@ -429,6 +434,23 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const HalfSpace& half_space, const ProximityProperties& props);
 
+/* Generating the volume mesh and pressure field of a compliant shape can be
+ expensive, so MakeSoftRepresentation() caches the SoftMesh of every shape it
+ supports below (except HalfSpace, which has no mesh). A cached mesh is keyed
+ by a SHA-256 hash of everything it depends on: the shape's type and
+ parameters, the relevant properties, and the file contents of Mesh and
+ Convex shapes.
+
+   - Within a process, geometries with equal keys share a single SoftMesh,
+     which lives as long as any of them does.
+   - Across processes, the meshes and fields of Mesh and Convex shapes (the
+     ones whose generation is costly) can be stored in the "hydroelastic"
+     directory of Drake's cache (see FindOrCreateCache()), so repeated
+     startups don't regenerate them. This on-disk cache is off unless the
+     environment variable DRAKE_HYDROELASTIC_CACHE is set to 1. Its entries
+     are never evicted; removing the directory is always safe. A missing,
+     unreadable, or malformed entry is simply regenerated.  */
+
 /* Generic interface for handling unsupported soft Shapes. Unsupported
  geometries will return a std::nullopt.  */
 template <typename Shape>
@@ -18,6 +18,10 @@ namespace internal {
  the vertices are boundary. If the implementation in MakeConvexVolumeMesh()
  were to change, this pressure field generation would also need to change.
 
+ Soft Convex geometries may reuse this field from the on-disk cache in
+ hydroelastic_internal.cc; changing its values requires bumping
+ kSoftMeshCacheVersion there.
+
  @param[in] mesh_C       A pointer to a tetrahedral mesh of a convex shape.
                          It is aliased in the returned pressure field and
                          must remain alive as long as the field.
@@ -36,6 +36,10 @@ v1─────────────────────v2    v1──
         - The closure of the interior of the mesh is a convex set.
         - The mesh is closed and watertight.
         - The surface normals of all faces are consistently outwardly oriented.
+
+ Its result may be read back from the on-disk soft mesh cache instead of
+ being recomputed, so changing the tessellation requires bumping
+ kSoftMeshCacheVersion in hydroelastic_internal.cc.
  @retval volume_mesh
  @tparam_nonsymbolic_scalar
  */
@@ -1,10 +1,13 @@
 #include "drake/geometry/proximity/make_mesh_field.h"
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <utility>
 #include <vector>
 
+#include <common_robotics_utilities/openmp_helpers.hpp>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/extract_double.h"
@@ -18,6 +21,10 @@ namespace internal {
 
 namespace {
 
+// Below this many vertex-triangle distance evaluations, parallelizing costs
+// more than it saves (even when the caller asked for it).
+constexpr int64_t kMinParallelWork = 1 << 20;
+
 template <typename T>
 TriangleSurfaceMesh<double> ConvertVolumeToSurfaceMeshDouble(
     const VolumeMesh<T>& volume_mesh) {
@@ -41,7 +48,8 @@ TriangleSurfaceMesh<double> ConvertVolumeToSurfaceMeshDouble(
 
 template <typename T>
 VolumeMeshFieldLinear<T, T> MakeVolumeMeshPressureField(
-    const VolumeMesh<T>* mesh_M, const T& hydroelastic_modulus) {
+    const VolumeMesh<T>* mesh_M, const T& hydroelastic_modulus,
+    bool parallelize) {
   DRAKE_DEMAND(hydroelastic_modulus > T(0));
   DRAKE_DEMAND(mesh_M != nullptr);
   // The subscript _d is for the scalar type double.
@@ -52,12 +60,29 @@ VolumeMeshFieldLinear<T, T> MakeVolumeMeshPressureField(
   //  cause a vertex on the boundary to have a non-zero value. Consider
   //  initializing pressure_values to zeros and skip the computation for
   //  boundary vertices.
-  std::vector<T> pressure_values;
-  T max_value(std::numeric_limits<double>::lowest());
   // First round, it's actually unsigned distance, not pressure values yet.
+  // Each distance visits every boundary triangle, so this dominates the cost
+  // of the field; the vertices are independent, so the caller may opt in to
+  // computing them in parallel.
+  const int num_vertices = mesh_M->num_vertices();
+  std::vector<double> distances(num_vertices);
+  std::vector<Vector3<double>> vertices_d;
+  vertices_d.reserve(num_vertices);
   for (const Vector3<T>& p_MV : mesh_M->vertices()) {
-    Vector3<double> p_MV_d = ExtractDoubleOrThrow(p_MV);
-    T pressure(internal::CalcDistanceToSurfaceMesh(p_MV_d, surface_d));
+    vertices_d.push_back(ExtractDoubleOrThrow(p_MV));
+  }
+  const int64_t work =
+      static_cast<int64_t>(num_vertices) * surface_d.num_triangles();
+  CRU_OMP_PARALLEL_FOR_IF(parallelize && work >= kMinParallelWork)
+  for (int v = 0; v < num_vertices; ++v) {
+    distances[v] = CalcDistanceToSurfaceMesh(vertices_d[v], surface_d);
+  }
+
+  std::vector<T> pressure_values;
+  pressure_values.reserve(num_vertices);
+  T max_value(std::numeric_limits<double>::lowest());
+  for (const double distance : distances) {
+    T pressure(distance);
     pressure_values.emplace_back(pressure);
     if (max_value < pressure) {
       max_value = pressure;
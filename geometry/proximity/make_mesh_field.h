@@ -32,6 +32,10 @@ namespace internal {
                      remain alive as long as the field.
  @param[in] hydroelastic_modulus   Scale penetration extent to pressure.
                      Its unit is Pascals. See [Elandt2019].
+ @param[in] parallelize   If true, the distances from the vertices to the
+                     boundary are computed in parallel (with OpenMP) when the
+                     mesh is large enough for that to pay off. Off by
+                     default.
  @return             The pressure field defined on the tetrahedral mesh.
 
  @pre                `hydroelastic_modulus` is strictly positive.
@@ -39,6 +43,10 @@ namespace internal {
 
  @throw  std::exception if the mesh has no interior vertices.
 
+ Note: the on-disk soft mesh cache stores this field keyed on its inputs only,
+ so a change to the values it computes must bump kSoftMeshCacheVersion in
+ hydroelastic_internal.cc.
+
  @tparam T          The scalar type for representing the mesh vertex
                     positions and the pressure value. It must be double
                     or AutoDiffXd.
@@ -50,7 +58,8 @@ namespace internal {
  */
 template <typename T>
 VolumeMeshFieldLinear<T, T> MakeVolumeMeshPressureField(
-    const VolumeMesh<T>* mesh_M, const T& hydroelastic_modulus);
+    const VolumeMesh<T>* mesh_M, const T& hydroelastic_modulus,
+    bool parallelize = false);
 
 }  // namespace internal
 }  // namespace geometry
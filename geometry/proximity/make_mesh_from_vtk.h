@@ -10,6 +10,10 @@ namespace internal {
 /* Creates a VolumeMesh of a possibly non-convex object from a VTK file
  containing its tetrahedral mesh. It complements MakeConvexVolumeMesh().
 
+ Soft Mesh geometries may be read from an on-disk cache keyed by the VTK
+ contents rather than built here; if this function's output changes, bump
+ kSoftMeshCacheVersion in hydroelastic_internal.cc.
+
  @param[in] mesh  The mesh specification containing VTK file name.
  @retval  volume_mesh
  @tparam_nonsymbolic_scalar
@@ -290,7 +290,7 @@ void SurfaceVolumeIntersector<MeshBuilder, BvType>::SampleVolumeFieldOnSurface(
     const TriangleSurfaceMesh<double>& surface_N,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_N,
     const math::RigidTransform<T>& X_MN,
-    const bool filter_face_normal_along_field_gradient) {
+    const bool filter_face_normal_along_field_gradient, BvttFront* front) {
   // Builds the intersection mesh represented in M's frame.
   MeshBuilder builder_M;
   const math::RigidTransform<double>& X_MN_d = convert_to_double(X_MN);
@@ -301,7 +301,8 @@ void SurfaceVolumeIntersector<MeshBuilder, BvType>::SampleVolumeFieldOnSurface(
                     int tet_index, int tri_index) -> BvttCallbackResult {
                   candidate_tet_tri_pairs.emplace_back(tet_index, tri_index);
                   return BvttCallbackResult::Continue;
-                });
+                },
+                front);
 
   for (const auto& [tet_index, tri_index] : candidate_tet_tri_pairs) {
     CalcContactPolygon(volume_field_M, surface_N, X_MN, X_MN_d, &builder_M,
@@ -384,7 +385,7 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const TriangleSurfaceMesh<double>& mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation, BvttFront* front) {
   auto process_intersection =
       [&X_WS, id_S,
        id_R](auto&& intersector_in) -> std::unique_ptr<ContactSurface<T>> {
@@ -423,12 +424,16 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
 
   if (representation == HydroelasticContactRepresentation::kTriangle) {
     SurfaceVolumeIntersector<TriMeshBuilder<T>, Obb> intersector;
-    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR);
+    intersector.SampleVolumeFieldOnSurface(
+        field_S, bvh_S, mesh_R, bvh_R, X_SR,
+        true /* filter face normal along field gradient */, front);
     return process_intersection(intersector);
   } else {
     // Polygon.
     SurfaceVolumeIntersector<PolyMeshBuilder<T>, Obb> intersector;
-    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR);
+    intersector.SampleVolumeFieldOnSurface(
+        field_S, bvh_S, mesh_R, bvh_R, X_SR,
+        true /* filter face normal along field gradient */, front);
     return process_intersection(intersector);
   }
 }
@@ -153,6 +153,10 @@ class SurfaceVolumeIntersector {
        If true, allow only contact polygons whose face normals are "along"
        the direction of field gradient vectors. See
        IsFaceNormalAlongPressureGradient().
+   @param[in, out] front
+       If non-null, the front of the previous traversal of `bvh_M` and `bvh_N`
+       to start the traversal from, which is replaced by this traversal's (see
+       Bvh::Collide()). The result doesn't depend on it.
    @note
        The output surface mesh (see mutable_mesh() and release_mesh()) may
        have duplicate vertices.
@@ -163,7 +167,8 @@ class SurfaceVolumeIntersector {
       const TriangleSurfaceMesh<double>& surface_N,
       const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_N,
       const math::RigidTransform<T>& X_MN,
-      bool filter_face_normal_along_field_gradient = true);
+      bool filter_face_normal_along_field_gradient = true,
+      BvttFront* front = nullptr);
 
   bool has_intersection() const { return mesh_M_ != nullptr; }
 
@@ -416,6 +421,10 @@ class SurfaceVolumeIntersector {
      The pose of the rigid frame R in the world frame W.
  @param[in] representation
      The preferred representation of each contact polygon.
+ @param[in, out] front
+     If non-null, the front of the previous traversal of `bvh_S` and `bvh_R`,
+     which is replaced by this one's (see
+     SurfaceVolumeIntersector::SampleVolumeFieldOnSurface()).
  @return
      The contact surface between M and N. Geometries S and R map to M and N
      with a consistent mapping (as documented in ContactSurface) but without any
@@ -449,7 +458,8 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const GeometryId id_R, const TriangleSurfaceMesh<double>& mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    HydroelasticContactRepresentation representation);
+    HydroelasticContactRepresentation representation,
+    BvttFront* front = nullptr);
 
 }  // namespace internal
 }  // namespace geometry
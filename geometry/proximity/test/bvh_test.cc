@@ -1,6 +1,9 @@
 #include "drake/geometry/proximity/bvh.h"
 
+#include <algorithm>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -618,6 +621,154 @@ TYPED_TEST(BvhTest, BvhFromAutodiffmesh) {
   EXPECT_TRUE(bvh_ad.Equal(bvh_d));
 }
 
+// Collide() tests the children of a pair of nodes as a batch (which, for two
+// Obb hierarchies, also takes a different code path for the overlap tests).
+// This confirms that it reports exactly the pairs, in exactly the order, of a
+// traversal that tests one pair at a time as it is popped off the stack.
+template <typename BvhA, typename BvhB>
+std::vector<std::pair<int, int>> CollideOnePairAtATime(
+    const BvhA& bvh_A, const BvhB& bvh_B, const RigidTransformd& X_AB) {
+  using NodeA = typename BvhA::NodeType;
+  using NodeB = typename BvhB::NodeType;
+  std::vector<std::pair<int, int>> result;
+  std::vector<std::pair<const NodeA*, const NodeB*>> node_pairs{
+      {&bvh_A.root_node(), &bvh_B.root_node()}};
+  while (!node_pairs.empty()) {
+    const auto [a, b] = node_pairs.back();
+    node_pairs.pop_back();
+    using BvA = std::remove_cv_t<std::remove_reference_t<decltype(a->bv())>>;
+    if (!BvA::HasOverlap(a->bv(), b->bv(), X_AB)) {
+      continue;
+    }
+    if (a->is_leaf() && b->is_leaf()) {
+      for (int i = 0; i < a->num_element_indices(); ++i) {
+        for (int j = 0; j < b->num_element_indices(); ++j) {
+          result.emplace_back(a->element_index(i), b->element_index(j));
+        }
+      }
+    } else if (b->is_leaf()) {
+      node_pairs.emplace_back(&a->left(), b);
+      node_pairs.emplace_back(&a->right(), b);
+    } else if (a->is_leaf()) {
+      node_pairs.emplace_back(a, &b->left());
+      node_pairs.emplace_back(a, &b->right());
+    } else {
+      node_pairs.emplace_back(&a->left(), &b->left());
+      node_pairs.emplace_back(&a->right(), &b->left());
+      node_pairs.emplace_back(&a->left(), &b->right());
+      node_pairs.emplace_back(&a->right(), &b->right());
+    }
+  }
+  return result;
+}
+
+GTEST_TEST(BoundingVolumeHierarchyTest, CollideMatchesPairwiseTraversal) {
+  const TriangleSurfaceMesh<double> mesh_A =
+      MakeSphereSurfaceMesh<double>(Sphere(1.5), 0.5);
+  const TriangleSurfaceMesh<double> mesh_B =
+      MakeEllipsoidSurfaceMesh<double>(Ellipsoid(1.0, 2.0, 0.5), 0.25);
+  const Bvh<Obb, TriangleSurfaceMesh<double>> obb_A(mesh_A);
+  const Bvh<Obb, TriangleSurfaceMesh<double>> obb_B(mesh_B);
+  const Bvh<Aabb, TriangleSurfaceMesh<double>> aabb_B(mesh_B);
+
+  for (const double distance : {0.0, 1.0, 2.0, 3.5}) {
+    const RigidTransformd X_AB(
+        RotationMatrixd(AngleAxisd(0.3 * distance + 0.2,
+                                   Vector3d(1, 2, 3).normalized())),
+        Vector3d(distance, 0.5, 0.0));
+    const auto obb_obb = obb_A.GetCollisionCandidates(obb_B, X_AB);
+    EXPECT_EQ(obb_obb, CollideOnePairAtATime(obb_A, obb_B, X_AB));
+    const auto obb_aabb = obb_A.GetCollisionCandidates(aabb_B, X_AB);
+    EXPECT_EQ(obb_aabb, CollideOnePairAtATime(obb_A, aabb_B, X_AB));
+    if (distance < 3.0) {
+      EXPECT_GT(obb_obb.size(), 0);
+    }
+  }
+}
+
+// Reports whether `sub` is a subsequence of `sequence`.
+bool IsSubsequence(const std::vector<std::pair<int, int>>& sub,
+                   const std::vector<std::pair<int, int>>& sequence) {
+  auto iter = sequence.begin();
+  for (const auto& pair : sub) {
+    iter = std::find(iter, sequence.end(), pair);
+    if (iter == sequence.end()) return false;
+    ++iter;
+  }
+  return true;
+}
+
+// Collide() with a BvttFront, along a trajectory of small and large motions,
+// reports all of the candidates of a traversal from the roots, in the same
+// order. (It may report additional candidates that were culled by an ancestor
+// of the front.)
+GTEST_TEST(BoundingVolumeHierarchyTest, CollideWithFront) {
+  const TriangleSurfaceMesh<double> mesh_A =
+      MakeSphereSurfaceMesh<double>(Sphere(1.5), 0.5);
+  const TriangleSurfaceMesh<double> mesh_B =
+      MakeEllipsoidSurfaceMesh<double>(Ellipsoid(1.0, 2.0, 0.5), 0.25);
+  const Bvh<Obb, TriangleSurfaceMesh<double>> obb_A(mesh_A);
+  const Bvh<Obb, TriangleSurfaceMesh<double>> obb_B(mesh_B);
+  const Bvh<Aabb, TriangleSurfaceMesh<double>> aabb_B(mesh_B);
+
+  BvttFront obb_front;
+  BvttFront aabb_front;
+  auto collide = [](const auto& bvh_A, const auto& bvh_B,
+                    const RigidTransformd& X_AB, BvttFront* front) {
+    std::vector<std::pair<int, int>> result;
+    bvh_A.Collide(
+        bvh_B, X_AB,
+        [&result](int a, int b) {
+          result.emplace_back(a, b);
+          return BvttCallbackResult::Continue;
+        },
+        front);
+    return result;
+  };
+  // Small steps, a jump, and then moving apart and back into contact.
+  std::vector<double> distances;
+  for (int i = 0; i < 20; ++i) distances.push_back(0.01 * i);
+  distances.insert(distances.end(), {1.5, 1.51, 1.52, 10.0, 10.01, 1.0, 1.0});
+  for (const double distance : distances) {
+    const RigidTransformd X_AB(
+        RotationMatrixd(AngleAxisd(0.3 * distance + 0.2,
+                                   Vector3d(1, 2, 3).normalized())),
+        Vector3d(distance, 0.5, 0.0));
+    for (const bool use_aabb : {false, true}) {
+      const std::vector<std::pair<int, int>> expected =
+          use_aabb ? obb_A.GetCollisionCandidates(aabb_B, X_AB)
+                   : obb_A.GetCollisionCandidates(obb_B, X_AB);
+      const std::vector<std::pair<int, int>> candidates =
+          use_aabb ? collide(obb_A, aabb_B, X_AB, &aabb_front)
+                   : collide(obb_A, obb_B, X_AB, &obb_front);
+      EXPECT_TRUE(IsSubsequence(expected, candidates));
+      const BvttFront& front = use_aabb ? aabb_front : obb_front;
+      EXPECT_GT(front.size(), 0);
+    }
+  }
+
+  // A front recorded for one pair of hierarchies is safely ignored for
+  // another, and the callback terminating the traversal clears the front.
+  const RigidTransformd X_AB(Vector3d(0.5, 0, 0));
+  ASSERT_GT(obb_front.size(), 1);
+  EXPECT_EQ(collide(obb_A, obb_A, X_AB, &obb_front),
+            obb_A.GetCollisionCandidates(obb_A, X_AB));
+  int num_calls = 0;
+  obb_A.Collide(
+      obb_B, X_AB,
+      [&num_calls](int, int) {
+        ++num_calls;
+        return BvttCallbackResult::Terminate;
+      },
+      &obb_front);
+  EXPECT_EQ(num_calls, 1);
+  EXPECT_EQ(obb_front.size(), 0);
+
+  // Without a front, it is the same as Collide() without one.
+  EXPECT_EQ(collide(obb_A, obb_B, X_AB, nullptr),
+            obb_A.GetCollisionCandidates(obb_B, X_AB));
+}
+
 // This confirms that we can execute the Collide() method between Bvhs built on
 // different bounding volume types. This is largely a smoke test. It confirms
 // that the invocations build and execute without throwing. We check for
@@ -1,5 +1,6 @@
 #include "drake/geometry/proximity/bvh_updater.h"
 
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -7,6 +8,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
 #include "drake/geometry/proximity/mesh_deformer.h"
 
 namespace drake {
@@ -15,6 +17,7 @@ namespace internal {
 namespace {
 
 using Eigen::Vector3d;
+using Eigen::VectorXd;
 using math::RotationMatrix;
 using std::vector;
 
@@ -193,6 +196,139 @@ TYPED_TEST(BvhUpdaterTest, Update) {
       (R * expected_right_bv.half_width().cast<T>()).cwiseAbs(), 2 * kEps));
 }
 
+/* Reports the tight bounds of the elements in the subtree rooted at `node`,
+ computed directly from the mesh. */
+template <class MeshType>
+void CalcSubtreeBounds(const MeshType& mesh,
+                       const BvNode<Aabb, MeshType>& node, Vector3d* lower,
+                       Vector3d* upper) {
+  if (node.is_leaf()) {
+    for (int k = 0; k < node.num_element_indices(); ++k) {
+      const auto& element = mesh.element(node.element_index(k));
+      for (int v = 0; v < MeshType::kVertexPerElement; ++v) {
+        *lower = lower->cwiseMin(mesh.vertex(element.vertex(v)));
+        *upper = upper->cwiseMax(mesh.vertex(element.vertex(v)));
+      }
+    }
+  } else {
+    CalcSubtreeBounds(mesh, node.left(), lower, upper);
+    CalcSubtreeBounds(mesh, node.right(), lower, upper);
+  }
+}
+
+/* Confirms that every box of the tree rooted at `node` tightly bounds the
+ elements of its subtree. Returns the number of nodes visited. */
+template <class MeshType>
+int ExpectTightTree(const MeshType& mesh, const BvNode<Aabb, MeshType>& node) {
+  constexpr double kInf = std::numeric_limits<double>::infinity();
+  Vector3d lower = Vector3d::Constant(kInf);
+  Vector3d upper = Vector3d::Constant(-kInf);
+  CalcSubtreeBounds(mesh, node, &lower, &upper);
+  EXPECT_TRUE(CompareMatrices(node.bv().lower(), lower, 1e-14));
+  EXPECT_TRUE(CompareMatrices(node.bv().upper(), upper, 1e-14));
+  if (node.is_leaf()) return 1;
+  return 1 + ExpectTightTree(mesh, node.left()) +
+         ExpectTightTree(mesh, node.right());
+}
+
+/* Reports the element indices of the tree's leaves, in depth-first order. */
+template <class MeshType>
+void GetLeafElements(const BvNode<Aabb, MeshType>& node,
+                     vector<int>* elements) {
+  if (node.is_leaf()) {
+    for (int k = 0; k < node.num_element_indices(); ++k) {
+      elements->push_back(node.element_index(k));
+    }
+  } else {
+    GetLeafElements(node.left(), elements);
+    GetLeafElements(node.right(), elements);
+  }
+}
+
+/* A large mesh deformed smoothly is refit (level by level, in parallel)
+ without changing the hierarchy's topology. */
+GTEST_TEST(BvhUpdaterTest, RefitLargeMesh) {
+  VolumeMesh<double> mesh = MakeSphereVolumeMesh<double>(
+      Sphere(1.0), 0.1, TessellationStrategy::kDenseInteriorVertices);
+  Bvh<Aabb, VolumeMesh<double>> bvh(mesh);
+  BvhUpdater<VolumeMesh<double>> updater(&mesh, &bvh);
+  MeshDeformer<VolumeMesh<double>> deformer(&mesh);
+  vector<int> leaf_elements;
+  GetLeafElements(bvh.root_node(), &leaf_elements);
+
+  /* Stretch and twist the sphere a little. */
+  VectorXd p_MVs(3 * mesh.num_vertices());
+  for (int v = 0; v < mesh.num_vertices(); ++v) {
+    const Vector3d& p_MV = mesh.vertex(v);
+    const RotationMatrix<double> R =
+        RotationMatrix<double>::MakeZRotation(0.2 * p_MV.z());
+    p_MVs.segment<3>(3 * v) = R * Vector3d(1.1 * p_MV.x(), p_MV.y(), p_MV.z());
+  }
+  deformer.SetAllPositions(p_MVs);
+  updater.Update();
+
+  EXPECT_GT(ExpectTightTree(mesh, bvh.root_node()), 1024);
+  vector<int> updated_leaf_elements;
+  GetLeafElements(bvh.root_node(), &updated_leaf_elements);
+  EXPECT_EQ(updated_leaf_elements, leaf_elements);
+}
+
+/* When the elements of a subtree are shuffled, refitting alone would leave
+ that subtree's boxes overlapping; the updater rebuilds that subtree (and only
+ that subtree) to match the hierarchy built from scratch. */
+GTEST_TEST(BvhUpdaterTest, RebuildDegradedSubtree) {
+  /* A row of disjoint tetrahedra along the x-axis; tetrahedron i is at x = i.
+   */
+  const int kNumElements = 64;
+  vector<Vector3d> vertices;
+  vector<VolumeElement> elements;
+  for (int i = 0; i < kNumElements; ++i) {
+    const Vector3d p(i, 0, 0);
+    vertices.push_back(p);
+    vertices.push_back(p + Vector3d(0.5, 0, 0));
+    vertices.push_back(p + Vector3d(0, 0.5, 0));
+    vertices.push_back(p + Vector3d(0, 0, 0.5));
+    elements.emplace_back(4 * i, 4 * i + 1, 4 * i + 2, 4 * i + 3);
+  }
+  VolumeMesh<double> mesh(std::move(elements), std::move(vertices));
+  Bvh<Aabb, VolumeMesh<double>> bvh(mesh);
+  BvhUpdater<VolumeMesh<double>> updater(&mesh, &bvh);
+  MeshDeformer<VolumeMesh<double>> deformer(&mesh);
+  const auto& root = bvh.root_node();
+  vector<int> right_elements;
+  GetLeafElements(root.right(), &right_elements);
+
+  /* Interleave the two quarters of the row that make up the left subtree, so
+   that both of the left subtree's children span all of it; the right half of
+   the row doesn't move. */
+  const int kQuarter = kNumElements / 4;
+  VectorXd p_MVs(3 * mesh.num_vertices());
+  for (int v = 0; v < mesh.num_vertices(); ++v) {
+    Vector3d p_MV = mesh.vertex(v);
+    const int i = v / 4;
+    if (i < kQuarter) {
+      p_MV.x() += i;
+    } else if (i < 2 * kQuarter) {
+      p_MV.x() += i - 2 * kQuarter + 1;
+    }
+    p_MVs.segment<3>(3 * v) = p_MV;
+  }
+  deformer.SetAllPositions(p_MVs);
+  updater.Update();
+
+  ExpectTightTree(mesh, root);
+  vector<int> updated_right_elements;
+  GetLeafElements(root.right(), &updated_right_elements);
+  EXPECT_EQ(updated_right_elements, right_elements);
+
+  const Bvh<Aabb, VolumeMesh<double>> expected(mesh);
+  vector<int> leaf_elements;
+  GetLeafElements(root, &leaf_elements);
+  vector<int> expected_leaf_elements;
+  GetLeafElements(expected.root_node(), &expected_leaf_elements);
+  EXPECT_EQ(leaf_elements, expected_leaf_elements);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -318,12 +318,8 @@ GTEST_TEST(ContactSurfaceTest, TestCopy) {
             HydroelasticContactRepresentation::kTriangle);
 
   auto test_copy = [](const auto& source_mesh, const auto& target_mesh) {
-    // They have different addresses; it is a deep copy.
-    EXPECT_NE(&source_mesh, &target_mesh);
-    // They are structurally similar; this doesn't confirm that all the values
-    // are copied -- that should be tested by the mesh type's unit tests.
-    EXPECT_EQ(source_mesh.num_elements(), target_mesh.num_elements());
-    EXPECT_EQ(source_mesh.num_vertices(), target_mesh.num_vertices());
+    // They have the same address; the immutable mesh is shared, not copied.
+    EXPECT_EQ(&source_mesh, &target_mesh);
   };
 
   // Copy constructor.
@@ -371,6 +367,14 @@ GTEST_TEST(ContactSurfaceTest, TestCopy) {
   copy_poly = original_tri;
   ASSERT_EQ(copy_poly.representation(),
             HydroelasticContactRepresentation::kTriangle);
+
+  // The shared data outlives the surface it was copied from.
+  {
+    auto temp = std::make_unique<ContactSurface<double>>(
+        TestContactSurface<PolygonSurfaceMesh<double>>(false /*test*/));
+    copy_poly = *temp;
+  }
+  EXPECT_TRUE(copy_poly.Equal(original_poly));
 }
 
 // TODO(DamrongGuoy): This test should also be run with a polygon
@@ -385,13 +389,15 @@ GTEST_TEST(ContactSurfaceTest, TestEqual) {
   auto surface0 = ContactSurface<double>(surface);
   EXPECT_TRUE(surface.Equal(surface0));
 
-  // To get a "different" mesh, we'll copy the current contact surface so it's
-  // all the same and then sneak around the const access to change the mesh by
-  // reversing its winding. That will be sufficient to show mesh differences
-  // imply constact surface differences (even if all else is bit identical).
-  auto surface1 = ContactSurface<double>(surface);
-  const_cast<TriangleSurfaceMesh<double>&>(surface1.tri_mesh_W())
-      .ReverseFaceWinding();
+  // To get a "different" mesh, we'll copy the current contact surface's mesh
+  // and field so it's all the same and then change the mesh by reversing its
+  // winding. That will be sufficient to show mesh differences imply contact
+  // surface differences (even if all else is bit identical).
+  auto mesh1 = make_unique<TriangleSurfaceMesh<double>>(surface.tri_mesh_W());
+  mesh1->ReverseFaceWinding();
+  auto field1 = surface.tri_e_MN().CloneAndSetMesh(mesh1.get());
+  auto surface1 = ContactSurface<double>(surface.id_M(), surface.id_N(),
+                                         std::move(mesh1), std::move(field1));
   EXPECT_FALSE(surface.Equal(surface1));
 
   // Equal mesh, Different pressure field.
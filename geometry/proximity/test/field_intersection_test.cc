@@ -204,9 +204,11 @@ TEST_F(FieldIntersectionLowLevelTest, IntersectTetrahedra) {
                                       identity_X_MN, &plane_M);
   ASSERT_TRUE(success);
 
-  const std::vector<Vector3d> polygon_M = IntersectTetrahedra(
-      first_element_in_field0, field0_M_.mesh(), first_element_in_field1,
-      field1_N_.mesh(), identity_X_MN, plane_M);
+  std::vector<Vector3d> polygon_M;
+  std::vector<Vector3d> scratch_M;
+  IntersectTetrahedra(first_element_in_field0, field0_M_.mesh(),
+                      first_element_in_field1, field1_N_.mesh(), identity_X_MN,
+                      plane_M, &polygon_M, &scratch_M);
 
   ASSERT_EQ(polygon_M.size(), 8);
 
@@ -253,9 +255,13 @@ TEST_F(FieldIntersectionLowLevelTest, IntersectTetrahedra_NoIntersection) {
   // This plane is far away from the two tetrahedra.
   const Plane<double> plane_M{Vector3d::UnitZ(), 5.0 * Vector3d::UnitZ()};
 
-  const std::vector<Vector3d> polygon_M = IntersectTetrahedra(
-      first_element_in_mesh0, field0_M_.mesh(), first_element_in_mesh1,
-      field1_N_.mesh(), RigidTransformd::Identity(), plane_M);
+  // Stale contents of the output are discarded.
+  std::vector<Vector3d> polygon_M(3, Vector3d::Zero());
+  std::vector<Vector3d> scratch_M;
+  IntersectTetrahedra(first_element_in_mesh0, field0_M_.mesh(),
+                      first_element_in_mesh1, field1_N_.mesh(),
+                      RigidTransformd::Identity(), plane_M, &polygon_M,
+                      &scratch_M);
 
   EXPECT_EQ(polygon_M.size(), 0);
 }
@@ -532,6 +538,48 @@ TEST_F(FieldIntersectionHighLevelTest,
   }
 }
 
+// Starting each traversal from the previous one's front doesn't change the
+// contact surface, as the two geometries move a little, jump, and separate.
+GTEST_TEST(FieldIntersectionTest, ComputeContactSurfaceWithFront) {
+  const Sphere sphere0(0.03);
+  const VolumeMesh<double> mesh0_F = MakeSphereVolumeMesh<double>(
+      sphere0, 0.005, TessellationStrategy::kDenseInteriorVertices);
+  const VolumeMeshFieldLinear<double, double> field0_F =
+      MakeSpherePressureField<double>(sphere0, &mesh0_F, 1e5);
+  const Bvh<Obb, VolumeMesh<double>> bvh0_F(mesh0_F);
+  const Sphere sphere1(0.02);
+  const VolumeMesh<double> mesh1_G = MakeSphereVolumeMesh<double>(
+      sphere1, 0.005, TessellationStrategy::kDenseInteriorVertices);
+  const VolumeMeshFieldLinear<double, double> field1_G =
+      MakeSpherePressureField<double>(sphere1, &mesh1_G, 1e5);
+  const Bvh<Obb, VolumeMesh<double>> bvh1_G(mesh1_G);
+  const GeometryId id0 = GeometryId::get_new_id();
+  const GeometryId id1 = GeometryId::get_new_id();
+
+  BvttFront front;
+  for (const double x : {0.04, 0.0401, 0.0402, 0.03, 0.0301, 0.1, 0.04}) {
+    const RigidTransformd X_WF = RigidTransformd::Identity();
+    const RigidTransformd X_WG(RollPitchYawd(x, 2 * x, 3 * x),
+                               Vector3d(x, 0.001, 0));
+    const std::unique_ptr<ContactSurface<double>> expected =
+        ComputeContactSurfaceFromCompliantVolumes(
+            id0, field0_F, bvh0_F, X_WF, id1, field1_G, bvh1_G, X_WG,
+            HydroelasticContactRepresentation::kPolygon);
+    const std::unique_ptr<ContactSurface<double>> surface =
+        ComputeContactSurfaceFromCompliantVolumes(
+            id0, field0_F, bvh0_F, X_WF, id1, field1_G, bvh1_G, X_WG,
+            HydroelasticContactRepresentation::kPolygon, &front);
+    if (x < 0.05) {
+      ASSERT_NE(expected, nullptr);
+      ASSERT_NE(surface, nullptr);
+      EXPECT_TRUE(surface->Equal(*expected));
+    } else {
+      EXPECT_EQ(expected, nullptr);
+      EXPECT_EQ(surface, nullptr);
+    }
+  }
+}
+
 // Smoke tests that AutoDiffXd can build. No checking on the values of
 // derivatives.
 TEST_F(FieldIntersectionHighLevelTest,
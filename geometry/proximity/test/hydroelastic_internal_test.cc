@@ -1,13 +1,19 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
 #include <cmath>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <functional>
 #include <limits>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
+#include "drake/common/find_cache.h"
 #include "drake/common/find_resource.h"
 #include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
@@ -45,10 +51,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
     SoftMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable data is shared, not duplicated.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -67,10 +73,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
   {
     SoftMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // The immutable data is shared, not duplicated.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -1209,6 +1215,98 @@ TEST_F(HydroelasticSoftGeometryTest, Mesh) {
   }
 }
 
+// Returns the names of the entries of the on-disk soft mesh cache.
+std::set<std::string> GetSoftMeshCacheEntries() {
+  const drake::internal::PathOrError cache =
+      drake::internal::FindOrCreateCache("hydroelastic");
+  DRAKE_DEMAND(cache.error.empty());
+  std::set<std::string> entries;
+  for (const auto& entry : std::filesystem::directory_iterator(cache.abspath)) {
+    entries.insert(entry.path().string());
+  }
+  return entries;
+}
+
+// Soft meshes are shared within the process and, when enabled, stored on disk
+// across processes; neither changes the generated representation.
+TEST_F(HydroelasticSoftGeometryTest, SoftMeshCache) {
+  const Mesh mesh_specification(
+      FindResourceOrThrow("drake/geometry/test/non_convex_mesh.vtk"));
+  // Use moduli that no other test uses, so that these keys are new.
+  ProximityProperties properties;
+  AddCompliantHydroelasticProperties(0.1, 3e8, &properties);
+  const std::set<std::string> entries_before = GetSoftMeshCacheEntries();
+
+  // The on-disk cache is off by default.
+  ASSERT_EQ(::unsetenv("DRAKE_HYDROELASTIC_CACHE"), 0);
+  MakeSoftRepresentation(mesh_specification, properties);
+  EXPECT_EQ(GetSoftMeshCacheEntries(), entries_before);
+
+  // When it is on, it only holds Mesh and Convex shapes, whose meshes are
+  // costly to generate; primitives are only shared in memory.
+  ASSERT_EQ(::setenv("DRAKE_HYDROELASTIC_CACHE", "1", 1), 0);
+  const Sphere sphere(0.25);
+  std::optional<SoftGeometry> soft_sphere =
+      MakeSoftRepresentation(sphere, properties);
+  EXPECT_EQ(&MakeSoftRepresentation(sphere, properties)->mesh(),
+            &soft_sphere->mesh());
+  EXPECT_EQ(GetSoftMeshCacheEntries(), entries_before);
+
+  std::optional<SoftGeometry> original =
+      MakeSoftRepresentation(mesh_specification, properties);
+  const VolumeMesh<double> expected_mesh = original->mesh();
+  const std::vector<double> expected_values =
+      original->pressure_field().values();
+
+  // Equal keys share a mesh; a different modulus is a different key.
+  std::optional<SoftGeometry> shared =
+      MakeSoftRepresentation(mesh_specification, properties);
+  EXPECT_EQ(&shared->mesh(), &original->mesh());
+  EXPECT_EQ(&shared->bvh(), &original->bvh());
+  ProximityProperties stiffer;
+  AddCompliantHydroelasticProperties(0.1, 4e8, &stiffer);
+  EXPECT_NE(&MakeSoftRepresentation(mesh_specification, stiffer)->mesh(),
+            &original->mesh());
+
+  // Exactly one new entry was written for each key.
+  std::set<std::string> new_entries;
+  for (const std::string& entry : GetSoftMeshCacheEntries()) {
+    if (entries_before.count(entry) == 0) new_entries.insert(entry);
+  }
+  ASSERT_EQ(new_entries.size(), 2);
+
+  // Once no geometry refers to the meshes, they are read back from disk. To
+  // prove that, we tamper with the first pressure value of each entry.
+  original.reset();
+  shared.reset();
+  const int num_vertices = expected_mesh.num_vertices();
+  const int num_elements = expected_mesh.num_elements();
+  const std::streamoff first_value_offset =
+      3 * sizeof(int64_t) + num_vertices * 3 * sizeof(double) +
+      num_elements * 4 * sizeof(int);
+  const double tampered_value = 1234.5;
+  for (const std::string& entry : new_entries) {
+    std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(first_value_offset);
+    file.write(reinterpret_cast<const char*>(&tampered_value), sizeof(double));
+  }
+  std::optional<SoftGeometry> from_disk =
+      MakeSoftRepresentation(mesh_specification, properties);
+  EXPECT_TRUE(from_disk->mesh().Equal(expected_mesh));
+  EXPECT_EQ(from_disk->pressure_field().EvaluateAtVertex(0), tampered_value);
+  from_disk.reset();
+
+  // Malformed entries are regenerated.
+  for (const std::string& entry : new_entries) {
+    std::ofstream(entry, std::ios::binary) << "not a mesh";
+  }
+  std::optional<SoftGeometry> regenerated =
+      MakeSoftRepresentation(mesh_specification, properties);
+  EXPECT_TRUE(regenerated->mesh().Equal(expected_mesh));
+  EXPECT_EQ(regenerated->pressure_field().values(), expected_values);
+  ASSERT_EQ(::unsetenv("DRAKE_HYDROELASTIC_CACHE"), 0);
+}
+
 // Test suite for testing the common failure conditions for generating soft
 // geometry. Specifically, they need to be tessellated into a tet mesh
 // and define a pressure field. This actively excludes Mesh because soft Mesh
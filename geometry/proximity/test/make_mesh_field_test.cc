@@ -4,6 +4,7 @@
 
 #include "drake/common/find_resource.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/make_capsule_mesh.h"
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
 #include "drake/geometry/shape_specification.h"
 
@@ -46,6 +47,20 @@ TYPED_TEST(MakeVolumeMeshPressureFieldTest, PressureOnNonConvexMesh) {
   }
 }
 
+// Tests that computing the field in parallel gives the same values as the
+// serial computation. The mesh is large enough to be worth parallelizing.
+GTEST_TEST(MakeVolumeMeshPressureFieldTest, Parallelize) {
+  const VolumeMesh<double> mesh =
+      MakeCapsuleVolumeMesh<double>(Capsule(0.5, 2.0), 0.1);
+  const double kHydroelasticModulus = 1e7;
+  const VolumeMeshFieldLinear<double, double> serial =
+      MakeVolumeMeshPressureField(&mesh, kHydroelasticModulus);
+  const VolumeMeshFieldLinear<double, double> parallel =
+      MakeVolumeMeshPressureField(&mesh, kHydroelasticModulus,
+                                  /* parallelize = */ true);
+  EXPECT_EQ(parallel.values(), serial.values());
+}
+
 // Tests that an input mesh without interior vertices will throw. For
 // simplicity, use double as the representative scalar type.
 GTEST_TEST(MakeVolumeMeshPressureFieldTest, NoInteriorVertex) {
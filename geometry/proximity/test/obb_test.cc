@@ -1,10 +1,13 @@
 #include "drake/geometry/proximity/obb.h"
 
+#include <vector>
+
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/proximity/aabb.h"
+#include "drake/geometry/proximity/boxes_overlap.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
@@ -1001,6 +1004,75 @@ GTEST_TEST(ObbTest, TestObbOverlap) {
   }
 }
 
+// Tests the batched form of BoxesOverlap() against the single-pair form, using
+// the same just-touching configurations as TestObbOverlap (so that every
+// separating axis is exercised), in batches of every size.
+GTEST_TEST(ObbTest, BatchedBoxesOverlap) {
+  const Obb a(RigidTransformd::Identity(), Vector3d(2, 4, 3));
+  const Obb b(RigidTransformd::Identity(), Vector3d(3.5, 2, 1.5));
+  std::vector<RigidTransformd> poses{RigidTransformd::Identity()};
+  for (bool expect_overlap : {false, true}) {
+    for (int axis = 0; axis < 3; ++axis) {
+      poses.push_back(CalcCornerTransform(a, b, axis, expect_overlap));
+      poses.push_back(
+          CalcCornerTransform(b, a, axis, expect_overlap).inverse());
+    }
+    for (int a_axis = 0; a_axis < 3; ++a_axis) {
+      for (int b_axis = 0; b_axis < 3; ++b_axis) {
+        poses.push_back(
+            CalcEdgeTransform(a, b, a_axis, b_axis, expect_overlap));
+      }
+    }
+  }
+
+  for (int batch_size = 1; batch_size <= kBoxPairBatchSize; ++batch_size) {
+    for (int start = 0; start + batch_size <= static_cast<int>(poses.size());
+         ++start) {
+      BoxPairBatch batch;
+      int expected = 0;
+      for (int k = 0; k < batch_size; ++k) {
+        const RigidTransformd& X_AB = poses[start + k];
+        batch.Add(a.half_width(), b.half_width(), X_AB);
+        if (BoxesOverlap(a.half_width(), b.half_width(), X_AB)) {
+          expected |= 1 << k;
+        }
+      }
+      EXPECT_EQ(BoxesOverlap(batch), expected);
+    }
+  }
+
+  // Clearing the batch lets it be reused.
+  BoxPairBatch batch;
+  // A new batch has all of its lanes zeroed.
+  EXPECT_TRUE((batch.half_size_a == 0).all());
+  EXPECT_TRUE((batch.half_size_b == 0).all());
+  EXPECT_TRUE((batch.p_AB == 0).all());
+  EXPECT_TRUE((batch.R_AB == 0).all());
+  batch.Add(a.half_width(), b.half_width(), poses[0]);
+  batch.clear();
+  EXPECT_EQ(BoxesOverlap(batch), 0);
+  batch.Add(a.half_width(), b.half_width(), poses[0]);
+  EXPECT_EQ(BoxesOverlap(batch), 1);
+
+  // In a partially filled batch, the unused lanes don't affect the result,
+  // whether they are zeroed or hold pairs from before the last clear().
+  const RigidTransformd X_AB_far(Vector3d(100, 0, 0));
+  ASSERT_FALSE(BoxesOverlap(a.half_width(), b.half_width(), X_AB_far));
+  BoxPairBatch partial;
+  partial.Add(a.half_width(), b.half_width(), X_AB_far);
+  EXPECT_EQ(BoxesOverlap(partial), 0);
+  partial.Add(a.half_width(), b.half_width(), poses[0]);
+  EXPECT_EQ(BoxesOverlap(partial), 0b10);
+  partial.clear();
+  for (int k = 0; k < kBoxPairBatchSize; ++k) {
+    partial.Add(a.half_width(), b.half_width(), poses[0]);
+  }
+  EXPECT_EQ(BoxesOverlap(partial), (1 << kBoxPairBatchSize) - 1);
+  partial.clear();
+  partial.Add(a.half_width(), b.half_width(), X_AB_far);
+  EXPECT_EQ(BoxesOverlap(partial), 0);
+}
+
 // Tests the Obb-Aabb intersection.  We rely on TestObbOverlap to cover all the
 // subtleties of the test. This just confirms that the Aabb is accounted for
 // and reports contact. So, we'll pick a couple of arbitrary poses to trigger
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <filesystem>
 #include <limits>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -338,6 +339,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic_geometries_.RemoveGeometry(id);
     hydroelastic_geometries_.MaybeAddGeometry(geometry.shape(), id,
                                               new_properties);
+    // The recorded traversals may refer to the old representation.
+    bvtt_fronts_.clear();
     const RigidTransformd X_WG = GetX_WG(id, geometry.is_dynamic());
     geometries_for_deformable_contact_.RemoveGeometry(id);
     geometries_for_deformable_contact_.MaybeAddRigidGeometry(
@@ -369,6 +372,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     }
     hydroelastic_geometries_.RemoveGeometry(id);
     geometries_for_deformable_contact_.RemoveGeometry(id);
+    bvtt_fronts_.clear();
   }
 
   void RemoveDeformableGeometry(GeometryId id) {
@@ -727,10 +731,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       HydroelasticContactRepresentation representation,
       const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
     vector<ContactSurface<T>> surfaces;
+    std::lock_guard<std::mutex> lock(bvtt_fronts_mutex_);
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs,
                                        &hydroelastic_geometries_,
-                                       representation, &surfaces};
+                                       representation, &surfaces,
+                                       &bvtt_fronts_};
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, hydroelastic::Callback<T>);
@@ -739,6 +745,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // anchored against anchored because those pairs are implicitly filtered.
     FclCollide(dynamic_tree_, anchored_tree_, &data, hydroelastic::Callback<T>);
 
+    // Only keep the fronts of the pairs considered by this query.
+    bvtt_fronts_ = std::move(data.fronts);
+
     std::sort(surfaces.begin(), surfaces.end(), OrderContactSurface<T>);
 
     return surfaces;
@@ -754,11 +763,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     DRAKE_DEMAND(surfaces != nullptr);
     DRAKE_DEMAND(point_pairs != nullptr);
 
+    std::lock_guard<std::mutex> lock(bvtt_fronts_mutex_);
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackWithFallbackData<T> data{
         hydroelastic::CallbackData<T>{&collision_filter_, &X_WGs,
                                       &hydroelastic_geometries_, representation,
-                                      surfaces},
+                                      surfaces, &bvtt_fronts_},
         point_pairs};
 
     // Dynamic vs dynamic and dynamic vs anchored represent all the geometries
@@ -768,6 +778,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     FclCollide(dynamic_tree_, anchored_tree_, &data,
                hydroelastic::CallbackWithFallback<T>);
 
+    // Only keep the fronts of the pairs considered by this query.
+    bvtt_fronts_ = std::move(data.data.fronts);
+
     std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
 
     std::sort(point_pairs->begin(), point_pairs->end(), OrderPointPair<T>);
@@ -941,6 +954,14 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
 
+  // The bounding volume tree traversal fronts of the most recent contact
+  // surface query, from which the next query starts the traversals of the
+  // same pairs of geometries (see BvttFront). This is a cache that doesn't
+  // affect any results; it is neither copied nor converted to other scalars,
+  // and the mutex serializes its use by concurrent queries.
+  mutable hydroelastic::BvttFronts bvtt_fronts_;
+  mutable std::mutex bvtt_fronts_mutex_;
+
   // All of the geometries that produce contacts that involve deformable
   // geometries. This includes deformable geometries as well as rigid geometry
   // representations that participate in contacts with deformable geometries.
@@ -251,6 +251,9 @@ class ProximityEngine {
       const;
 
   /* Implementation of GeometryState::ComputeContactSurfaces().
+   Each call starts the bounding volume tree traversal of each pair of
+   geometries from where the previous call's traversal of the pair ended
+   (unless they have since moved too much); this doesn't change the result.
    @param X_WGs the current poses of all geometries in World in the
                 current scalar type, keyed on each geometry's GeometryId.  */
   template <typename T1 = T>
@@ -262,6 +265,8 @@ class ProximityEngine {
       const;
 
   /* Implementation of GeometryState::ComputeContactSurfacesWithFallback().
+   It reuses the previous call's traversals just as ComputeContactSurfaces()
+   does.
    @param X_WGs the current poses of all geometries in World in the
                 current scalar type, keyed on each geometry's GeometryId.  */
   template <typename T1 = T>
@@ -238,6 +238,23 @@ void QueryObject<T>::RenderLabelImage(const ColorRenderCamera& camera,
   return state.RenderLabelImage(camera, parent_frame, X_PC, label_image_out);
 }
 
+template <typename T>
+void QueryObject<T>::RenderImages(const ColorRenderCamera& color_camera,
+                                  const DepthRenderCamera& depth_camera,
+                                  FrameId parent_frame,
+                                  const RigidTransformd& X_PC,
+                                  ImageRgba8U* color_image_out,
+                                  ImageDepth32F* depth_image_out,
+                                  ImageLabel16I* label_image_out) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.RenderImages(color_camera, depth_camera, parent_frame, X_PC,
+                            color_image_out, depth_image_out,
+                            label_image_out);
+}
+
 template <typename T>
 const render::RenderEngine* QueryObject<T>::GetRenderEngineByName(
     const std::string& name) const {
@@ -785,6 +785,36 @@ class QueryObject {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Renders any combination of color, depth, and label images for a pair of
+   cameras rigidly affixed to the same camera body, posed with respect to the
+   indicated parent frame P. All of the requested images are submitted to the
+   render engine(s) as a single RenderEngine::RenderImages() batch, so an engine
+   can share the per-call work of producing them (e.g., by posing the camera
+   once and reading the images back together). This batches the calls only;
+   each image type is still drawn in its own pass, not as one
+   multiple-render-target pass. When both cameras name the same renderer and
+   their sensors share a pose, the images are requested from a single
+   viewpoint.
+
+   The result is the same as calling RenderColorImage(), RenderDepthImage(),
+   and RenderLabelImage() individually for the requested images.
+
+   @param color_camera          The camera for the color and label images.
+   @param depth_camera          The camera for the depth image.
+   @param parent_frame          The id for the camera's parent frame.
+   @param X_PC                  The pose of the camera body in the parent frame.
+   @param[out] color_image_out  The rendered color image, or `nullptr` if no
+                                color image is wanted.
+   @param[out] depth_image_out  The rendered depth image, or `nullptr` if no
+                                depth image is wanted.
+   @param[out] label_image_out  The rendered label image, or `nullptr` if no
+                                label image is wanted. */
+  void RenderImages(const render::ColorRenderCamera& color_camera,
+                    const render::DepthRenderCamera& depth_camera,
+                    FrameId parent_frame, const math::RigidTransformd& X_PC,
+                    systems::sensors::ImageRgba8U* color_image_out,
+                    systems::sensors::ImageDepth32F* depth_image_out,
+                    systems::sensors::ImageLabel16I* label_image_out) const;
 
   /** Returns the named render engine, if it exists. The RenderEngine is
    guaranteed to be up to date w.r.t. the poses and data in the context. */
@@ -11,32 +11,32 @@ using std::vector;
 
 template <typename T>
 const Vector3<T>& ContactSurface<T>::EvaluateGradE_M_W(int index) const {
-  if (grad_eM_W_ == nullptr) {
+  if (data_->grad_eM_W == nullptr) {
     throw std::runtime_error(
         "ContactSurface::EvaluateGradE_M_W() invalid; no gradient values "
         "stored. Mesh M may be rigid, or the constituent gradients weren't "
         "requested.");
   }
-  return (*grad_eM_W_)[index];
+  return (*data_->grad_eM_W)[index];
 }
 
 template <typename T>
 const Vector3<T>& ContactSurface<T>::EvaluateGradE_N_W(int index) const {
-  if (grad_eN_W_ == nullptr) {
+  if (data_->grad_eN_W == nullptr) {
     throw std::runtime_error(
         "ContactSurface::EvaluateGradE_N_W() invalid; no gradient values "
         "stored. Mesh N may be rigid, or the constituent gradients weren't "
         "requested.");
   }
-  return (*grad_eN_W_)[index];
+  return (*data_->grad_eN_W)[index];
 }
 
 template <typename T>
 bool ContactSurface<T>::Equal(const ContactSurface<T>& surface) const {
   // Confirm we have the same representation. Technically, mesh and field
   // representations are linked, but we'll test both to be safe.
-  if (this->mesh_W_.index() != surface.mesh_W_.index()) return false;
-  if (this->e_MN_.index() != surface.e_MN_.index()) return false;
+  if (data_->mesh_W.index() != surface.data_->mesh_W.index()) return false;
+  if (data_->e_MN.index() != surface.data_->e_MN.index()) return false;
 
   if (is_triangle()) {
     if (!this->tri_mesh_W().Equal(surface.tri_mesh_W())) return false;
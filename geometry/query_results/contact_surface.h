@@ -155,59 +155,33 @@ enum class HydroelasticContactRepresentation { kTriangle, kPolygon };
 
   We use the barycentric coordinates to evaluate the field values.
 
+  <h2> Copying </h2>
+
+  The mesh, field, and gradients of a %ContactSurface are immutable once it is
+  constructed, so copies of a %ContactSurface share them instead of duplicating
+  them. Copying is therefore cheap regardless of the size of the surface, and
+  the data lives as long as any copy does.
+
   @tparam_nonsymbolic_scalar
  */
 template <typename T>
 class ContactSurface {
  public:
-  ContactSurface(const ContactSurface& surface) { *this = surface; }
-
-  // TODO(SeanCurtis-TRI) Copy assignment, both constructors, and SwapMAndN
-  //  would all be better defined in the .cc file. The primary reason they are
-  //  not is that multibody::HydroelasticContactInfo and
-  //  multibody::ContactResultsToLcm unit tests
-  //  (which explicitly declare support for T = symbolic::Expression), blindly
-  //  assume that the contact surface likewise supports symbolic::Expression
-  //  (even though that is not the case). Their only meaningful actions are to
-  //  copy/create instances. By leaving these functions in the header, those
-  //  workflows continue to work. Ideally, they'd protect themselves against the
-  //  fact that they are instantiating types that don't *truly* support
-  //  symbolic::Expression and these functions can move into the .cc file.
-  //  This has a downstream effect of requiring the surface meshes
-  //  ReverseFaceWinding methods defined in the header as it gets invoked by
-  //  SwapMAndN.
-
-  ContactSurface& operator=(const ContactSurface& surface) {
-    if (&surface == this) return *this;
-
-    id_M_ = surface.id_M_;
-    id_N_ = surface.id_N_;
-    if (surface.is_triangle()) {
-      mesh_W_ = std::make_unique<TriangleSurfaceMesh<T>>(surface.tri_mesh_W());
-      // We can't simply copy the mesh fields; the copies must contain pointers
-      // to the new mesh. So, we use CloneAndSetMesh() instead.
-      e_MN_ = surface.tri_e_MN().CloneAndSetMesh(&tri_mesh_W());
-    } else {
-      mesh_W_ = std::make_unique<PolygonSurfaceMesh<T>>(surface.poly_mesh_W());
-      // We can't simply copy the mesh fields; the copies must contain pointers
-      // to the new mesh. So, we use CloneAndSetMesh() instead.
-      e_MN_ = surface.poly_e_MN().CloneAndSetMesh(&poly_mesh_W());
-    }
-
-    if (surface.grad_eM_W_) {
-      grad_eM_W_ =
-          std::make_unique<std::vector<Vector3<T>>>(*surface.grad_eM_W_);
-    }
-    if (surface.grad_eN_W_) {
-      grad_eN_W_ =
-          std::make_unique<std::vector<Vector3<T>>>(*surface.grad_eN_W_);
-    }
-
-    return *this;
-  }
-
-  ContactSurface(ContactSurface&&) = default;
-  ContactSurface& operator=(ContactSurface&&) = default;
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContactSurface)
+
+  // TODO(SeanCurtis-TRI) Both constructors and SwapMAndN would be better
+  //  defined in the .cc file. The primary reason they are not is that
+  //  multibody::HydroelasticContactInfo and multibody::ContactResultsToLcm unit
+  //  tests (which explicitly declare support for T = symbolic::Expression),
+  //  blindly assume that the contact surface likewise supports
+  //  symbolic::Expression (even though that is not the case). Their only
+  //  meaningful actions are to copy/create instances. By leaving these
+  //  functions in the header, those workflows continue to work. Ideally, they'd
+  //  protect themselves against the fact that they are instantiating types that
+  //  don't *truly* support symbolic::Expression and these functions can move
+  //  into the .cc file. This has a downstream effect of requiring the surface
+  //  meshes ReverseFaceWinding methods defined in the header as it gets invoked
+  //  by SwapMAndN.
 
   /** @name Constructors
 
@@ -326,7 +300,7 @@ class ContactSurface {
    and offered as convenient sugar. */
   bool is_triangle() const {
     return std::holds_alternative<std::unique_ptr<TriangleSurfaceMesh<T>>>(
-        mesh_W_);
+        data_->mesh_W);
   }
 
   /** Reports the representation mode of this contact surface. If accessing the
@@ -342,7 +316,7 @@ class ContactSurface {
    @pre `is_triangle()` returns `true`. */
   const TriangleSurfaceMesh<T>& tri_mesh_W() const {
     DRAKE_DEMAND(is_triangle());
-    return *std::get<std::unique_ptr<TriangleSurfaceMesh<T>>>(mesh_W_);
+    return *std::get<std::unique_ptr<TriangleSurfaceMesh<T>>>(data_->mesh_W);
   }
 
   /** Returns a reference to the scalar field eₘₙ for the _triangle_ mesh.
@@ -350,7 +324,7 @@ class ContactSurface {
   const TriangleSurfaceMeshFieldLinear<T, T>& tri_e_MN() const {
     DRAKE_DEMAND(is_triangle());
     return *std::get<std::unique_ptr<TriangleSurfaceMeshFieldLinear<T, T>>>(
-        e_MN_);
+        data_->e_MN);
   }
 
   /** Returns a reference to the _polygonal_ surface mesh whose vertex
@@ -358,7 +332,7 @@ class ContactSurface {
    @pre `is_triangle()` returns `false`. */
   const PolygonSurfaceMesh<T>& poly_mesh_W() const {
     DRAKE_DEMAND(!is_triangle());
-    return *std::get<std::unique_ptr<PolygonSurfaceMesh<T>>>(mesh_W_);
+    return *std::get<std::unique_ptr<PolygonSurfaceMesh<T>>>(data_->mesh_W);
   }
 
   /** Returns a reference to the scalar field eₘₙ for the _polygonal_ mesh.
@@ -366,7 +340,7 @@ class ContactSurface {
   const PolygonSurfaceMeshFieldLinear<T, T>& poly_e_MN() const {
     DRAKE_DEMAND(!is_triangle());
     return *std::get<std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>>>(
-        e_MN_);
+        data_->e_MN);
   }
 
   //@}
@@ -392,10 +366,10 @@ class ContactSurface {
   //@{
 
   /** @returns `true` if `this` contains values for ∇eₘ.  */
-  bool HasGradE_M() const { return grad_eM_W_ != nullptr; }
+  bool HasGradE_M() const { return data_->grad_eM_W != nullptr; }
 
   /** @returns `true` if `this` contains values for ∇eₙ.  */
-  bool HasGradE_N() const { return grad_eN_W_ != nullptr; }
+  bool HasGradE_N() const { return data_->grad_eN_W != nullptr; }
 
   /** Returns the value of ∇eₘ for the face with index `index`.
    @throws std::exception if HasGradE_M() returns false.
@@ -425,47 +399,54 @@ class ContactSurface {
       std::variant<std::unique_ptr<TriangleSurfaceMeshFieldLinear<T, T>>,
                    std::unique_ptr<PolygonSurfaceMeshFieldLinear<T, T>>>;
 
+  // The mesh, field, and gradients, which copies of a ContactSurface share.
+  struct Data {
+    // The surface mesh of the contact surface 𝕊ₘₙ between M and N.
+    MeshVariant mesh_W;
+
+    // Represents the scalar field eₘₙ on the surface mesh.
+    FieldVariant e_MN;
+
+    // The gradients of the pressure fields eₘ and eₙ sampled on the contact
+    // surface. There is one gradient value *per contact surface face*.
+    // These quantities may not be defined if the gradient is not well-defined.
+    // See class documentation for elaboration.
+    std::unique_ptr<std::vector<Vector3<T>>> grad_eM_W;
+    std::unique_ptr<std::vector<Vector3<T>>> grad_eN_W;
+  };
+
   // Main delegation constructor. The extra int parameter is to introduce a
   // disambiguation mechanism.
   ContactSurface(GeometryId id_M, GeometryId id_N, MeshVariant mesh_W,
                  FieldVariant e_MN,
                  std::unique_ptr<std::vector<Vector3<T>>> grad_eM_W,
                  std::unique_ptr<std::vector<Vector3<T>>> grad_eN_W, int)
-      : id_M_(id_M),
-        id_N_(id_N),
-        mesh_W_(std::move(mesh_W)),
-        e_MN_(std::move(e_MN)),
-        grad_eM_W_(std::move(grad_eM_W)),
-        grad_eN_W_(std::move(grad_eN_W)) {
+      : id_M_(id_M), id_N_(id_N) {
+    Data data{std::move(mesh_W), std::move(e_MN), std::move(grad_eM_W),
+              std::move(grad_eN_W)};
     // If defined the gradient values must map 1-to-1 onto elements.
-    if (is_triangle()) {
-      DRAKE_THROW_UNLESS(grad_eM_W_ == nullptr ||
-                         static_cast<int>(grad_eM_W_->size()) ==
-                             tri_mesh_W().num_elements());
-      DRAKE_THROW_UNLESS(grad_eN_W_ == nullptr ||
-                         static_cast<int>(grad_eN_W_->size()) ==
-                             tri_mesh_W().num_elements());
-    } else {
-      DRAKE_THROW_UNLESS(grad_eM_W_ == nullptr ||
-                         static_cast<int>(grad_eM_W_->size()) ==
-                             poly_mesh_W().num_elements());
-      DRAKE_THROW_UNLESS(grad_eN_W_ == nullptr ||
-                         static_cast<int>(grad_eN_W_->size()) ==
-                             poly_mesh_W().num_elements());
-    }
-    if (id_N_ < id_M_) SwapMAndN();
+    const int num_elements = std::visit(
+        [](const auto& mesh) { return mesh->num_elements(); }, data.mesh_W);
+    DRAKE_THROW_UNLESS(data.grad_eM_W == nullptr ||
+                       static_cast<int>(data.grad_eM_W->size()) ==
+                           num_elements);
+    DRAKE_THROW_UNLESS(data.grad_eN_W == nullptr ||
+                       static_cast<int>(data.grad_eN_W->size()) ==
+                           num_elements);
+    if (id_N_ < id_M_) SwapMAndN(&data);
+    data_ = std::make_shared<const Data>(std::move(data));
   }
 
   // Swaps M and N (modifying the data in place to reflect the change).
-  void SwapMAndN() {
+  void SwapMAndN(Data* data) {
     std::swap(id_M_, id_N_);
     // TODO(SeanCurtis-TRI): Determine if this work is necessary. It is neither
     // documented nor tested that the face winding is guaranteed to be one way
     // or the other. Alternatively, this should be documented and tested.
-    std::visit([](auto&& mesh) { mesh->ReverseFaceWinding(); }, mesh_W_);
+    std::visit([](auto&& mesh) { mesh->ReverseFaceWinding(); }, data->mesh_W);
 
     // Note: the scalar field does not depend on the order of M and N.
-    std::swap(grad_eM_W_, grad_eN_W_);
+    std::swap(data->grad_eM_W, data->grad_eN_W);
   }
 
   // The id of the first geometry M.
@@ -473,18 +454,9 @@ class ContactSurface {
   // The id of the second geometry N.
   GeometryId id_N_;
 
-  // The surface mesh of the contact surface 𝕊ₘₙ between M and N.
-  MeshVariant mesh_W_;
-
-  // Represents the scalar field eₘₙ on the surface mesh.
-  FieldVariant e_MN_;
-
-  // The gradients of the pressure fields eₘ and eₙ sampled on the contact
-  // surface. There is one gradient value *per contact surface face*.
-  // These quantities may not be defined if the gradient is not well-defined.
-  // See class documentation for elaboration.
-  std::unique_ptr<std::vector<Vector3<T>>> grad_eM_W_;
-  std::unique_ptr<std::vector<Vector3<T>>> grad_eN_W_;
+  // The data is never modified after construction, so it is shared among
+  // copies rather than cloned.
+  std::shared_ptr<const Data> data_;
 
   template <typename U> friend class ContactSurfaceTester;
 };
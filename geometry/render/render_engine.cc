@@ -103,6 +103,50 @@ void RenderEngine::DoRenderLabelImage(const ColorRenderCamera&,
                   NiceTypeName::Get(*this)));
 }
 
+void RenderEngine::RenderImages(
+    const std::vector<ImageRenderRequest>& requests) {
+  for (const ImageRenderRequest& request : requests) {
+    if (request.color_image != nullptr || request.label_image != nullptr) {
+      if (!request.color_camera.has_value()) {
+        throw std::logic_error(
+            "Can't render a color or label image without a color camera.");
+      }
+      const CameraInfo& intrinsics = request.color_camera->core().intrinsics();
+      if (request.color_image != nullptr) {
+        ThrowIfInvalid(intrinsics, request.color_image, "color");
+      }
+      if (request.label_image != nullptr) {
+        ThrowIfInvalid(intrinsics, request.label_image, "label");
+      }
+    }
+    if (request.depth_image != nullptr) {
+      if (!request.depth_camera.has_value()) {
+        throw std::logic_error(
+            "Can't render a depth image without a depth camera.");
+      }
+      ThrowIfInvalid(request.depth_camera->core().intrinsics(),
+                     request.depth_image, "depth");
+    }
+  }
+  DoRenderImages(requests);
+}
+
+void RenderEngine::DoRenderImages(
+    const std::vector<ImageRenderRequest>& requests) {
+  for (const ImageRenderRequest& request : requests) {
+    UpdateViewpoint(request.X_WC);
+    if (request.color_image != nullptr) {
+      DoRenderColorImage(*request.color_camera, request.color_image);
+    }
+    if (request.depth_image != nullptr) {
+      DoRenderDepthImage(*request.depth_camera, request.depth_image);
+    }
+    if (request.label_image != nullptr) {
+      DoRenderLabelImage(*request.color_camera, request.label_image);
+    }
+  }
+}
+
 void RenderEngine::SetDefaultLightPosition(const Vector3<double>&) {}
 
 }  // namespace render
@@ -26,6 +26,33 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+/** Specifies the images to render from a single camera pose as part of a
+ batch of images rendered by RenderEngine::RenderImages(). Any subset of the
+ three image types can be requested; an image type that isn't wanted is
+ indicated by leaving its output image as `nullptr`.  */
+struct ImageRenderRequest {
+  /** The pose of the camera in the world frame; it plays the role of the pose
+   passed to RenderEngine::UpdateViewpoint().  */
+  math::RigidTransformd X_WC;
+
+  /** The camera for the color and label images. Required if either
+   `color_image` or `label_image` is non-null.  */
+  std::optional<ColorRenderCamera> color_camera;
+
+  /** The camera for the depth image. Required if `depth_image` is non-null.
+   */
+  std::optional<DepthRenderCamera> depth_camera;
+
+  /** The color image to render into, or `nullptr`.  */
+  systems::sensors::ImageRgba8U* color_image{};
+
+  /** The depth image to render into, or `nullptr`.  */
+  systems::sensors::ImageDepth32F* depth_image{};
+
+  /** The label image to render into, or `nullptr`.  */
+  systems::sensors::ImageLabel16I* label_image{};
+};
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -226,6 +253,23 @@ class RenderEngine : public ShapeReifier {
     DoRenderLabelImage(camera, label_image_out);
   }
 
+  /** Renders all of the images specified by `requests`, each from its own
+   camera pose. The result is the same as calling UpdateViewpoint() followed by
+   the corresponding Render*Image() methods for each request in turn, but a
+   derived class may render the batch more efficiently, e.g., by overlapping
+   the transfer of each image out of the GPU with the rendering of the next.
+   In particular, this is the preferred way to render the images of several
+   cameras observing the same scene.
+
+   Upon return, the viewpoint is that of the last request (as if
+   UpdateViewpoint() had been called with its pose).
+
+   @param requests  The images to render.
+   @throws std::exception if any requested image doesn't have its
+                          corresponding camera, or its size doesn't match the
+                          size declared in that camera.  */
+  void RenderImages(const std::vector<ImageRenderRequest>& requests);
+
   //@}
 
   /** Reports the render label value this render engine has been configured to
@@ -309,6 +353,15 @@ class RenderEngine : public ShapeReifier {
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** The NVI-function for rendering a batch of images. When RenderImages calls
+   this, it has already confirmed that every requested image has a camera and
+   that its size is consistent with the camera intrinsics.
+
+   The default implementation calls UpdateViewpoint() and the
+   DoRender*Image() methods for each request in turn. Derived classes can
+   override it to exploit the batch.  */
+  virtual void DoRenderImages(const std::vector<ImageRenderRequest>& requests);
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
@@ -339,6 +339,64 @@ GTEST_TEST(RenderEngine, ValidateIntrinsicsAndImage) {
   });
 }
 
+// The default implementation of the batch render API validates the requests and
+// then renders them one at a time through the DoRender*Image() API.
+GTEST_TEST(RenderEngine, RenderImages) {
+  DummyRenderEngine engine;
+  const int w = 2;
+  const int h = 2;
+  const CameraInfo intrinsics{w, h, M_PI};
+  const ColorRenderCamera color_camera{
+      {"n/a", intrinsics, {0.1, 10}, RigidTransformd{}}, false};
+  const DepthRenderCamera depth_camera{
+      {"n/a", intrinsics, {0.1, 10}, RigidTransformd{}}, {1.0, 5.0}};
+  ImageRgba8U color{w, h};
+  ImageDepth32F depth{w, h};
+  ImageLabel16I label{w, h};
+
+  const RigidTransformd X_WC1{Vector3d{1, 2, 3}};
+  const RigidTransformd X_WC2{Vector3d{4, 5, 6}};
+  std::vector<ImageRenderRequest> requests(2);
+  requests[0].X_WC = X_WC1;
+  requests[0].color_camera = color_camera;
+  requests[0].depth_camera = depth_camera;
+  requests[0].color_image = &color;
+  requests[0].depth_image = &depth;
+  requests[0].label_image = &label;
+  requests[1].X_WC = X_WC2;
+  requests[1].depth_camera = depth_camera;
+  requests[1].depth_image = &depth;
+
+  engine.RenderImages(requests);
+  EXPECT_EQ(engine.num_color_renders(), 1);
+  EXPECT_EQ(engine.num_depth_renders(), 2);
+  EXPECT_EQ(engine.num_label_renders(), 1);
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                              X_WC2.GetAsMatrix34()));
+
+  // A missing camera.
+  ImageRenderRequest no_camera;
+  no_camera.label_image = &label;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages({no_camera}),
+      "Can't render a color or label image without a color camera.");
+  no_camera.label_image = nullptr;
+  no_camera.depth_image = &depth;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages({no_camera}),
+      "Can't render a depth image without a depth camera.");
+
+  // A mismatched image size; nothing gets rendered.
+  ImageLabel16I bad_label{w - 1, h};
+  requests[1].color_camera = color_camera;
+  requests[1].label_image = &bad_label;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages(requests),
+      "The label image to write has a size different from that specified in "
+      "the camera intrinsics.*");
+  EXPECT_EQ(engine.num_color_renders(), 1);
+}
+
 // An absolute barebones RenderEngine implementation; however it is cloneable
 // with both a copy constructor *and* a valid DoClone() implementation.
 class CloneableEngine : public MinimumEngine {
@@ -1,6 +1,7 @@
 #include "drake/geometry/render_gl/internal_render_engine_gl.h"
 
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <optional>
 #include <utility>
@@ -31,6 +32,7 @@ using std::unordered_map;
 using std::vector;
 using render::ColorRenderCamera;
 using render::DepthRenderCamera;
+using render::ImageRenderRequest;
 using render::RenderCameraCore;
 using render::RenderEngine;
 using render::RenderLabel;
@@ -529,6 +531,11 @@ RenderEngineGl::~RenderEngineGl() {
       program_ptr->Free();
     }
   }
+
+  // Delete pixel buffers.
+  for (auto& pixel_buffer : pixel_buffers_) {
+    glDeleteBuffers(1, &pixel_buffer.buffer);
+  }
 }
 
 void RenderEngineGl::UpdateViewpoint(const RigidTransformd& X_WR) {
@@ -696,6 +703,9 @@ unique_ptr<RenderEngine> RenderEngineGl::DoClone() const {
 
   clone->InitGlState();
 
+  // The clone creates its own pixel buffers; see pixel_buffers_.
+  clone->pixel_buffers_.clear();
+
   // Update the vertex array objects on the shared vertex buffers.
   clone->UpdateVertexArrays();
 
@@ -748,6 +758,122 @@ void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
 void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
                                         ImageRgba8U* color_image_out) const {
   opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawColorImage(camera);
+  glGetTextureImage(render_target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                    color_image_out->size(), color_image_out->at(0, 0));
+}
+
+void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
+                                        ImageDepth32F* depth_image_out) const {
+  opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawDepthImage(camera);
+  glGetTextureImage(render_target.value_texture, 0, GL_RED, GL_FLOAT,
+                    depth_image_out->size() * sizeof(GLfloat),
+                    depth_image_out->at(0, 0));
+}
+
+void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
+                                        ImageLabel16I* label_image_out) const {
+  opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawLabelImage(camera);
+  // TODO(SeanCurtis-TRI): Apparently, we *should* be able to create a frame
+  // buffer texture consisting of a single-channel, 16-bit, signed int (to match
+  // the underlying RenderLabel value). Doing so would allow us to render labels
+  // directly and eliminate this additional pass.
+  GetLabelImage(label_image_out, render_target);
+}
+
+void RenderEngineGl::DoRenderImages(
+    const std::vector<ImageRenderRequest>& requests) {
+  opengl_context_->MakeCurrent();
+
+  // An image whose pixels have been queued for transfer into a pixel buffer.
+  struct Readback {
+    int request_index{};
+    RenderType render_type{};
+    GLsizeiptr size{};
+  };
+  std::vector<Readback> readbacks;
+
+  // Queues the transfer of the image in `target` into the next pixel buffer.
+  // With a buffer bound to GL_PIXEL_PACK_BUFFER, glGetTextureImage() writes
+  // into the buffer (at offset zero) instead of client memory, and returns
+  // without waiting for the drawing to complete. Commands are executed in
+  // order, so `target` can be drawn into again right away.
+  const auto queue_readback = [this, &readbacks](int request_index,
+                                                 RenderType render_type,
+                                                 const RenderTarget& target,
+                                                 GLsizeiptr size) {
+    const int buffer_index = static_cast<int>(readbacks.size());
+    if (buffer_index == static_cast<int>(pixel_buffers_.size())) {
+      PixelBuffer pixel_buffer;
+      glCreateBuffers(1, &pixel_buffer.buffer);
+      pixel_buffers_.push_back(pixel_buffer);
+    }
+    PixelBuffer& pixel_buffer = pixel_buffers_[buffer_index];
+    if (pixel_buffer.capacity < size) {
+      glNamedBufferData(pixel_buffer.buffer, size, nullptr, GL_STREAM_READ);
+      pixel_buffer.capacity = size;
+    }
+    const auto texture_format = get_texture_format(render_type);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixel_buffer.buffer);
+    glGetTextureImage(target.value_texture, 0, std::get<1>(texture_format),
+                      std::get<2>(texture_format), size, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readbacks.push_back({request_index, render_type, size});
+  };
+
+  for (int i = 0; i < static_cast<int>(requests.size()); ++i) {
+    const ImageRenderRequest& request = requests[i];
+    UpdateViewpoint(request.X_WC);
+    if (request.color_image != nullptr) {
+      queue_readback(i, RenderType::kColor,
+                     DrawColorImage(*request.color_camera),
+                     request.color_image->size() * sizeof(GLubyte));
+    }
+    if (request.depth_image != nullptr) {
+      queue_readback(i, RenderType::kDepth,
+                     DrawDepthImage(*request.depth_camera),
+                     request.depth_image->size() * sizeof(GLfloat));
+    }
+    if (request.label_image != nullptr) {
+      // The label target stores the label encoded as an RGBA color.
+      const GLsizeiptr size =
+          request.label_image->width() * request.label_image->height() * 4;
+      queue_readback(i, RenderType::kLabel,
+                     DrawLabelImage(*request.color_camera), size);
+    }
+  }
+
+  // Mapping a buffer waits for its transfer to complete.
+  for (int k = 0; k < static_cast<int>(readbacks.size()); ++k) {
+    const Readback& readback = readbacks[k];
+    const ImageRenderRequest& request =
+        requests[readback.request_index];
+    const GLuint buffer = pixel_buffers_[k].buffer;
+    const void* pixels =
+        glMapNamedBufferRange(buffer, 0, readback.size, GL_MAP_READ_BIT);
+    DRAKE_DEMAND(pixels != nullptr);
+    switch (readback.render_type) {
+      case RenderType::kColor:
+        std::memcpy(request.color_image->at(0, 0), pixels, readback.size);
+        break;
+      case RenderType::kDepth:
+        std::memcpy(request.depth_image->at(0, 0), pixels, readback.size);
+        break;
+      case RenderType::kLabel:
+        DecodeLabelImage(static_cast<const GLubyte*>(pixels),
+                         request.label_image);
+        break;
+      case RenderType::kTypeCount:
+        DRAKE_UNREACHABLE();
+    }
+    glUnmapNamedBuffer(buffer);
+  }
+}
+
+RenderTarget RenderEngineGl::DrawColorImage(
+    const ColorRenderCamera& camera) const {
   // TODO(SeanCurtis-TRI): For transparency to work properly, I need to
   //  segregate objects with transparency from those without. The transparent
   //  geometries then need to be sorted from farthest to nearest the camera and
@@ -788,14 +914,11 @@ void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
   // the front buffer; reversing the order means the image we've just rendered
   // wouldn't be visible.
   SetWindowVisibility(camera.core(), camera.show_window(), render_target);
-  glGetTextureImage(render_target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                    color_image_out->size(), color_image_out->at(0, 0));
+  return render_target;
 }
 
-void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
-                                        ImageDepth32F* depth_image_out) const {
-  opengl_context_->MakeCurrent();
-
+RenderTarget RenderEngineGl::DrawDepthImage(
+    const DepthRenderCamera& camera) const {
   const RenderTarget render_target =
       GetRenderTarget(camera.core(), RenderType::kDepth);
 
@@ -821,16 +944,11 @@ void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
 
     shader_program.Unuse();
   }
-
-  glGetTextureImage(render_target.value_texture, 0, GL_RED, GL_FLOAT,
-                    depth_image_out->size() * sizeof(GLfloat),
-                    depth_image_out->at(0, 0));
+  return render_target;
 }
 
-void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
-                                        ImageLabel16I* label_image_out) const {
-  opengl_context_->MakeCurrent();
-
+RenderTarget RenderEngineGl::DrawLabelImage(
+    const ColorRenderCamera& camera) const {
   const RenderTarget render_target =
       GetRenderTarget(camera.core(), RenderType::kLabel);
   // TODO(SeanCurtis-TRI) Consider converting Rgba to float[4] as a member.
@@ -863,11 +981,7 @@ void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
   // the front buffer; reversing the order means the image we've just rendered
   // wouldn't be visible.
   SetWindowVisibility(camera.core(), camera.show_window(), render_target);
-  // TODO(SeanCurtis-TRI): Apparently, we *should* be able to create a frame
-  // buffer texture consisting of a single-channel, 16-bit, signed int (to match
-  // the underlying RenderLabel value). Doing so would allow us to render labels
-  // directly and eliminate this additional pass.
-  GetLabelImage(label_image_out, render_target);
+  return render_target;
 }
 
 void RenderEngineGl::AddGeometryInstance(int geometry_index, void* user_data,
@@ -1071,12 +1185,19 @@ void RenderEngineGl::GetLabelImage(ImageLabel16I* label_image_out,
   ImageRgba8U image(label_image_out->width(), label_image_out->height());
   glGetTextureImage(target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
                     image.size() * sizeof(GLubyte), image.at(0, 0));
+  DecodeLabelImage(image.at(0, 0), label_image_out);
+}
+
+void RenderEngineGl::DecodeLabelImage(const GLubyte* encoded_pixels,
+                                      ImageLabel16I* label_image_out) {
   ColorI color;
-  for (int y = 0; y < image.height(); ++y) {
-    for (int x = 0; x < image.width(); ++x) {
-      color.r = image.at(x, y)[0];
-      color.g = image.at(x, y)[1];
-      color.b = image.at(x, y)[2];
+  for (int y = 0; y < label_image_out->height(); ++y) {
+    for (int x = 0; x < label_image_out->width(); ++x) {
+      const GLubyte* pixel =
+          encoded_pixels + 4 * (y * label_image_out->width() + x);
+      color.r = pixel[0];
+      color.g = pixel[1];
+      color.b = pixel[2];
       *label_image_out->at(x, y) = RenderEngine::LabelFromColor(color);
     }
   }
@@ -178,6 +178,27 @@ class RenderEngineGl final : public render::RenderEngine {
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const final;
 
+  // @see RenderEngine::DoRenderImages().
+  // All of the images are drawn before any of them is read back; each image is
+  // transferred from its render target into a pixel buffer object, which
+  // doesn't stall the pipeline, so the transfers overlap with the drawing of
+  // the subsequent images.
+  //
+  // Limitation: only the read backs are batched. Each image is still drawn by
+  // its own set of draw calls into its own render target; the batch is not
+  // submitted as a single pass through a layered framebuffer or a texture
+  // atlas.
+  void DoRenderImages(
+      const std::vector<render::ImageRenderRequest>& requests) final;
+
+  // Draws the color/depth/label image for the given camera (at the current
+  // viewpoint) into the render target for that camera and image type, and
+  // returns that target. The color and label variants also update the display
+  // window.
+  RenderTarget DrawColorImage(const render::ColorRenderCamera& camera) const;
+  RenderTarget DrawDepthImage(const render::DepthRenderCamera& camera) const;
+  RenderTarget DrawLabelImage(const render::ColorRenderCamera& camera) const;
+
   // Copy constructor used for cloning.
   // Do *not* call this copy constructor directly. The resulting RenderEngineGl
   // is not complete -- it will render nothing except the background color.
@@ -243,6 +264,12 @@ class RenderEngineGl final : public render::RenderEngine {
   void GetLabelImage(drake::systems::sensors::ImageLabel16I* label_image_out,
                      const RenderTarget& target) const;
 
+  // Decodes the label image from the RGBA-encoded pixels read from a label
+  // render target.
+  static void DecodeLabelImage(
+      const GLubyte* encoded_pixels,
+      drake::systems::sensors::ImageLabel16I* label_image_out);
+
   // Acquires the render target for the given camera. "Acquiring" the render
   // target guarantees that the target will be ready for receiving OpenGL
   // draw commands.
@@ -375,6 +402,23 @@ class RenderEngineGl final : public render::RenderEngine {
       RenderType::kTypeCount>
       frame_buffers_;
 
+  // A pixel buffer object (and its allocated size in bytes) that receives the
+  // pixels read from a render target.
+  struct PixelBuffer {
+    GLuint buffer{};
+    GLsizeiptr capacity{};
+  };
+
+  // The pixel buffers used by DoRenderImages(); the i-th image read back in a
+  // batch uses the i-th buffer. Buffers are created and grown as needed.
+  //
+  // Note: unlike the other OpenGl objects referenced by this class, buffer
+  // objects are shared across OpenGl contexts, so sharing these with a clone
+  // would let two threads transfer pixels into the same buffer. Therefore,
+  // each clone starts with an empty collection (see DoClone()) and deletes the
+  // buffers it creates.
+  std::vector<PixelBuffer> pixel_buffers_;
+
   // Mapping from GeometryId to the visual data associated with that geometry.
   // When copying the render engine, this data is copied verbatim allowing the
   // copied render engine access to the same OpenGL objects in the OpenGL
@@ -3,6 +3,8 @@
 #include <array>
 #include <cstring>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <vtkImageData.h>
@@ -28,6 +30,7 @@ namespace internal {
 
 using render::ColorRenderCamera;
 using render::DepthRenderCamera;
+using render::ImageRenderRequest;
 using render::RenderCameraCore;
 using render::RenderEngine;
 using render::RenderLabel;
@@ -1388,6 +1391,92 @@ TEST_F(RenderEngineGlTest, DifferentCameras) {
   }
 }
 
+// Confirms that rendering a batch of images from several cameras produces the
+// same images as rendering them one at a time. The batch includes cameras that
+// share render targets (same image size) and cameras that don't.
+TEST_F(RenderEngineGlTest, RenderImages) {
+  Init(X_WR_, true);
+  PopulateSphereTest(renderer_.get());
+
+  const RenderCameraCore& ref_core = depth_camera_.core();
+  const auto& ref_intrinsics = ref_core.intrinsics();
+  const DepthRenderCamera small_camera{
+      {ref_core.renderer_name(),
+       {ref_intrinsics.width() / 2, ref_intrinsics.height() / 2,
+        ref_intrinsics.fov_y()},
+       ref_core.clipping(),
+       ref_core.sensor_pose_in_camera_body()},
+      depth_camera_.depth_range()};
+  const RigidTransformd X_WR_shifted =
+      X_WR_ * RigidTransformd(Vector3d(0.2, 0.1, 0));
+  const std::vector<std::pair<DepthRenderCamera, RigidTransformd>> views{
+      {depth_camera_, X_WR_},
+      {depth_camera_, X_WR_shifted},
+      {small_camera, X_WR_},
+      {small_camera, X_WR_shifted}};
+
+  // Allocate all of the images before taking their addresses.
+  std::vector<ImageRgba8U> colors;
+  std::vector<ImageDepth32F> depths;
+  std::vector<ImageLabel16I> labels;
+  for (const auto& [camera, _] : views) {
+    const int w = camera.core().intrinsics().width();
+    const int h = camera.core().intrinsics().height();
+    colors.emplace_back(w, h);
+    depths.emplace_back(w, h);
+    labels.emplace_back(w, h);
+  }
+  std::vector<ImageRenderRequest> requests;
+  for (int i = 0; i < static_cast<int>(views.size()); ++i) {
+    const auto& [camera, X_WC] = views[i];
+    ImageRenderRequest request;
+    request.X_WC = X_WC;
+    request.color_camera = ColorRenderCamera(camera.core(), kShowWindow);
+    request.depth_camera = camera;
+    request.color_image = &colors[i];
+    request.depth_image = &depths[i];
+    request.label_image = &labels[i];
+    requests.push_back(request);
+  }
+  // Also request a single image type on its own.
+  ImageDepth32F depth_only(kWidth, kHeight);
+  {
+    ImageRenderRequest request;
+    request.X_WC = X_WR_;
+    request.depth_camera = depth_camera_;
+    request.depth_image = &depth_only;
+    requests.push_back(request);
+  }
+  EXPECT_NO_THROW(renderer_->RenderImages(requests));
+
+  // The unshifted full-size view is that of the standard test.
+  VerifyCenterShapeTest(*renderer_, depth_camera_, colors[0], depths[0],
+                        labels[0]);
+  EXPECT_EQ(depth_only, depths[0]);
+
+  for (int i = 0; i < static_cast<int>(views.size()); ++i) {
+    SCOPED_TRACE(fmt::format("View {}", i));
+    const auto& [camera, X_WC] = views[i];
+    const int w = camera.core().intrinsics().width();
+    const int h = camera.core().intrinsics().height();
+    ImageRgba8U color(w, h);
+    ImageDepth32F depth(w, h);
+    ImageLabel16I label(w, h);
+    renderer_->UpdateViewpoint(X_WC);
+    Render(renderer_.get(), &camera, &color, &depth, &label);
+    EXPECT_EQ(colors[i], color);
+    EXPECT_EQ(depths[i], depth);
+    EXPECT_EQ(labels[i], label);
+  }
+
+  // A clone renders batches with its own pixel buffers.
+  unique_ptr<RenderEngine> clone = renderer_->Clone();
+  ImageDepth32F clone_depth(kWidth, kHeight);
+  requests.back().depth_image = &clone_depth;
+  clone->RenderImages({requests.back()});
+  EXPECT_EQ(clone_depth, depth_only);
+}
+
 // Tests that registered geometry without any explicitly set perception
 // properties renders without error.
 // TODO(SeanCurtis-TRI): When RenderEngineGl supports label and color images,
@@ -522,6 +522,11 @@ void RenderEngineGltfClient::DoRenderLabelImage(
   }
 }
 
+void RenderEngineGltfClient::DoRenderImages(
+    const std::vector<render::ImageRenderRequest>& requests) {
+  RenderEngine::DoRenderImages(requests);
+}
+
 void RenderEngineGltfClient::ExportScene(const std::string& export_path,
                                          ImageType image_type) const {
   // TODO(SeanCurtis-TRI): Given the ability to edit the gltf in place, we
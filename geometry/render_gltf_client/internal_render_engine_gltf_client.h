@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <drake_vendor/nlohmann/json.hpp>
 
@@ -86,6 +87,12 @@ class DRAKE_NO_EXPORT RenderEngineGltfClient
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const override;
 
+  // @see RenderEngine::DoRenderImages(). Each image is rendered by the server,
+  // so this restores the default one-image-at-a-time implementation in place
+  // of RenderEngineVtk's local batching.
+  void DoRenderImages(
+      const std::vector<render::ImageRenderRequest>& requests) override;
+
   /* Exports the `RenderEngineVtk::pipelines_[image_type]` VTK scene to a
    glTF file given `export_path`. */
   void ExportScene(const std::string& export_path,
@@ -0,0 +1,17 @@
+#include "drake/geometry/render_raycast/factory.h"
+
+#include <utility>
+
+#include "drake/geometry/render_raycast/internal_render_engine_raycast.h"
+
+namespace drake {
+namespace geometry {
+
+std::unique_ptr<render::RenderEngine> MakeRenderEngineRaycast(
+    RenderEngineRaycastParams params) {
+  return std::make_unique<render_raycast::internal::RenderEngineRaycast>(
+      std::move(params));
+}
+
+}  // namespace geometry
+}  // namespace drake
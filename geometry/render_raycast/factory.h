@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render_raycast/render_engine_raycast_params.h"
+
+namespace drake {
+namespace geometry {
+
+/** Constructs a RenderEngine implementation which produces depth and label
+ images by casting rays on the CPU; it requires neither a GPU nor a display and
+ is available on every platform. Each pixel's ray is intersected with the
+ registered geometries (analytically for the primitive shapes, and through a
+ bounding volume hierarchy for meshes). Images are rendered serially unless
+ `params.num_threads` opts in to dividing the rows of each image among OpenMP
+ threads.
+
+ The engine does not support color images; attempting to render one throws.
+ Mesh and Convex shapes are only supported for .obj files; other mesh types
+ are ignored (with a one-time warning). Materials, textures, and lights play no
+ role in depth and label images, so all perception properties other than the
+ `(label, id)` property are ignored.
+
+ <b> Using RenderEngineRaycast in multiple threads </b>
+
+ The rendering APIs of a %RenderEngineRaycast instance are threadsafe, but it
+ should not be mutated (e.g., adding/removing geometries, updating poses or the
+ viewpoint) while rendering. Clones share their (immutable) mesh data and can
+ be used freely in different threads.
+
+ @throws std::exception if `params.num_threads` is negative. */
+std::unique_ptr<render::RenderEngine> MakeRenderEngineRaycast(
+    RenderEngineRaycastParams params = {});
+
+}  // namespace geometry
+}  // namespace drake
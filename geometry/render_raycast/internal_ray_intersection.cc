@@ -0,0 +1,221 @@
+#include "drake/geometry/render_raycast/internal_ray_intersection.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace drake {
+namespace geometry {
+namespace render_raycast {
+namespace internal {
+
+using Eigen::Vector3d;
+using geometry::internal::Obb;
+
+namespace {
+
+using NodeType = geometry::internal::BvNode<Obb, TriangleSurfaceMesh<double>>;
+
+// Records `t` in `t_hit` if it lies in the ray's interval and is nearer than
+// any previously recorded value.
+void Consider(double t, const Ray& ray, std::optional<double>* t_hit) {
+  if (t >= ray.t_min && t <= ray.t_max &&
+      (!t_hit->has_value() || t < **t_hit)) {
+    *t_hit = t;
+  }
+}
+
+// Invokes `consider` on each real root of a⋅t² + 2⋅b⋅t + c = 0.
+template <typename Callback>
+void ForEachQuadraticRoot(double a, double b, double c, Callback&& consider) {
+  if (a == 0) return;
+  const double discriminant = b * b - a * c;
+  if (discriminant < 0) return;
+  const double root = std::sqrt(discriminant);
+  consider((-b - root) / a);
+  consider((-b + root) / a);
+}
+
+// Clips the interval [*t_near, *t_far] to the parameters for which the ray
+// lies within the slab |xᵢ| ≤ half_width along a single axis. Returns false if
+// the clipped interval is empty.
+bool ClipToSlab(double p, double v, double half_width, double* t_near,
+                double* t_far) {
+  if (v == 0) {
+    return std::abs(p) <= half_width;
+  }
+  const double inv_v = 1 / v;
+  double t0 = (-half_width - p) * inv_v;
+  double t1 = (half_width - p) * inv_v;
+  if (t0 > t1) std::swap(t0, t1);
+  *t_near = std::max(*t_near, t0);
+  *t_far = std::min(*t_far, t1);
+  return *t_near <= *t_far;
+}
+
+// Reports if the ray intersects the box within [ray.t_min, t_max].
+bool RayOverlapsObb(const Obb& obb_G, const Ray& ray_G, double t_max) {
+  const math::RigidTransformd X_BG = obb_G.pose().inverse();
+  const Vector3d p_BO = X_BG * ray_G.p_FO;
+  const Vector3d v_B = X_BG.rotation() * ray_G.v_F;
+  const Vector3d& half_width = obb_G.half_width();
+  double t_near = ray_G.t_min;
+  double t_far = t_max;
+  for (int i = 0; i < 3; ++i) {
+    if (!ClipToSlab(p_BO[i], v_B[i], half_width[i], &t_near, &t_far)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The Möller-Trumbore ray-triangle intersection test (without back face
+// culling).
+void IntersectTriangle(const TriangleSurfaceMesh<double>& mesh, int t,
+                       const Ray& ray, std::optional<double>* t_hit) {
+  const SurfaceTriangle& triangle = mesh.triangles()[t];
+  const Vector3d& p0 = mesh.vertices()[triangle.vertex(0)];
+  const Vector3d e1 = mesh.vertices()[triangle.vertex(1)] - p0;
+  const Vector3d e2 = mesh.vertices()[triangle.vertex(2)] - p0;
+  const Vector3d p_vec = ray.v_F.cross(e2);
+  const double det = e1.dot(p_vec);
+  if (det == 0) return;
+  const double inv_det = 1 / det;
+  const Vector3d t_vec = ray.p_FO - p0;
+  const double u = t_vec.dot(p_vec) * inv_det;
+  if (u < 0 || u > 1) return;
+  const Vector3d q_vec = t_vec.cross(e1);
+  const double w = ray.v_F.dot(q_vec) * inv_det;
+  if (w < 0 || u + w > 1) return;
+  Consider(e2.dot(q_vec) * inv_det, ray, t_hit);
+}
+
+// Intersects the ray with the triangles in the subtree rooted at `node`,
+// skipping subtrees whose bounding volumes the ray misses before t_hit.
+void IntersectNode(const NodeType& node,
+                   const TriangleSurfaceMesh<double>& mesh, const Ray& ray,
+                   std::optional<double>* t_hit) {
+  if (!RayOverlapsObb(node.bv(), ray, t_hit->value_or(ray.t_max))) return;
+  if (node.is_leaf()) {
+    for (int i = 0; i < node.num_element_indices(); ++i) {
+      IntersectTriangle(mesh, node.element_index(i), ray, t_hit);
+    }
+    return;
+  }
+  IntersectNode(node.left(), mesh, ray, t_hit);
+  IntersectNode(node.right(), mesh, ray, t_hit);
+}
+
+// Considers the intersections of the ray with the barrel (excluding the caps)
+// of a cylinder of the given radius, aligned with the z axis, and spanning
+// |z| ≤ half_length.
+void IntersectBarrel(double radius, double half_length, const Ray& ray,
+                     std::optional<double>* t_hit) {
+  const Vector3d& p = ray.p_FO;
+  const Vector3d& v = ray.v_F;
+  ForEachQuadraticRoot(
+      v.x() * v.x() + v.y() * v.y(), p.x() * v.x() + p.y() * v.y(),
+      p.x() * p.x() + p.y() * p.y() - radius * radius, [&](double t) {
+        if (std::abs(p.z() + t * v.z()) <= half_length) {
+          Consider(t, ray, t_hit);
+        }
+      });
+}
+
+}  // namespace
+
+std::optional<double> IntersectRay(const Box& box, const Ray& ray) {
+  const Vector3d half_width = box.size() / 2;
+  double t_near = -std::numeric_limits<double>::infinity();
+  double t_far = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < 3; ++i) {
+    if (!ClipToSlab(ray.p_FO[i], ray.v_F[i], half_width[i], &t_near, &t_far)) {
+      return std::nullopt;
+    }
+  }
+  std::optional<double> t_hit;
+  Consider(t_near, ray, &t_hit);
+  Consider(t_far, ray, &t_hit);
+  return t_hit;
+}
+
+std::optional<double> IntersectRay(const Capsule& capsule, const Ray& ray) {
+  const double r = capsule.radius();
+  const double half_length = capsule.length() / 2;
+  std::optional<double> t_hit;
+  IntersectBarrel(r, half_length, ray, &t_hit);
+  // The hemispherical caps; only the outward halves of the spheres are part
+  // of the capsule's surface.
+  for (const double sign : {-1.0, 1.0}) {
+    const Vector3d p_CO = ray.p_FO - Vector3d(0, 0, sign * half_length);
+    ForEachQuadraticRoot(ray.v_F.squaredNorm(), p_CO.dot(ray.v_F),
+                         p_CO.squaredNorm() - r * r, [&](double t) {
+                           if (sign * (p_CO.z() + t * ray.v_F.z()) >= 0) {
+                             Consider(t, ray, &t_hit);
+                           }
+                         });
+  }
+  return t_hit;
+}
+
+std::optional<double> IntersectRay(const Cylinder& cylinder, const Ray& ray) {
+  const double r = cylinder.radius();
+  const double half_length = cylinder.length() / 2;
+  std::optional<double> t_hit;
+  IntersectBarrel(r, half_length, ray, &t_hit);
+  // The planar caps.
+  if (ray.v_F.z() != 0) {
+    for (const double z : {-half_length, half_length}) {
+      const double t = (z - ray.p_FO.z()) / ray.v_F.z();
+      const Vector3d p_FP = ray.p_FO + t * ray.v_F;
+      if (p_FP.x() * p_FP.x() + p_FP.y() * p_FP.y() <= r * r) {
+        Consider(t, ray, &t_hit);
+      }
+    }
+  }
+  return t_hit;
+}
+
+std::optional<double> IntersectRay(const Ellipsoid& ellipsoid, const Ray& ray) {
+  // Scaling the ellipsoid to the unit sphere doesn't change the parameter of
+  // the intersection.
+  const Vector3d inv_scale(1 / ellipsoid.a(), 1 / ellipsoid.b(),
+                           1 / ellipsoid.c());
+  const Vector3d p = ray.p_FO.cwiseProduct(inv_scale);
+  const Vector3d v = ray.v_F.cwiseProduct(inv_scale);
+  std::optional<double> t_hit;
+  ForEachQuadraticRoot(v.squaredNorm(), p.dot(v), p.squaredNorm() - 1,
+                       [&](double t) {
+                         Consider(t, ray, &t_hit);
+                       });
+  return t_hit;
+}
+
+std::optional<double> IntersectRay(const HalfSpace&, const Ray& ray) {
+  std::optional<double> t_hit;
+  if (ray.v_F.z() != 0) {
+    Consider(-ray.p_FO.z() / ray.v_F.z(), ray, &t_hit);
+  }
+  return t_hit;
+}
+
+std::optional<double> IntersectRay(const Sphere& sphere, const Ray& ray) {
+  const double r = sphere.radius();
+  std::optional<double> t_hit;
+  ForEachQuadraticRoot(ray.v_F.squaredNorm(), ray.p_FO.dot(ray.v_F),
+                       ray.p_FO.squaredNorm() - r * r, [&](double t) {
+                         Consider(t, ray, &t_hit);
+                       });
+  return t_hit;
+}
+
+std::optional<double> IntersectRay(const RaycastMesh& mesh, const Ray& ray) {
+  std::optional<double> t_hit;
+  IntersectNode(mesh.bvh().root_node(), mesh.mesh(), ray, &t_hit);
+  return t_hit;
+}
+
+}  // namespace internal
+}  // namespace render_raycast
+}  // namespace geometry
+}  // namespace drake
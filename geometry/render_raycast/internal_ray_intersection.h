@@ -0,0 +1,76 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/obb.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/shape_specification.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raycast {
+namespace internal {
+
+/* A ray, measured and expressed in some frame F, whose points are
+ p_FR(t) = p_FO + t⋅v_F for t ∈ [t_min, t_max]. The direction v_F need not be
+ unit length; the parameter t is what is reported for intersections, and it is
+ invariant under rigid transformation of the ray.  */
+struct Ray {
+  Vector3<double> p_FO;
+  Vector3<double> v_F;
+  double t_min{};
+  double t_max{};
+};
+
+/* A triangle mesh paired with the bounding volume hierarchy used to cast rays
+ against it. Both are measured and expressed in the mesh's frame.  */
+class RaycastMesh {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RaycastMesh)
+
+  explicit RaycastMesh(TriangleSurfaceMesh<double> mesh)
+      : mesh_(std::move(mesh)), bvh_(mesh_) {}
+
+  const TriangleSurfaceMesh<double>& mesh() const { return mesh_; }
+
+  const geometry::internal::Bvh<geometry::internal::Obb,
+                                TriangleSurfaceMesh<double>>&
+  bvh() const {
+    return bvh_;
+  }
+
+ private:
+  TriangleSurfaceMesh<double> mesh_;
+  geometry::internal::Bvh<geometry::internal::Obb, TriangleSurfaceMesh<double>>
+      bvh_;
+};
+
+/* @name Ray-shape intersection
+
+ Each function reports the smallest parameter t ∈ [ray.t_min, ray.t_max] at
+ which the given `ray` (measured and expressed in the shape's canonical frame
+ G) crosses the surface of the shape, or nullopt if there is no such t.
+ Surfaces are treated as two-sided; a ray that starts inside a shape reports
+ the point at which it leaves the shape. The half space's surface is its
+ bounding plane.  */
+//@{
+
+std::optional<double> IntersectRay(const Box& box, const Ray& ray);
+std::optional<double> IntersectRay(const Capsule& capsule, const Ray& ray);
+std::optional<double> IntersectRay(const Cylinder& cylinder, const Ray& ray);
+std::optional<double> IntersectRay(const Ellipsoid& ellipsoid, const Ray& ray);
+std::optional<double> IntersectRay(const HalfSpace& half_space,
+                                   const Ray& ray);
+std::optional<double> IntersectRay(const Sphere& sphere, const Ray& ray);
+std::optional<double> IntersectRay(const RaycastMesh& mesh, const Ray& ray);
+
+//@}
+
+}  // namespace internal
+}  // namespace render_raycast
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,332 @@
+#include "drake/geometry/render_raycast/internal_render_engine_raycast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include "drake/common/text_logging.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raycast {
+namespace internal {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using render::ColorRenderCamera;
+using render::DepthRenderCamera;
+using render::RenderCameraCore;
+using render::RenderEngine;
+using render::RenderLabel;
+using std::make_unique;
+using std::unique_ptr;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Dispatches a ray to the intersection function for a surface's type.
+struct SurfaceIntersector {
+  template <typename ShapeType>
+  std::optional<double> operator()(const ShapeType& shape) const {
+    return IntersectRay(shape, ray);
+  }
+
+  std::optional<double> operator()(
+      const std::shared_ptr<const RaycastMesh>& mesh) const {
+    return IntersectRay(*mesh, ray);
+  }
+
+  const Ray& ray;
+};
+
+// Computes the (inclusive) range of pixel indices along one image axis that
+// could be covered by a sphere of radius r whose center is at coordinate p
+// (along the same axis) and depth z in the camera frame. It is computed by
+// projecting the corners of the sphere's bounding box.
+// @pre z - r > 0.
+std::pair<int, int> CalcPixelRange(double p, double z, double r, double focal,
+                                   double center, int size) {
+  const double ratio_min = std::min((p - r) / (z - r), (p - r) / (z + r));
+  const double ratio_max = std::max((p + r) / (z - r), (p + r) / (z + r));
+  // Clamping as doubles guards against overflow in the conversion to int.
+  const double max_index = size - 1;
+  const double lower =
+      std::clamp(std::floor(center + focal * ratio_min), 0.0, max_index + 1);
+  const double upper =
+      std::clamp(std::ceil(center + focal * ratio_max), -1.0, max_index);
+  return {static_cast<int>(lower), static_cast<int>(upper)};
+}
+
+}  // namespace
+
+RenderEngineRaycast::RenderEngineRaycast(RenderEngineRaycastParams params)
+    : RenderEngine(params.default_label), parameters_(std::move(params)) {
+  if (parameters_.num_threads < 0) {
+    throw std::logic_error(fmt::format(
+        "RenderEngineRaycast: the number of threads must be non-negative; "
+        "given {}",
+        parameters_.num_threads));
+  }
+  num_threads_ = parameters_.num_threads;
+  if (num_threads_ == 0) {
+#if defined(_OPENMP)
+    num_threads_ = std::max(1, omp_get_max_threads());
+#else
+    num_threads_ = 1;
+#endif
+  }
+}
+
+RenderEngineRaycast::~RenderEngineRaycast() = default;
+
+void RenderEngineRaycast::UpdateViewpoint(const RigidTransformd& X_WC) {
+  X_WC_ = X_WC;
+}
+
+void RenderEngineRaycast::ImplementGeometry(const Box& box, void* user_data) {
+  AddGeometry(box, Vector3d::Zero(), box.size().norm() / 2, user_data);
+}
+
+void RenderEngineRaycast::ImplementGeometry(const Capsule& capsule,
+                                            void* user_data) {
+  AddGeometry(capsule, Vector3d::Zero(),
+              capsule.radius() + capsule.length() / 2, user_data);
+}
+
+void RenderEngineRaycast::ImplementGeometry(const Convex& convex,
+                                            void* user_data) {
+  ImplementMesh(convex.filename(), convex.scale(), user_data);
+}
+
+void RenderEngineRaycast::ImplementGeometry(const Cylinder& cylinder,
+                                            void* user_data) {
+  AddGeometry(cylinder, Vector3d::Zero(),
+              Eigen::Vector2d(cylinder.radius(), cylinder.length() / 2).norm(),
+              user_data);
+}
+
+void RenderEngineRaycast::ImplementGeometry(const Ellipsoid& ellipsoid,
+                                            void* user_data) {
+  AddGeometry(ellipsoid, Vector3d::Zero(),
+              std::max({ellipsoid.a(), ellipsoid.b(), ellipsoid.c()}),
+              user_data);
+}
+
+void RenderEngineRaycast::ImplementGeometry(const HalfSpace& half_space,
+                                            void* user_data) {
+  AddGeometry(half_space, Vector3d::Zero(),
+              std::numeric_limits<double>::infinity(), user_data);
+}
+
+void RenderEngineRaycast::ImplementGeometry(const Mesh& mesh,
+                                            void* user_data) {
+  ImplementMesh(mesh.filename(), mesh.scale(), user_data);
+}
+
+void RenderEngineRaycast::ImplementGeometry(const Sphere& sphere,
+                                            void* user_data) {
+  AddGeometry(sphere, Vector3d::Zero(), sphere.radius(), user_data);
+}
+
+bool RenderEngineRaycast::DoRegisterVisual(
+    GeometryId id, const Shape& shape, const PerceptionProperties& properties,
+    const RigidTransformd& X_WG) {
+  RegistrationData data{id, X_WG, properties};
+  shape.Reify(this, &data);
+  return data.accepted;
+}
+
+void RenderEngineRaycast::DoUpdateVisualPose(GeometryId id,
+                                             const RigidTransformd& X_WG) {
+  geometries_.at(id).X_WG = X_WG;
+}
+
+bool RenderEngineRaycast::DoRemoveGeometry(GeometryId id) {
+  return geometries_.erase(id) > 0;
+}
+
+unique_ptr<RenderEngine> RenderEngineRaycast::DoClone() const {
+  return unique_ptr<RenderEngineRaycast>(new RenderEngineRaycast(*this));
+}
+
+void RenderEngineRaycast::DoRenderDepthImage(
+    const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
+  using DepthTraits = ImageTraits<PixelType::kDepth32F>;
+  const double min_depth = camera.depth_range().min_depth();
+  const double max_depth = camera.depth_range().max_depth();
+  CastRays(camera.core(), [&](int u, int v, double t,
+                              const RaycastGeometry* geometry) {
+    float depth = DepthTraits::kTooFar;
+    if (geometry != nullptr) {
+      if (t < min_depth) {
+        depth = DepthTraits::kTooClose;
+      } else if (t <= max_depth) {
+        depth = static_cast<float>(t);
+      }
+    }
+    *depth_image_out->at(u, v) = depth;
+  });
+}
+
+void RenderEngineRaycast::DoRenderLabelImage(
+    const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
+  CastRays(camera.core(), [&](int u, int v, double,
+                              const RaycastGeometry* geometry) {
+    *label_image_out->at(u, v) =
+        geometry != nullptr ? geometry->label : RenderLabel::kEmpty;
+  });
+}
+
+void RenderEngineRaycast::AddGeometry(Surface surface, const Vector3d& p_GB,
+                                      double radius, void* user_data) {
+  const RegistrationData& data = *static_cast<RegistrationData*>(user_data);
+  const RenderLabel label = GetRenderLabelOrThrow(data.properties);
+  geometries_.insert(
+      {data.id, RaycastGeometry{std::move(surface), label, data.X_WG, p_GB,
+                                radius}});
+}
+
+void RenderEngineRaycast::ImplementMesh(const std::string& filename,
+                                        double scale, void* user_data) {
+  RegistrationData* data = static_cast<RegistrationData*>(user_data);
+
+  // We're checking the input filename in case the user specified name has the
+  // desired extension but is a symlink to some arbitrarily named cached file.
+  if (Mesh(filename).extension() != ".obj") {
+    static const logging::Warn one_time(
+        "RenderEngineRaycast only supports Mesh/Convex specifications which "
+        "use .obj files. Mesh specifications using other mesh types (e.g., "
+        ".gltf, .stl, .dae, etc.) will be ignored.");
+    data->accepted = false;
+    return;
+  }
+
+  // Resolve to a canonical path.
+  std::error_code bad_path;
+  const std::string file_key = fs::canonical(filename, bad_path).string();
+  if (bad_path) {
+    throw std::runtime_error(fmt::format(
+        "RenderEngineRaycast: unable to access the requested mesh file '{}'; "
+        "{}.",
+        filename, bad_path.message()));
+  }
+
+  std::shared_ptr<const RaycastMesh>& mesh = meshes_[{file_key, scale}];
+  if (mesh == nullptr) {
+    mesh = std::make_shared<const RaycastMesh>(
+        ReadObjToTriangleSurfaceMesh(file_key, scale));
+  }
+  const auto [center, size] = mesh->mesh().CalcBoundingBox();
+  AddGeometry(mesh, center, size.norm() / 2, user_data);
+}
+
+template <typename WritePixel>
+void RenderEngineRaycast::CastRays(const RenderCameraCore& core,
+                                   const WritePixel& write_pixel) const {
+  const CameraInfo& intrinsics = core.intrinsics();
+  const int width = intrinsics.width();
+  const int height = intrinsics.height();
+  const double fx = intrinsics.focal_x();
+  const double fy = intrinsics.focal_y();
+  const double cx = intrinsics.center_x();
+  const double cy = intrinsics.center_y();
+  const double near = core.clipping().near();
+  const double far = core.clipping().far();
+
+  // A geometry that may be hit by the rays of the pixels in the rectangle
+  // [u_min, u_max] x [v_min, v_max].
+  struct Candidate {
+    const RaycastGeometry* geometry{};
+    RigidTransformd X_GC;
+    int u_min{};
+    int u_max{};
+    int v_min{};
+    int v_max{};
+  };
+  std::vector<Candidate> candidates;
+  const RigidTransformd X_CW = X_WC_.inverse();
+  for (const auto& [id, geometry] : geometries_) {
+    const RigidTransformd X_CG = X_CW * geometry.X_WG;
+    Candidate candidate{.geometry = &geometry,
+                        .X_GC = X_CG.inverse(),
+                        .u_max = width - 1,
+                        .v_max = height - 1};
+    if (std::isfinite(geometry.radius)) {
+      const Vector3d p_CB = X_CG * geometry.p_GB;
+      const double r = geometry.radius;
+      if (p_CB.z() + r < near || p_CB.z() - r > far) continue;
+      // A bounding sphere that reaches behind the camera can cover any pixel.
+      if (p_CB.z() - r > 0) {
+        std::tie(candidate.u_min, candidate.u_max) =
+            CalcPixelRange(p_CB.x(), p_CB.z(), r, fx, cx, width);
+        std::tie(candidate.v_min, candidate.v_max) =
+            CalcPixelRange(p_CB.y(), p_CB.z(), r, fy, cy, height);
+        if (candidate.u_min > candidate.u_max ||
+            candidate.v_min > candidate.v_max) {
+          continue;
+        }
+      }
+    }
+    candidates.push_back(std::move(candidate));
+  }
+
+  auto cast_rows = [&](int v_begin, int v_end) {
+    for (int v = v_begin; v < v_end; ++v) {
+      for (int u = 0; u < width; ++u) {
+        const Vector3d d_C((u - cx) / fx, (v - cy) / fy, 1.0);
+        double t_nearest = far;
+        const RaycastGeometry* nearest = nullptr;
+        for (const Candidate& candidate : candidates) {
+          if (u < candidate.u_min || u > candidate.u_max ||
+              v < candidate.v_min || v > candidate.v_max) {
+            continue;
+          }
+          // Only intersections nearer than the nearest found so far matter.
+          const Ray ray_G{.p_FO = candidate.X_GC.translation(),
+                          .v_F = candidate.X_GC.rotation() * d_C,
+                          .t_min = near,
+                          .t_max = t_nearest};
+          const std::optional<double> t = std::visit(
+              SurfaceIntersector{ray_G}, candidate.geometry->surface);
+          if (t.has_value()) {
+            t_nearest = *t;
+            nearest = candidate.geometry;
+          }
+        }
+        write_pixel(u, v, t_nearest, nearest);
+      }
+    }
+  };
+
+  // The rows are divided evenly among the threads, one share per thread.
+  const int num_shares = std::min(num_threads_, height);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_shares) if (num_shares > 1)
+#endif
+  for (int i = 0; i < num_shares; ++i) {
+    cast_rows(i * height / num_shares, (i + 1) * height / num_shares);
+  }
+}
+
+}  // namespace internal
+}  // namespace render_raycast
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render_raycast/internal_ray_intersection.h"
+#include "drake/geometry/render_raycast/render_engine_raycast_params.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raycast {
+namespace internal {
+
+/* See documentation of MakeRenderEngineRaycast().
+
+ Each image is produced by casting one ray per pixel (through the pixel's
+ center) from the camera's origin. The ray through pixel (u, v) has direction
+ d_C = ((u - cx) / fx, (v - cy) / fy, 1) in the camera frame C, so the
+ parameter t of the ray at a point is that point's depth. Each ray is
+ transformed into the frame of each geometry it might hit, and intersected
+ with the geometry there.
+
+ To avoid testing every ray against every geometry, each geometry is bounded
+ by a sphere. Before casting rays, the bounding spheres are transformed into
+ the camera frame, geometries entirely outside the clipping range are
+ discarded, and the rest are assigned the (conservative) rectangle of pixels
+ their bounding sphere covers. A ray is only tested against the geometries
+ whose rectangles contain its pixel.
+
+ Clones share all mesh data (which is immutable once loaded).  */
+class RenderEngineRaycast final : public render::RenderEngine {
+ public:
+  /* @name Does not allow public copy, move, or assignment  */
+  //@{
+
+  // Note: the copy constructor is actually private to serve as the basis for
+  // implementing the DoClone() method.
+  RenderEngineRaycast& operator=(const RenderEngineRaycast&) = delete;
+  RenderEngineRaycast(RenderEngineRaycast&&) = delete;
+  RenderEngineRaycast& operator=(RenderEngineRaycast&&) = delete;
+  //@}
+
+  /* Constructs an instance of the render engine with the given `params`.
+   @throws std::exception if `params.num_threads` is negative.  */
+  explicit RenderEngineRaycast(RenderEngineRaycastParams params = {});
+
+  ~RenderEngineRaycast() final;
+
+  /* @see RenderEngine::UpdateViewpoint().  */
+  void UpdateViewpoint(const math::RigidTransformd& X_WC) final;
+
+  const RenderEngineRaycastParams& parameters() const { return parameters_; }
+
+  /* Reports the number of threads used to render each image.  */
+  int num_threads() const { return num_threads_; }
+
+  /* @name    Shape reification  */
+  //@{
+  using render::RenderEngine::ImplementGeometry;
+  void ImplementGeometry(const Box& box, void* user_data) final;
+  void ImplementGeometry(const Capsule& capsule, void* user_data) final;
+  void ImplementGeometry(const Convex& convex, void* user_data) final;
+  void ImplementGeometry(const Cylinder& cylinder, void* user_data) final;
+  void ImplementGeometry(const Ellipsoid& ellipsoid, void* user_data) final;
+  void ImplementGeometry(const HalfSpace& half_space, void* user_data) final;
+  void ImplementGeometry(const Mesh& mesh, void* user_data) final;
+  void ImplementGeometry(const Sphere& sphere, void* user_data) final;
+  //@}
+
+ private:
+  // The surface against which rays are cast; meshes are shared with clones.
+  using Surface = std::variant<Box, Capsule, Cylinder, Ellipsoid, HalfSpace,
+                               Sphere, std::shared_ptr<const RaycastMesh>>;
+
+  // A registered geometry.
+  struct RaycastGeometry {
+    Surface surface;
+    render::RenderLabel label;
+    math::RigidTransformd X_WG;
+    // The sphere bounding the geometry, measured and expressed in its frame G.
+    // The radius is infinite for geometries that are unbounded.
+    Vector3<double> p_GB;
+    double radius{};
+  };
+
+  // Data to pass through the reification process.
+  struct RegistrationData {
+    const GeometryId id;
+    const math::RigidTransformd& X_WG;
+    const PerceptionProperties& properties;
+    bool accepted{true};
+  };
+
+  // Copy constructor used for cloning.
+  RenderEngineRaycast(const RenderEngineRaycast& other) = default;
+
+  // @see RenderEngine::DoRegisterVisual().
+  bool DoRegisterVisual(GeometryId id, const Shape& shape,
+                        const PerceptionProperties& properties,
+                        const math::RigidTransformd& X_WG) final;
+
+  // @see RenderEngine::DoUpdateVisualPose().
+  void DoUpdateVisualPose(GeometryId id,
+                          const math::RigidTransformd& X_WG) final;
+
+  // @see RenderEngine::DoRemoveGeometry().
+  bool DoRemoveGeometry(GeometryId id) final;
+
+  // @see RenderEngine::DoClone().
+  std::unique_ptr<RenderEngine> DoClone() const final;
+
+  // @see RenderEngine::DoRenderDepthImage().
+  void DoRenderDepthImage(
+      const render::DepthRenderCamera& camera,
+      systems::sensors::ImageDepth32F* depth_image_out) const final;
+
+  // @see RenderEngine::DoRenderLabelImage().
+  void DoRenderLabelImage(
+      const render::ColorRenderCamera& camera,
+      systems::sensors::ImageLabel16I* label_image_out) const final;
+
+  // Adds the given surface to the engine as the geometry being registered.
+  void AddGeometry(Surface surface, const Vector3<double>& p_GB, double radius,
+                   void* user_data);
+
+  // Adds the mesh in the given file, with the given scale, as the geometry
+  // being registered. Meshes are loaded once per (file, scale) and shared
+  // thereafter. Only .obj files are supported; any other file type is
+  // rejected (data->accepted is set to false) with a one-time warning.
+  void ImplementMesh(const std::string& filename, double scale,
+                     void* user_data);
+
+  // Casts a ray through every pixel of an image with the given camera core and
+  // calls `write_pixel(u, v, t, geometry)` for each with the parameter of the
+  // nearest intersection and the geometry intersected (or nullptr, in which
+  // case t is meaningless).
+  template <typename WritePixel>
+  void CastRays(const render::RenderCameraCore& core,
+                const WritePixel& write_pixel) const;
+
+  RenderEngineRaycastParams parameters_;
+
+  int num_threads_{};
+
+  std::unordered_map<GeometryId, RaycastGeometry> geometries_;
+
+  // Meshes keyed by (canonical file path, scale).
+  std::map<std::pair<std::string, double>, std::shared_ptr<const RaycastMesh>>
+      meshes_;
+
+  math::RigidTransformd X_WC_;
+};
+
+}  // namespace internal
+}  // namespace render_raycast
+}  // namespace geometry
+}  // namespace drake
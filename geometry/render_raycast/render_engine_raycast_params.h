@@ -0,0 +1,32 @@
+#pragma once
+
+#include "drake/common/name_value.h"
+#include "drake/geometry/render/render_label.h"
+
+namespace drake {
+namespace geometry {
+
+/** Construction parameters for RenderEngineRaycast.  */
+struct RenderEngineRaycastParams {
+  /** Passes this object to an Archive.
+  Refer to @ref yaml_serialization "YAML Serialization" for background. */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(default_label));
+    a->Visit(DRAKE_NVP(num_threads));
+  }
+
+  /** Default render label to apply to a geometry when none is otherwise
+   specified.  */
+  render::RenderLabel default_label{render::RenderLabel::kUnspecified};
+
+  /** The number of (OpenMP) threads among which the rows of each image are
+   divided. The default of one renders serially; a value of zero uses as many
+   threads as OpenMP would by default (typically, one per hardware thread).
+   Must be non-negative. When Drake is built without OpenMP, images are always
+   rendered serially.  */
+  int num_threads{1};
+};
+
+}  // namespace geometry
+}  // namespace drake
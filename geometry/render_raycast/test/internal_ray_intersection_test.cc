@@ -0,0 +1,132 @@
+#include "drake/geometry/render_raycast/internal_ray_intersection.h"
+
+#include <cmath>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raycast {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+constexpr double kEps = 1e-12;
+
+// A ray from p_FO in the direction v_F with the interval [0, ∞].
+Ray MakeRay(const Vector3d& p_FO, const Vector3d& v_F) {
+  return Ray{.p_FO = p_FO, .v_F = v_F, .t_min = 0, .t_max = kInf};
+}
+
+// Confirms the distance reported for a ray that approaches each shape from
+// above, a ray that misses, and a ray that starts inside the shape.
+template <typename ShapeType>
+void CheckShape(const ShapeType& shape, const char* name, double top,
+                double side) {
+  SCOPED_TRACE(name);
+  const Vector3d down(0, 0, -1);
+  std::optional<double> t = IntersectRay(shape, MakeRay({0, 0, 10}, down));
+  ASSERT_TRUE(t.has_value());
+  EXPECT_NEAR(*t, 10 - top, kEps);
+
+  // The parameter scales with the length of the direction.
+  t = IntersectRay(shape, MakeRay({0, 0, 10}, 2 * down));
+  ASSERT_TRUE(t.has_value());
+  EXPECT_NEAR(*t, (10 - top) / 2, kEps);
+
+  // A ray pointing away from the shape.
+  EXPECT_FALSE(IntersectRay(shape, MakeRay({0, 0, 10}, -down)).has_value());
+
+  // A ray passing beside the shape.
+  EXPECT_FALSE(
+      IntersectRay(shape, MakeRay({side + 0.1, 0, 10}, down)).has_value());
+
+  // A ray from inside reports where it leaves the shape.
+  t = IntersectRay(shape, MakeRay({0, 0, 0}, {1, 0, 0}));
+  ASSERT_TRUE(t.has_value());
+  EXPECT_NEAR(*t, side, kEps);
+
+  // The interval excludes the first intersection, so the second is reported.
+  Ray ray = MakeRay({0, 0, 10}, down);
+  ray.t_min = 10 - top + 0.01;
+  t = IntersectRay(shape, ray);
+  ASSERT_TRUE(t.has_value());
+  EXPECT_GT(*t, 10);
+
+  // The interval ends before the first intersection.
+  ray = MakeRay({0, 0, 10}, down);
+  ray.t_max = 10 - top - 0.01;
+  EXPECT_FALSE(IntersectRay(shape, ray).has_value());
+}
+
+GTEST_TEST(RayIntersectionTest, Shapes) {
+  CheckShape(Box(2, 4, 6), "Box", 3, 1);
+  CheckShape(Capsule(0.5, 2), "Capsule", 1.5, 0.5);
+  CheckShape(Cylinder(0.5, 2), "Cylinder", 1, 0.5);
+  CheckShape(Ellipsoid(1, 2, 3), "Ellipsoid", 3, 1);
+  CheckShape(Sphere(1.5), "Sphere", 1.5, 1.5);
+}
+
+// Rays that only graze the hemispherical caps of the capsule, and those that
+// would hit the cylinder's caps, distinguish the two shapes.
+GTEST_TEST(RayIntersectionTest, CapsuleAndCylinderCaps) {
+  const Ray ray = MakeRay({0.45, 0, 10}, {0, 0, -1});
+  const std::optional<double> t_capsule = IntersectRay(Capsule(0.5, 2), ray);
+  ASSERT_TRUE(t_capsule.has_value());
+  EXPECT_NEAR(*t_capsule, 10 - 1 - std::sqrt(0.25 - 0.45 * 0.45), kEps);
+  const std::optional<double> t_cylinder = IntersectRay(Cylinder(0.5, 2), ray);
+  ASSERT_TRUE(t_cylinder.has_value());
+  EXPECT_NEAR(*t_cylinder, 9, kEps);
+}
+
+GTEST_TEST(RayIntersectionTest, HalfSpace) {
+  const HalfSpace half_space;
+  std::optional<double> t =
+      IntersectRay(half_space, MakeRay({1, 2, 3}, {1, 0, -1}));
+  ASSERT_TRUE(t.has_value());
+  EXPECT_NEAR(*t, 3, kEps);
+  // From below the surface (i.e., inside the half space), the boundary is
+  // still reported.
+  t = IntersectRay(half_space, MakeRay({1, 2, -3}, {0, 0, 1}));
+  ASSERT_TRUE(t.has_value());
+  EXPECT_NEAR(*t, 3, kEps);
+  // Parallel to or pointing away from the boundary.
+  EXPECT_FALSE(
+      IntersectRay(half_space, MakeRay({0, 0, 1}, {1, 0, 0})).has_value());
+  EXPECT_FALSE(
+      IntersectRay(half_space, MakeRay({0, 0, 1}, {0, 0, 1})).has_value());
+}
+
+// The mesh of a box must report the same intersections as the equivalent
+// primitive for a fan of rays.
+GTEST_TEST(RayIntersectionTest, MeshMatchesBox) {
+  const RaycastMesh mesh(ReadObjToTriangleSurfaceMesh(
+      FindResourceOrThrow("drake/geometry/render/test/meshes/box.obj"), 1.5));
+  const Box box(3, 3, 3);
+  CheckShape(mesh, "Mesh", 1.5, 1.5);
+
+  const Vector3d p_FO(0.3, -4, 5);
+  for (double x = -1; x <= 1; x += 0.125) {
+    for (double z = -1; z <= 1; z += 0.125) {
+      const Ray ray = MakeRay(p_FO, Vector3d(x, 1, z - 1));
+      const std::optional<double> t_box = IntersectRay(box, ray);
+      const std::optional<double> t_mesh = IntersectRay(mesh, ray);
+      ASSERT_EQ(t_box.has_value(), t_mesh.has_value()) << x << ", " << z;
+      if (t_box.has_value()) {
+        EXPECT_NEAR(*t_box, *t_mesh, 1e-10);
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render_raycast
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,247 @@
+#include "drake/geometry/render_raycast/internal_render_engine_raycast.h"
+
+#include <limits>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/render_raycast/factory.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raycast {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using render::ClippingRange;
+using render::ColorRenderCamera;
+using render::DepthRange;
+using render::DepthRenderCamera;
+using render::RenderCameraCore;
+using render::RenderEngine;
+using render::RenderLabel;
+using std::unique_ptr;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+using DepthTraits = ImageTraits<PixelType::kDepth32F>;
+
+// The camera is 5 m above the origin, looking straight down; the image's
+// x-axis points in the world's +x direction.
+const RigidTransformd X_WC(RollPitchYawd(M_PI, 0, 0), Vector3d(0, 0, 5));
+
+constexpr int kWidth = 64;
+constexpr int kHeight = 48;
+constexpr double kFovY = M_PI_4;
+
+class RenderEngineRaycastTest : public ::testing::Test {
+ protected:
+  RenderEngineRaycastTest()
+      : core_("n/a", CameraInfo(kWidth, kHeight, kFovY),
+              ClippingRange(0.5, 20), RigidTransformd()),
+        color_camera_(core_, false),
+        depth_camera_(core_, DepthRange(1, 10)),
+        depth_(kWidth, kHeight),
+        label_(kWidth, kHeight) {}
+
+  static PerceptionProperties Properties(int label) {
+    PerceptionProperties properties;
+    properties.AddProperty("label", "id", RenderLabel(label));
+    return properties;
+  }
+
+  void Render(const RenderEngine& engine) {
+    engine.RenderDepthImage(depth_camera_, &depth_);
+    engine.RenderLabelImage(color_camera_, &label_);
+  }
+
+  // The pixel the camera's optical axis passes through.
+  static constexpr int kU = kWidth / 2;
+  static constexpr int kV = kHeight / 2;
+
+  const RenderCameraCore core_;
+  const ColorRenderCamera color_camera_;
+  const DepthRenderCamera depth_camera_;
+  ImageDepth32F depth_;
+  ImageLabel16I label_;
+};
+
+TEST_F(RenderEngineRaycastTest, Construction) {
+  const RenderEngineRaycast default_engine;
+  EXPECT_EQ(default_engine.default_render_label(), RenderLabel::kUnspecified);
+  // By default, images are rendered serially.
+  EXPECT_EQ(default_engine.num_threads(), 1);
+  EXPECT_GE(RenderEngineRaycast({.num_threads = 0}).num_threads(), 1);
+
+  const RenderEngineRaycast engine({.default_label = RenderLabel::kDontCare,
+                                    .num_threads = 3});
+  EXPECT_EQ(engine.default_render_label(), RenderLabel::kDontCare);
+  EXPECT_EQ(engine.num_threads(), 3);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderEngineRaycast({.num_threads = -1}),
+                              ".*number of threads must be non-negative.*");
+
+  const unique_ptr<RenderEngine> from_factory =
+      MakeRenderEngineRaycast({.num_threads = 2});
+  EXPECT_NE(dynamic_cast<RenderEngineRaycast*>(from_factory.get()), nullptr);
+}
+
+// With nothing in the scene, every pixel reports a miss.
+TEST_F(RenderEngineRaycastTest, EmptyScene) {
+  RenderEngineRaycast engine;
+  engine.UpdateViewpoint(X_WC);
+  Render(engine);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      ASSERT_EQ(*depth_.at(u, v), DepthTraits::kTooFar);
+      ASSERT_EQ(*label_.at(u, v), RenderLabel::kEmpty);
+    }
+  }
+}
+
+// A box resting on a ground plane; the plane fills the background.
+TEST_F(RenderEngineRaycastTest, BoxOnHalfSpace) {
+  RenderEngineRaycast engine;
+  engine.RegisterVisual(GeometryId::get_new_id(), HalfSpace(), Properties(1),
+                        RigidTransformd(), false);
+  const GeometryId box_id = GeometryId::get_new_id();
+  engine.RegisterVisual(box_id, Box(1, 1, 2), Properties(2),
+                        RigidTransformd(Vector3d(0, 0, 1)), true);
+  engine.UpdateViewpoint(X_WC);
+  Render(engine);
+
+  EXPECT_FLOAT_EQ(*depth_.at(kU, kV), 3);
+  EXPECT_EQ(*label_.at(kU, kV), 2);
+  EXPECT_FLOAT_EQ(*depth_.at(0, 0), 5);
+  EXPECT_EQ(*label_.at(0, 0), 1);
+
+  // Moving the box toward the camera beyond the near end of the depth range
+  // reports "too close", but it remains in the label image.
+  engine.UpdatePoses<double>(
+      {{box_id, RigidTransformd(Vector3d(0, 0, 3.25))}});
+  Render(engine);
+  EXPECT_EQ(*depth_.at(kU, kV), DepthTraits::kTooClose);
+  EXPECT_EQ(*label_.at(kU, kV), 2);
+
+  // Once the box's top is nearer than the near clipping plane, the ray passes
+  // through the clipped top face and reports the box's bottom face.
+  engine.UpdatePoses<double>(
+      {{box_id, RigidTransformd(Vector3d(0, 0, 4))}});
+  Render(engine);
+  EXPECT_FLOAT_EQ(*depth_.at(kU, kV), 2);
+  EXPECT_EQ(*label_.at(kU, kV), 2);
+
+  EXPECT_TRUE(engine.RemoveGeometry(box_id));
+  Render(engine);
+  EXPECT_FLOAT_EQ(*depth_.at(kU, kV), 5);
+  EXPECT_EQ(*label_.at(kU, kV), 1);
+}
+
+// Surfaces beyond the far end of the depth range are reported as too far.
+TEST_F(RenderEngineRaycastTest, TooFar) {
+  RenderEngineRaycast engine;
+  engine.RegisterVisual(GeometryId::get_new_id(), Sphere(1), Properties(3),
+                        RigidTransformd(Vector3d(0, 0, -7)), false);
+  engine.UpdateViewpoint(X_WC);
+  Render(engine);
+  EXPECT_EQ(*depth_.at(kU, kV), DepthTraits::kTooFar);
+  EXPECT_EQ(*label_.at(kU, kV), 3);
+  EXPECT_EQ(*label_.at(0, 0), RenderLabel::kEmpty);
+}
+
+// Every supported shape is visible, with the expected depth at its center.
+TEST_F(RenderEngineRaycastTest, AllShapes) {
+  const std::string obj =
+      FindResourceOrThrow("drake/geometry/render/test/meshes/box.obj");
+  RenderEngineRaycast engine;
+  engine.UpdateViewpoint(X_WC);
+  auto expect_depth = [&](const Shape& shape, double top) {
+    const GeometryId id = GeometryId::get_new_id();
+    ASSERT_TRUE(engine.RegisterVisual(id, shape, Properties(4),
+                                      RigidTransformd(), false));
+    Render(engine);
+    // The ray through the center pixel is slightly off the optical axis.
+    EXPECT_NEAR(*depth_.at(kU, kV), 5 - top, 1e-2);
+    EXPECT_EQ(*label_.at(kU, kV), 4);
+    engine.RemoveGeometry(id);
+  };
+  expect_depth(Box(1, 1, 2), 1);
+  expect_depth(Capsule(0.5, 2), 1.5);
+  expect_depth(Convex(obj, 0.5), 0.5);
+  expect_depth(Cylinder(0.5, 2), 1);
+  expect_depth(Ellipsoid(0.5, 0.5, 1.5), 1.5);
+  expect_depth(Mesh(obj, 0.75), 0.75);
+  expect_depth(Sphere(2), 2);
+}
+
+// Only .obj meshes are supported.
+TEST_F(RenderEngineRaycastTest, UnsupportedMesh) {
+  RenderEngineRaycast engine;
+  EXPECT_FALSE(engine.RegisterVisual(
+      GeometryId::get_new_id(),
+      Mesh(FindResourceOrThrow("drake/geometry/render/test/meshes/cube.gltf")),
+      Properties(5), RigidTransformd()));
+}
+
+TEST_F(RenderEngineRaycastTest, NoColor) {
+  RenderEngineRaycast engine;
+  ImageRgba8U color(kWidth, kHeight);
+  EXPECT_THROW(engine.RenderColorImage(color_camera_, &color),
+               std::exception);
+}
+
+// A scene with geometries partially and entirely outside the field of view,
+// some behind the camera. Images must not depend on the number of threads,
+// and clones must render the same images as the original.
+TEST_F(RenderEngineRaycastTest, ThreadsAndClones) {
+  RenderEngineRaycast single_thread({.num_threads = 1});
+  RenderEngineRaycast multi_thread({.num_threads = 5});
+  int label = 10;
+  for (double x = -6; x <= 6; x += 1.5) {
+    for (double y = -6; y <= 6; y += 1.5) {
+      const GeometryId id = GeometryId::get_new_id();
+      const RigidTransformd X_WG(RollPitchYawd(x, y, 0), Vector3d(x, y, 0));
+      const Capsule capsule(0.3, 1.0);
+      single_thread.RegisterVisual(id, capsule, Properties(label), X_WG);
+      multi_thread.RegisterVisual(id, capsule, Properties(label), X_WG);
+      ++label;
+    }
+  }
+  const RigidTransformd X_WC_tilted(RollPitchYawd(M_PI * 0.75, 0.2, 0),
+                                    Vector3d(0.5, 4, 3));
+  single_thread.UpdateViewpoint(X_WC_tilted);
+  multi_thread.UpdateViewpoint(X_WC_tilted);
+  const unique_ptr<RenderEngine> clone = multi_thread.Clone();
+
+  Render(single_thread);
+  const ImageDepth32F expected_depth = depth_;
+  const ImageLabel16I expected_label = label_;
+  int num_hits = 0;
+  const RenderEngine* const engines[] = {&multi_thread, clone.get()};
+  for (const RenderEngine* engine : engines) {
+    Render(*engine);
+    for (int v = 0; v < kHeight; ++v) {
+      for (int u = 0; u < kWidth; ++u) {
+        ASSERT_EQ(*depth_.at(u, v), *expected_depth.at(u, v));
+        ASSERT_EQ(*label_.at(u, v), *expected_label.at(u, v));
+        if (*label_.at(u, v) != RenderLabel::kEmpty) ++num_hits;
+      }
+    }
+  }
+  EXPECT_GT(num_hits, 0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render_raycast
+}  // namespace geometry
+}  // namespace drake
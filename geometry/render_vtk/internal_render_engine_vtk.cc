@@ -40,6 +40,7 @@ using geometry::internal::RenderMesh;
 using math::RigidTransformd;
 using render::ColorRenderCamera;
 using render::DepthRenderCamera;
+using render::ImageRenderRequest;
 using render::RenderCameraCore;
 using render::RenderEngine;
 using render::RenderLabel;
@@ -228,51 +229,16 @@ void RenderEngineVtk::DoRenderColorImage(
     ImageRgba8U* color_image_out) const {
   UpdateWindow(camera.core(), camera.show_window(),
                *pipelines_[ImageType::kColor], "Color Image");
-  PerformVtkUpdate(*pipelines_[ImageType::kColor]);
-
-  // TODO(SeanCurtis-TRI): Determine if this copies memory (and find some way
-  // around copying).
-  pipelines_[ImageType::kColor]->exporter->Export(color_image_out->at(0, 0));
+  pipelines_[ImageType::kColor]->window->Render();
+  ReadColorImage(color_image_out);
 }
 
 void RenderEngineVtk::DoRenderDepthImage(
     const DepthRenderCamera& camera,
       ImageDepth32F* depth_image_out) const {
   UpdateWindow(camera, *pipelines_[ImageType::kDepth]);
-  PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
-
-  const CameraInfo& intrinsics = camera.core().intrinsics();
-  ImageRgba8U image(intrinsics.width(), intrinsics.height());
-  // TODO(SeanCurtis-TRI): We're doing multiple passes on the pixel data. This
-  // does one pass by copying the filter to the given image. We then do a second
-  // pass where we re-encode the values. It would be much better to process the
-  // pixels in a single pass.  The solution is to simply call
-  // exporter->GetPointerToData() and process the pixels as they are read.
-  // See the implementation in vtkImageExport::Export() for details.
-  pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
-
-  const double min_depth = camera.depth_range().min_depth();
-  const double max_depth = camera.depth_range().max_depth();
-  for (int v = 0; v < intrinsics.height(); ++v) {
-    for (int u = 0; u < intrinsics.width(); ++u) {
-      if (image.at(u, v)[0] == 255u && image.at(u, v)[1] == 255u &&
-          image.at(u, v)[2] == 255u) {
-        depth_image_out->at(u, v)[0] =
-            ImageTraits<PixelType::kDepth32F>::kTooFar;
-      } else {
-        // Decoding three channel color values to a float value. For the detail,
-        // see depth_shaders.h.
-        float shader_value = image.at(u, v)[0] + image.at(u, v)[1] / 255. +
-                             image.at(u, v)[2] / (255. * 255.);
-
-        // Dividing by 255 so that the range gets to be [0, 1].
-        shader_value /= 255.f;
-        // TODO(kunimatsu-tri) Calculate this in a vertex shader.
-        depth_image_out->at(u, v)[0] = CheckRangeAndConvertToMeters(
-            shader_value, min_depth, max_depth);
-      }
-    }
-  }
+  pipelines_[ImageType::kDepth]->window->Render();
+  ReadDepthImage(camera, depth_image_out);
 }
 
 void RenderEngineVtk::DoRenderLabelImage(
@@ -280,23 +246,42 @@ void RenderEngineVtk::DoRenderLabelImage(
     ImageLabel16I* label_image_out) const {
   UpdateWindow(camera.core(), camera.show_window(),
                *pipelines_[ImageType::kLabel], "Label Image");
-  PerformVtkUpdate(*pipelines_[ImageType::kLabel]);
+  pipelines_[ImageType::kLabel]->window->Render();
+  ReadLabelImage(label_image_out);
+}
 
-  // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
-  // would be much better to process the pixels directly. The solution is to
-  // simply call exporter->GetPointerToData() and process the pixels myself.
-  // See the implementation in vtkImageExport::Export() for details.
-  const CameraInfo& intrinsics = camera.core().intrinsics();
-  ImageRgba8U image(intrinsics.width(), intrinsics.height());
-  pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
+void RenderEngineVtk::DoRenderImages(
+    const std::vector<ImageRenderRequest>& requests) {
+  for (const ImageRenderRequest& request : requests) {
+    UpdateViewpoint(request.X_WC);
+    // Each image type has its own window, so we issue the draws for all of
+    // the requested images before reading any of them back; the driver can
+    // then rasterize the later images while the earlier ones are read.
+    if (request.color_image != nullptr) {
+      UpdateWindow(request.color_camera->core(),
+                   request.color_camera->show_window(),
+                   *pipelines_[ImageType::kColor], "Color Image");
+      pipelines_[ImageType::kColor]->window->Render();
+    }
+    if (request.depth_image != nullptr) {
+      UpdateWindow(*request.depth_camera, *pipelines_[ImageType::kDepth]);
+      pipelines_[ImageType::kDepth]->window->Render();
+    }
+    if (request.label_image != nullptr) {
+      UpdateWindow(request.color_camera->core(),
+                   request.color_camera->show_window(),
+                   *pipelines_[ImageType::kLabel], "Label Image");
+      pipelines_[ImageType::kLabel]->window->Render();
+    }
 
-  ColorI color;
-  for (int v = 0; v < intrinsics.height(); ++v) {
-    for (int u = 0; u < intrinsics.width(); ++u) {
-      color.r = image.at(u, v)[0];
-      color.g = image.at(u, v)[1];
-      color.b = image.at(u, v)[2];
-      label_image_out->at(u, v)[0] = RenderEngine::LabelFromColor(color);
+    if (request.color_image != nullptr) {
+      ReadColorImage(request.color_image);
+    }
+    if (request.depth_image != nullptr) {
+      ReadDepthImage(*request.depth_camera, request.depth_image);
+    }
+    if (request.label_image != nullptr) {
+      ReadLabelImage(request.label_image);
     }
   }
 }
@@ -597,6 +582,69 @@ void RenderEngineVtk::PerformVtkUpdate(const RenderingPipeline& p) {
   p.filter->Update();
 }
 
+const uint8_t* RenderEngineVtk::ReadPixels(const RenderingPipeline& p) {
+  p.filter->Modified();
+  p.filter->Update();
+  return static_cast<const uint8_t*>(p.exporter->GetPointerToData());
+}
+
+void RenderEngineVtk::ReadColorImage(ImageRgba8U* color_image_out) const {
+  const RenderingPipeline& p = *pipelines_[ImageType::kColor];
+  ReadPixels(p);
+  // Export() writes directly into the output image, flipping the rows to put
+  // the origin in the upper-left corner.
+  p.exporter->Export(color_image_out->at(0, 0));
+}
+
+void RenderEngineVtk::ReadDepthImage(const DepthRenderCamera& camera,
+                                     ImageDepth32F* depth_image_out) const {
+  // The raw pixels have their origin in the lower-left corner; we decode them
+  // in place rather than exporting them to an intermediate image first.
+  const uint8_t* const pixels = ReadPixels(*pipelines_[ImageType::kDepth]);
+  const int width = depth_image_out->width();
+  const int height = depth_image_out->height();
+  const double min_depth = camera.depth_range().min_depth();
+  const double max_depth = camera.depth_range().max_depth();
+  for (int v = 0; v < height; ++v) {
+    const uint8_t* pixel = pixels + 4 * width * (height - 1 - v);
+    float* depth = depth_image_out->at(0, v);
+    for (int u = 0; u < width; ++u, pixel += 4, ++depth) {
+      if (pixel[0] == 255u && pixel[1] == 255u && pixel[2] == 255u) {
+        *depth = ImageTraits<PixelType::kDepth32F>::kTooFar;
+      } else {
+        // Decoding three channel color values to a float value. For the detail,
+        // see depth_shaders.h.
+        float shader_value =
+            pixel[0] + pixel[1] / 255. + pixel[2] / (255. * 255.);
+
+        // Dividing by 255 so that the range gets to be [0, 1].
+        shader_value /= 255.f;
+        // TODO(kunimatsu-tri) Calculate this in a vertex shader.
+        *depth =
+            CheckRangeAndConvertToMeters(shader_value, min_depth, max_depth);
+      }
+    }
+  }
+}
+
+void RenderEngineVtk::ReadLabelImage(ImageLabel16I* label_image_out) const {
+  // See ReadDepthImage() for the pixel layout.
+  const uint8_t* const pixels = ReadPixels(*pipelines_[ImageType::kLabel]);
+  const int width = label_image_out->width();
+  const int height = label_image_out->height();
+  ColorI color;
+  for (int v = 0; v < height; ++v) {
+    const uint8_t* pixel = pixels + 4 * width * (height - 1 - v);
+    int16_t* label = label_image_out->at(0, v);
+    for (int u = 0; u < width; ++u, pixel += 4, ++label) {
+      color.r = pixel[0];
+      color.g = pixel[1];
+      color.b = pixel[2];
+      *label = RenderEngine::LabelFromColor(color);
+    }
+  }
+}
+
 void RenderEngineVtk::UpdateWindow(const RenderCameraCore& camera,
                                    bool show_window, const RenderingPipeline& p,
                                    const char* name) const {
@@ -614,12 +662,19 @@ void RenderEngineVtk::UpdateWindow(const RenderCameraCore& camera,
   vtkMatrix4x4* proj_mat = vtk_camera->GetExplicitProjectionTransformMatrix();
   DRAKE_DEMAND(proj_mat != nullptr);
   const Eigen::Matrix4f T_DC = camera.CalcProjectionMatrix().cast<float>();
+  // Rendering the same camera repeatedly is the common case; we only mark the
+  // camera as modified when the projection actually changes so that VTK
+  // doesn't rebuild its derived camera state for every image.
+  bool projection_changed = false;
   for (int i = 0; i < 4; ++i) {
     for (int j = 0; j < 4; ++j) {
-      proj_mat->SetElement(i, j, T_DC(i, j));
+      if (proj_mat->GetElement(i, j) != T_DC(i, j)) {
+        proj_mat->SetElement(i, j, T_DC(i, j));
+        projection_changed = true;
+      }
     }
   }
-  vtk_camera->Modified();
+  if (projection_changed) vtk_camera->Modified();
 }
 
 void RenderEngineVtk::UpdateWindow(const DepthRenderCamera& camera,
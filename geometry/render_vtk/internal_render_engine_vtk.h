@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -169,6 +170,19 @@ class RenderEngineVtk : public render::RenderEngine,
   void UpdateWindow(const render::DepthRenderCamera& camera,
                     const RenderingPipeline& p) const;
 
+  /* Reads back the pixels most recently rendered into the window of the given
+   pipeline, returning a pointer to its RGBA data. The rows are stored with the
+   origin in the *lower*-left corner. */
+  static const uint8_t* ReadPixels(const RenderingPipeline& p);
+
+  /* Reads back and decodes the most recently rendered color, depth, or label
+   image, respectively, directly into the given output image (which must
+   match the size of the rendered image). */
+  void ReadColorImage(systems::sensors::ImageRgba8U* color_image_out) const;
+  void ReadDepthImage(const render::DepthRenderCamera& camera,
+                      systems::sensors::ImageDepth32F* depth_image_out) const;
+  void ReadLabelImage(systems::sensors::ImageLabel16I* label_image_out) const;
+
   /* Updates VTK rendering related objects including vtkRenderWindow,
    vtkWindowToImageFilter and vtkImageExporter, so that VTK reflects
    vtkActors' pose update for rendering. */
@@ -218,6 +232,10 @@ class RenderEngineVtk : public render::RenderEngine,
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const override;
 
+  // @see RenderEngine::DoRenderImages().
+  void DoRenderImages(
+      const std::vector<render::ImageRenderRequest>& requests) override;
+
   // Common interface for loading an obj file -- used for both mesh and convex
   // shapes. If `file_name` is of an unsupported type, no geometry will be
   // added.
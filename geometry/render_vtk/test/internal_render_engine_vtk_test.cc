@@ -6,6 +6,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -1251,6 +1252,82 @@ TEST_F(RenderEngineVtkTest, DifferentCameras) {
   }
 }
 
+// Tests that rendering images in a batch produces the same images as rendering
+// them one at a time.
+TEST_F(RenderEngineVtkTest, RenderImages) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+
+  const RenderCameraCore& ref_core = depth_camera_.core();
+  const auto& ref_intrinsics = ref_core.intrinsics();
+  const DepthRenderCamera small_camera{
+      {ref_core.renderer_name(),
+       {ref_intrinsics.width() / 2, ref_intrinsics.height() / 2,
+        ref_intrinsics.fov_y()},
+       ref_core.clipping(),
+       ref_core.sensor_pose_in_camera_body()},
+      depth_camera_.depth_range()};
+  const RigidTransformd X_WC_shifted =
+      X_WC_ * RigidTransformd(Vector3d(0.2, 0.1, 0));
+  const vector<std::pair<DepthRenderCamera, RigidTransformd>> views{
+      {depth_camera_, X_WC_},
+      {small_camera, X_WC_shifted}};
+
+  // Allocate all of the images before taking their addresses.
+  vector<ImageRgba8U> colors;
+  vector<ImageDepth32F> depths;
+  vector<ImageLabel16I> labels;
+  for (const auto& [camera, _] : views) {
+    const int w = camera.core().intrinsics().width();
+    const int h = camera.core().intrinsics().height();
+    colors.emplace_back(w, h);
+    depths.emplace_back(w, h);
+    labels.emplace_back(w, h);
+  }
+  vector<render::ImageRenderRequest> requests;
+  for (int i = 0; i < static_cast<int>(views.size()); ++i) {
+    const auto& [camera, X_WC] = views[i];
+    render::ImageRenderRequest request;
+    request.X_WC = X_WC;
+    request.color_camera = ColorRenderCamera(camera.core(), kShowWindow);
+    request.depth_camera = camera;
+    request.color_image = &colors[i];
+    request.depth_image = &depths[i];
+    request.label_image = &labels[i];
+    requests.push_back(request);
+  }
+  // Also request a single image type on its own.
+  ImageLabel16I label_only(kWidth, kHeight);
+  {
+    render::ImageRenderRequest request;
+    request.X_WC = X_WC_;
+    request.color_camera = ColorRenderCamera(ref_core, kShowWindow);
+    request.label_image = &label_only;
+    requests.push_back(request);
+  }
+  EXPECT_NO_THROW(renderer_->RenderImages(requests));
+
+  // The unshifted full-size view is that of the standard test.
+  VerifyCenterShapeTest(*renderer_, "Batched images", depth_camera_, colors[0],
+                        depths[0], labels[0]);
+  EXPECT_EQ(label_only, labels[0]);
+
+  for (int i = 0; i < static_cast<int>(views.size()); ++i) {
+    SCOPED_TRACE(fmt::format("View {}", i));
+    const auto& [camera, X_WC] = views[i];
+    const int w = camera.core().intrinsics().width();
+    const int h = camera.core().intrinsics().height();
+    ImageRgba8U color(w, h);
+    ImageDepth32F depth(w, h);
+    ImageLabel16I label(w, h);
+    renderer_->UpdateViewpoint(X_WC);
+    Render(renderer_.get(), &camera, &color, &depth, &label);
+    EXPECT_EQ(colors[i], color);
+    EXPECT_EQ(depths[i], depth);
+    EXPECT_EQ(labels[i], label);
+  }
+}
+
 // Tests the ability to configure the RenderEngineVtk's default render label.
 TEST_F(RenderEngineVtkTest, DefaultProperties_RenderLabel) {
   // A variation of PopulateSphereTest(), but uses an empty set of properties.
@@ -4549,6 +4549,55 @@ TEST_F(GeometryStateRenderTest, RenderLabelImage) {
                std::exception);
 }
 
+TEST_F(GeometryStateRenderTest, RenderImages) {
+  systems::sensors::ImageRgba8U color(width(), height());
+  systems::sensors::ImageDepth32F depth(width(), height());
+  systems::sensors::ImageLabel16I label(width(), height());
+
+  // Case: all images from a single engine are rendered from the same
+  // viewpoint.
+  geometry_state_.RenderImages(color_camera("engine1"), depth_camera("engine1"),
+                               parent_id_, X_PC_, &color, &depth, &label);
+  EXPECT_TRUE(CompareMatrices(engine1_->last_updated_X_WC().GetAsMatrix4(),
+                              X_WS_.GetAsMatrix4(), 1e-15));
+  EXPECT_EQ(engine1_->num_color_renders(), 1);
+  EXPECT_EQ(engine1_->num_depth_renders(), 1);
+  EXPECT_EQ(engine1_->num_label_renders(), 1);
+
+  // Case: only the requested images are rendered.
+  geometry_state_.RenderImages(color_camera("engine1"), depth_camera("engine1"),
+                               parent_id_, X_PC_, nullptr, &depth, nullptr);
+  EXPECT_EQ(engine1_->num_color_renders(), 1);
+  EXPECT_EQ(engine1_->num_depth_renders(), 2);
+  EXPECT_EQ(engine1_->num_label_renders(), 1);
+
+  // Case: the cameras can name different engines; each engine renders its own
+  // images.
+  const auto* engine2 = dynamic_cast<const DummyRenderEngine*>(
+      geometry_state_.GetRenderEngineByName("engine2"));
+  ASSERT_NE(engine2, nullptr);
+  geometry_state_.RenderImages(color_camera("engine1"), depth_camera("engine2"),
+                               parent_id_, X_PC_, &color, &depth, &label);
+  EXPECT_EQ(engine1_->num_color_renders(), 2);
+  EXPECT_EQ(engine1_->num_depth_renders(), 2);
+  EXPECT_EQ(engine1_->num_label_renders(), 2);
+  EXPECT_EQ(engine2->num_color_renders(), 0);
+  EXPECT_EQ(engine2->num_depth_renders(), 1);
+  EXPECT_EQ(engine2->num_label_renders(), 0);
+  EXPECT_TRUE(CompareMatrices(engine2->last_updated_X_WC().GetAsMatrix4(),
+                              X_WS_.GetAsMatrix4(), 1e-15));
+
+  // Case: an invalid name for a camera whose images are requested throws.
+  EXPECT_THROW(geometry_state_.RenderImages(
+                   color_camera("engine1"), depth_camera("not_an_engine"),
+                   parent_id_, X_PC_, &color, &depth, &label),
+               std::exception);
+  // But not when none of that camera's images are requested.
+  EXPECT_NO_THROW(geometry_state_.RenderImages(
+      color_camera("engine1"), depth_camera("not_an_engine"), parent_id_,
+      X_PC_, &color, nullptr, &label));
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
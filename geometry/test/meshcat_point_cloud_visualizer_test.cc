@@ -1,5 +1,7 @@
 #include "drake/geometry/meshcat_point_cloud_visualizer.h"
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -107,6 +109,29 @@ TEST_F(MeshcatPointCloudVisualizerTest, VisualizationParameters) {
   visualizer_->set_default_rgba(Rgba(0, 0, 1, 1));
 }
 
+TEST_F(MeshcatPointCloudVisualizerTest, Encoding) {
+  SetUpDiagram();
+  diagram_->ForcedPublish(*context_);
+  const std::string full = meshcat_->GetPackedObject("cloud");
+
+  Meshcat::PointCloudEncoding encoding;
+  encoding.max_points = 2;
+  visualizer_->set_encoding(encoding);
+  diagram_->ForcedPublish(*context_);
+  EXPECT_LT(meshcat_->GetPackedObject("cloud").size(), full.size());
+
+  // The encoding survives scalar conversion.
+  auto ad_diagram = diagram_->ToAutoDiffXd();
+  auto ad_context = ad_diagram->CreateDefaultContext();
+  meshcat_->Delete("cloud");
+  ad_diagram->ForcedPublish(*ad_context);
+  EXPECT_LT(meshcat_->GetPackedObject("cloud").size(), full.size());
+
+  visualizer_->set_encoding(std::nullopt);
+  diagram_->ForcedPublish(*context_);
+  EXPECT_EQ(meshcat_->GetPackedObject("cloud").size(), full.size());
+}
+
 TEST_F(MeshcatPointCloudVisualizerTest, ScalarConversion) {
   SetUpDiagram(false);
 
@@ -1,6 +1,16 @@
 #include "drake/geometry/meshcat.h"
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <map>
 #include <thread>
 
 #include <drake_vendor/msgpack.hpp>
@@ -343,6 +353,101 @@ GTEST_TEST(MeshcatTest, SetObjectWithPointCloud) {
   EXPECT_FALSE(meshcat.GetPackedObject("rgb_cloud").empty());
 }
 
+GTEST_TEST(MeshcatTest, SetObjectWithPointCloudEncoding) {
+  Meshcat meshcat;
+
+  const int kNumPoints = 1000;
+  perception::PointCloud cloud(
+      kNumPoints, perception::pc_flags::kXYZs | perception::pc_flags::kRGBs);
+  for (int i = 0; i < kNumPoints; ++i) {
+    cloud.mutable_xyz(i) << 0.001 * i, -0.5 * std::sin(i), 2.0;
+    cloud.mutable_rgb(i) << i % 256, 7, 255;
+  }
+  // A non-finite point is skipped.
+  cloud.mutable_xyz(1).x() = std::numeric_limits<float>::quiet_NaN();
+  const Rgba rgba(1, 0, 0, 1);
+
+  meshcat.SetObject("full", cloud, 0.01, rgba);
+  const std::string full = meshcat.GetPackedObject("full");
+
+  Meshcat::PointCloudEncoding encoding;
+  EXPECT_TRUE(encoding.quantize);
+  meshcat.SetObject("quantized", cloud, 0.01, rgba, encoding);
+  const std::string quantized = meshcat.GetPackedObject("quantized");
+  // Positions shrink from 12 to 6 bytes per point, and colors from 12 to 3.
+  EXPECT_LT(3 * quantized.size(), full.size());
+
+  // Unpack the quantized message and confirm that the object's matrix maps the
+  // normalized positions back to the cloud's points.
+  using Map = std::map<std::string, msgpack::object>;
+  msgpack::object_handle oh =
+      msgpack::unpack(quantized.data(), quantized.size());
+  const Map lumped = oh.get().as<Map>().at("object").as<Map>();
+  const std::vector<double> matrix_data =
+      lumped.at("object").as<Map>().at("matrix").as<std::vector<double>>();
+  ASSERT_EQ(matrix_data.size(), 16);
+  const Eigen::Map<const Eigen::Matrix4d> matrix(matrix_data.data());
+  const Map attributes = lumped.at("geometries")
+                             .as<std::vector<msgpack::object>>()
+                             .at(0)
+                             .as<Map>()
+                             .at("data")
+                             .as<Map>()
+                             .at("attributes")
+                             .as<Map>();
+  const Map position = attributes.at("position").as<Map>();
+  EXPECT_EQ(position.at("type").as<std::string>(), "Uint16Array");
+  EXPECT_TRUE(position.at("normalized").as<bool>());
+  const msgpack::type::ext_ref position_array =
+      position.at("array").as<msgpack::type::ext_ref>();
+  ASSERT_EQ(position_array.size(), 3 * sizeof(uint16_t) * (kNumPoints - 1));
+  std::vector<uint16_t> steps(3 * (kNumPoints - 1));
+  std::memcpy(steps.data(), position_array.data(), position_array.size());
+  for (int i = 0, j = 0; i < kNumPoints; ++i) {
+    if (i == 1) continue;
+    const Eigen::Vector4d normalized(steps[3 * j] / 65535.0,
+                                     steps[3 * j + 1] / 65535.0,
+                                     steps[3 * j + 2] / 65535.0, 1.0);
+    const Eigen::Vector4d p = matrix * normalized;
+    EXPECT_TRUE(CompareMatrices(p.head<3>(),
+                                cloud.xyz(i).cast<double>(), 1e-5));
+    ++j;
+  }
+  const Map color = attributes.at("color").as<Map>();
+  EXPECT_EQ(color.at("type").as<std::string>(), "Uint8Array");
+  EXPECT_TRUE(color.at("normalized").as<bool>());
+  EXPECT_EQ(color.at("array").as<msgpack::type::ext_ref>().size(),
+            3 * (kNumPoints - 1));
+
+  // Decimation limits the number of points sent.
+  encoding.max_points = 100;
+  meshcat.SetObject("decimated", cloud, 0.01, rgba, encoding);
+  EXPECT_LT(5 * meshcat.GetPackedObject("decimated").size(),
+            quantized.size());
+
+  // Without quantization, the (decimated) points are sent as floats.
+  encoding.quantize = false;
+  meshcat.SetObject("unquantized", cloud, 0.01, rgba, encoding);
+  EXPECT_LT(meshcat.GetPackedObject("unquantized").size(), full.size());
+
+  // With no connections, there is never a backlog to respond to.
+  encoding.max_points = std::nullopt;
+  encoding.quantize = true;
+  encoding.max_backlog_bytes = 1;
+  meshcat.SetObject("quantized", cloud, 0.01, rgba, encoding);
+  EXPECT_EQ(meshcat.GetPackedObject("quantized").size(), quantized.size());
+
+  encoding.max_backlog_bytes = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      meshcat.SetObject("bad", cloud, 0.01, rgba, encoding),
+      ".*max_backlog_bytes.*must be positive.*");
+  encoding.max_backlog_bytes = std::nullopt;
+  encoding.max_points = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      meshcat.SetObject("bad", cloud, 0.01, rgba, encoding),
+      ".*max_points.*must be positive.*");
+}
+
 GTEST_TEST(MeshcatTest, SetObjectWithTriangleSurfaceMesh) {
   Meshcat meshcat;
 
@@ -515,6 +620,125 @@ GTEST_TEST(MeshcatTest, Delete) {
   EXPECT_FALSE(meshcat.HasPath("/drake"));
 }
 
+GTEST_TEST(MeshcatTest, SetTransforms) {
+  Meshcat meshcat;
+  const auto get_transform = [&meshcat](std::string_view path) {
+    std::string transform = meshcat.GetPackedTransform(path);
+    msgpack::object_handle oh =
+        msgpack::unpack(transform.data(), transform.size());
+    auto data = oh.get().as<internal::SetTransformData>();
+    EXPECT_EQ(data.type, "set_transform");
+    return Eigen::Matrix4d(Eigen::Map<Eigen::Matrix4d>(data.matrix));
+  };
+
+  const RigidTransformd X1{math::RollPitchYawd(0.5, 0.26, -3),
+                           Vector3d{0.9, -2.0, 0.12}};
+  const RigidTransformd X2{Vector3d{4, 5, 6}};
+  meshcat.SetTransforms({"frame", "/foo/frame"}, {X1, X2});
+  EXPECT_TRUE(meshcat.HasPath("/drake/frame"));
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X1.GetAsMatrix4()));
+  EXPECT_TRUE(CompareMatrices(get_transform("/foo/frame"), X2.GetAsMatrix4()));
+
+  // Changes within the tolerance are not sent; larger ones are.
+  const RigidTransformd X1_nudged{X1.rotation(),
+                                  X1.translation() + Vector3d(0, 0, 1e-9)};
+  meshcat.SetTransforms({"frame"}, {X1_nudged}, std::nullopt, 1e-6);
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X1.GetAsMatrix4()));
+  meshcat.SetTransforms({"frame"}, {X1_nudged});
+  EXPECT_TRUE(
+      CompareMatrices(get_transform("frame"), X1_nudged.GetAsMatrix4()));
+  meshcat.SetTransforms({"frame"}, {X2}, std::nullopt, 1e-6);
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X2.GetAsMatrix4()));
+
+  // SetTransform() also counts as having sent a transform.
+  meshcat.SetTransform("frame", X1);
+  meshcat.SetTransforms({"frame"}, {X1_nudged}, std::nullopt, 1e-6);
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X1.GetAsMatrix4()));
+
+  // Once a path is deleted, even an unchanged transform is sent again, no
+  // matter how the path is spelled.
+  meshcat.Delete("//foo/");
+  EXPECT_FALSE(meshcat.HasPath("/foo/frame"));
+  meshcat.SetTransforms({"/foo//frame"}, {X2});
+  EXPECT_TRUE(meshcat.HasPath("/foo/frame"));
+  EXPECT_TRUE(CompareMatrices(get_transform("/foo/frame"), X2.GetAsMatrix4()));
+
+  // Every transform is recorded, whether or not it is sent.
+  meshcat.StartRecording();
+  meshcat.SetTransforms({"frame"}, {X1}, 0.0);
+  EXPECT_TRUE(meshcat.get_mutable_recording()
+                  .get_key_frame<std::vector<double>>(0, "frame", "position")
+                  .has_value());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(meshcat.SetTransforms({"frame"}, {}),
+                              ".*1 paths but 0 transforms.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      meshcat.SetTransforms({"frame"}, {X1}, std::nullopt, -1.0),
+      ".*tolerance.*non-negative.*");
+}
+
+// SetTransforms() holds transforms back while a connection is backlogged, but
+// Flush() still sends them.
+GTEST_TEST(MeshcatTest, FlushSendsHeldBackTransforms) {
+  Meshcat meshcat;
+  const auto get_transform = [&meshcat](std::string_view path) {
+    std::string transform = meshcat.GetPackedTransform(path);
+    msgpack::object_handle oh =
+        msgpack::unpack(transform.data(), transform.size());
+    auto data = oh.get().as<internal::SetTransformData>();
+    return Eigen::Matrix4d(Eigen::Map<Eigen::Matrix4d>(data.matrix));
+  };
+  const RigidTransformd X1{Vector3d{1, 2, 3}};
+  const RigidTransformd X2{Vector3d{4, 5, 6}};
+  meshcat.SetTransforms({"frame"}, {X1});
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X1.GetAsMatrix4()));
+
+  // Open a websocket connection that (for now) doesn't read anything.
+  const int client = ::socket(AF_INET, SOCK_STREAM, 0);
+  ASSERT_GE(client, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(meshcat.port());
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  ASSERT_EQ(::connect(client, reinterpret_cast<sockaddr*>(&address),
+                      sizeof(address)),
+            0);
+  const std::string request =
+      "GET / HTTP/1.1\r\n"
+      "Host: localhost\r\n"
+      "Upgrade: websocket\r\n"
+      "Connection: Upgrade\r\n"
+      "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+      "Sec-WebSocket-Version: 13\r\n\r\n";
+  ASSERT_EQ(::send(client, request.data(), request.size(), 0),
+            static_cast<ssize_t>(request.size()));
+  while (meshcat.GetNumActiveConnections() < 1) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // Publish far more data than the operating system will buffer, so that the
+  // connection is backlogged; the new transform is then held back.
+  const std::vector<double> big(1 << 20);
+  for (int i = 0; i < 8; ++i) {
+    meshcat.SetProperty("/big", "data", big);
+  }
+  meshcat.SetTransforms({"frame"}, {X2});
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X1.GetAsMatrix4()));
+
+  // Once the client starts reading, Flush() sends the held back transform.
+  std::thread reader([client]() {
+    char buffer[4096];
+    while (::recv(client, buffer, sizeof(buffer), 0) > 0) {
+    }
+  });
+  meshcat.Flush();
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X2.GetAsMatrix4()));
+
+  ::shutdown(client, SHUT_RDWR);
+  reader.join();
+  ::close(client);
+}
+
 // Tests three methods of SceneTreeElement:
 // - SceneTreeElement::operator[]() is used in Meshcat::Set*().  We'll use
 // SetTransform() here.
@@ -2009,6 +2009,29 @@ TEST_F(ProximityEngineHydro, ComputeContactSurfacesResultOrdering) {
   }
 }
 
+// Consecutive calls to ComputeContactSurfaces() start from the previous call's
+// bounding volume tree traversals; confirm that this doesn't change the results
+// compared to an engine without any history (a copy doesn't copy the history).
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesReusesTraversals) {
+  for (const double expansion : {0.0, 1e-4, 2e-4, 0.04, 0.0401, 0.0}) {
+    unordered_map<GeometryId, RigidTransformd> poses = poses_;
+    for (auto& [id, X_WG] : poses) {
+      X_WG.set_translation(X_WG.translation() * (1 + expansion));
+    }
+    engine_.UpdateWorldPoses(poses);
+    const auto results = engine_.ComputeContactSurfaces(
+        HydroelasticContactRepresentation::kPolygon, poses);
+    const ProximityEngine<double> fresh_engine(engine_);
+    const auto expected = fresh_engine.ComputeContactSurfaces(
+        HydroelasticContactRepresentation::kPolygon, poses);
+    ASSERT_EQ(results.size(), expected.size());
+    ASSERT_GT(results.size(), 0);
+    for (size_t i = 0; i < results.size(); ++i) {
+      EXPECT_TRUE(results[i].Equal(expected[i]));
+    }
+  }
+}
+
 // Confirms that the ComputeContactSurfacesWithFallback() computation returns
 // the same results twice in a row. This test is explicitly required because it
 // is known that updating the pose in the FCL tree can lead to erratic ordering.
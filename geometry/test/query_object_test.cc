@@ -207,6 +207,9 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   ImageLabel16I label;
   EXPECT_DEFAULT_ERROR(default_object.RenderLabelImage(
       color_camera, FrameId::get_new_id(), X_WC, &label));
+  EXPECT_DEFAULT_ERROR(default_object.RenderImages(
+      color_camera, depth_camera, FrameId::get_new_id(), X_WC, &color, &depth,
+      &label));
 
   EXPECT_DEFAULT_ERROR(default_object.GetRenderEngineByName("dummy"));
 
@@ -0,0 +1,184 @@
+// @file
+// Benchmarks for the forward dynamics of a continuous MultibodyPlant.
+//
+// This compares the O(n) articulated body algorithm used by
+// MultibodyPlant::EvalTimeDerivatives() against forming the mass matrix and
+// solving the equations of motion with a dense factorization, for serial
+// chains of increasing length.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/multibody/plant/externally_applied_spatial_force.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using systems::Context;
+
+// We use this alias to silence cpplint barking at mutable references.
+using BenchmarkStateRef = benchmark::State&;
+
+// Fixture that holds a continuous plant modeling a serial chain of links
+// connected by damped revolute joints, with the number of links given by the
+// benchmark case's "Arg". The chain is subject to gravity, actuation through
+// the applied generalized force input port and an external spatial force on
+// its last link.
+class SerialChain : public benchmark::Fixture {
+ public:
+  SerialChain() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(BenchmarkStateRef state) override {
+    MakePlant(state.range(0));
+    SetUpNonZeroStateAndInputs();
+  }
+
+ protected:
+  void MakePlant(int num_links) {
+    const double kLength = 0.1;
+    const double kMass = 0.5;
+    const double kDamping = 0.01;
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidBoxWithMass(kMass, kLength, kLength / 10,
+                                                 kLength / 10);
+    const Body<double>* parent = &plant_->world_body();
+    for (int i = 0; i < num_links; ++i) {
+      const RigidBody<double>& link =
+          plant_->AddRigidBody("link" + std::to_string(i), M_BBo_B);
+      // Alternate the joint axes so that the chain moves in 3D.
+      const Vector3d axis =
+          (i % 2 == 0) ? Vector3d::UnitY() : Vector3d::UnitZ();
+      plant_->AddJoint<RevoluteJoint>(
+          "joint" + std::to_string(i), *parent,
+          RigidTransformd(Vector3d(kLength / 2, 0, 0)), link,
+          RigidTransformd(Vector3d(-kLength / 2, 0, 0)), axis, kDamping);
+      parent = &link;
+    }
+    plant_->Finalize();
+    tip_ = parent->index();
+    context_ = plant_->CreateDefaultContext();
+  }
+
+  // Sets the plant to have non-zero state and inputs. In some cases, computing
+  // using zeros will not tickle the relevant paths through the code.
+  void SetUpNonZeroStateAndInputs() {
+    const int nq = plant_->num_positions();
+    const int nv = plant_->num_velocities();
+    plant_->SetPositions(context_.get(), VectorXd::LinSpaced(nq, 0.1, 0.9));
+    plant_->SetVelocities(context_.get(), VectorXd::LinSpaced(nv, -0.5, 0.5));
+
+    const VectorXd tau = VectorXd::LinSpaced(nv, 0.01, 0.09);
+    generalized_force_input_ =
+        &plant_->get_applied_generalized_force_input_port().FixValue(
+            context_.get(), tau);
+    ExternallyAppliedSpatialForce<double> tip_force;
+    tip_force.body_index = tip_;
+    tip_force.p_BoBq_B = Vector3d(0.05, 0, 0);
+    tip_force.F_Bq_W =
+        SpatialForce<double>(Vector3d(0.1, 0.2, 0.3), Vector3d(1.0, 2.0, 3.0));
+    plant_->get_applied_spatial_force_input_port().FixValue(
+        context_.get(),
+        std::vector<ExternallyAppliedSpatialForce<double>>{tip_force});
+
+    // The same external forces, for the mass matrix based computation.
+    external_forces_ = std::make_unique<MultibodyForces<double>>(*plant_);
+    external_forces_->mutable_generalized_forces() = tau;
+    const Body<double>& tip = plant_->get_body(tip_);
+    const Vector3d p_BoBq_W =
+        tip.EvalPoseInWorld(*context_).rotation() * tip_force.p_BoBq_B;
+    tip.AddInForce(*context_, p_BoBq_W, tip_force.F_Bq_W,
+                   plant_->world_frame(), external_forces_.get());
+
+    forces_ = std::make_unique<MultibodyForces<double>>(*plant_);
+    mass_matrix_ = MatrixXd::Zero(nv, nv);
+    vdot_ = VectorXd::Zero(nv);
+  }
+
+  // Use these functions to invalidate input- or state-dependent computations
+  // each benchmarked step. See cassie.cc for why we don't disable the cache.
+  void InvalidateInput() {
+    generalized_force_input_->GetMutableData();
+  }
+  void InvalidateState() {
+    context_->NoteContinuousStateChange();
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  BodyIndex tip_;
+  std::unique_ptr<Context<double>> context_;
+  systems::FixedInputPortValue* generalized_force_input_{nullptr};
+
+  // Data used in the MassMatrixSolve cases (only).
+  std::unique_ptr<MultibodyForces<double>> external_forces_;
+  std::unique_ptr<MultibodyForces<double>> forces_;
+  MatrixXd mass_matrix_;
+  VectorXd vdot_;
+};
+
+// Forward dynamics with the O(n) articulated body algorithm, as done by the
+// plant when computing time derivatives.
+BENCHMARK_DEFINE_F(SerialChain, ForwardDynamics)(BenchmarkStateRef state) {
+  for (auto _ : state) {
+    InvalidateInput();
+    InvalidateState();
+    plant_->EvalTimeDerivatives(*context_);
+  }
+}
+
+// Forward dynamics computing the same accelerations as M⁻¹⋅(τ - C(q,v)v), with
+// M formed by CalcMassMatrix(), C(q,v)v - τ by inverse dynamics and a dense
+// O(n³) factorization of M.
+BENCHMARK_DEFINE_F(SerialChain, MassMatrixSolve)(BenchmarkStateRef state) {
+  const VectorXd zero_vdot = VectorXd::Zero(plant_->num_velocities());
+  for (auto _ : state) {
+    InvalidateState();
+    plant_->CalcMassMatrix(*context_, &mass_matrix_);
+    plant_->CalcForceElementsContribution(*context_, forces_.get());
+    forces_->AddInForces(*external_forces_);
+    const VectorXd minus_tau =
+        plant_->CalcInverseDynamics(*context_, zero_vdot, *forces_);
+    vdot_ = mass_matrix_.ldlt().solve(-minus_tau);
+    benchmark::DoNotOptimize(vdot_);
+  }
+}
+
+BENCHMARK_REGISTER_F(SerialChain, ForwardDynamics)
+  ->Unit(benchmark::kMicrosecond)
+  ->Arg(10)
+  ->Arg(50)
+  ->Arg(100)
+  ->Arg(200)
+  ->Arg(500);
+
+BENCHMARK_REGISTER_F(SerialChain, MassMatrixSolve)
+  ->Unit(benchmark::kMicrosecond)
+  ->Arg(10)
+  ->Arg(50)
+  ->Arg(100)
+  ->Arg(200)
+  ->Arg(500);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,15 +1,31 @@
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
+#include <common_robotics_utilities/openmp_helpers.hpp>
+
 #include "drake/multibody/contact_solvers/minimum_degree_ordering.h"
 
 namespace drake {
 namespace multibody {
 namespace contact_solvers {
 namespace internal {
+namespace {
+
+/* The elimination tree is split into subtrees of roughly 1/kNumSubtreeTasks of
+ the total work each (see PartitionEliminationTree()). This is a fixed number
+ rather than the number of threads so that the result of the parallel
+ factorization doesn't depend on the number of threads. */
+constexpr int kNumSubtreeTasks = 64;
+
+/* Below this many off-diagonal blocks in a column, its rank-1 update is not
+ worth distributing across threads. */
+constexpr int kMinParallelUpdateSize = 16;
+
+}  // namespace
 
 template <typename BlockType>
 BlockSparseCholeskySolver<BlockType>::~BlockSparseCholeskySolver() = default;
@@ -33,33 +49,74 @@ void BlockSparseCholeskySolver<BlockType>::UpdateMatrix(
 }
 
 template <typename BlockType>
-bool BlockSparseCholeskySolver<BlockType>::Factor() {
+bool BlockSparseCholeskySolver<BlockType>::Factor(bool parallelize) {
   DRAKE_THROW_UNLESS(solver_mode() == SolverMode::kAnalyzed);
+  if (parallelize) {
+    return ParallelFactor();
+  }
+  const int max_col = L_->block_cols() - 1;
   for (int j = 0; j < L_->block_cols(); ++j) {
-    /* Update diagonal. */
-    const BlockType& Ajj = L_->diagonal_block(j);
-    L_diag_[j].compute(Ajj);
-    if (L_diag_[j].info() != Eigen::Success) {
+    if (!FactorColumn(j)) {
       solver_mode_ = SolverMode::kEmpty;
       return false;
     }
-    L_->SetBlockFlat(0, j, L_diag_[j].matrixL());
-    /* Update L₂₁ column.
-     | a₁₁  *  | = | λ₁₁  0 | * | λ₁₁ᵀ L₂₁ᵀ |
-     | a₂₁ a₂₂ |   | L₂₁ L₂₂|   |  0   L₂₂ᵀ |
-     So we have
-      L₂₁λ₁₁ᵀ = a₂₁, and thus
-      λ₁₁L₂₁ᵀ = a₂₁ᵀ */
-    const std::vector<int>& row_blocks = L_->block_row_indices(j);
-    const auto Ljj = L_diag_[j].matrixL();
-    /* We start from flat = 1 here to skip the j,j diagonal entry. */
-    for (int flat = 1; flat < ssize(row_blocks); ++flat) {
-      const BlockType& Aij = L_->block_flat(flat, j);
-      BlockType Lij = Ljj.solve(Aij.transpose()).transpose();
-      L_->SetBlockFlat(flat, j, std::move(Lij));
-    }
     /* Update L₂₂ according to L₂₂ = a₂₂ - L₂₁⋅L₂₁ᵀ. */
-    RightLookingSymmetricRank1Update(j);
+    RightLookingSymmetricRank1Update(j, max_col, false);
+  }
+  solver_mode_ = SolverMode::kFactored;
+  return true;
+}
+
+template <typename BlockType>
+bool BlockSparseCholeskySolver<BlockType>::ParallelFactor() {
+  /* Each subtree only updates its own columns and the top columns above it.
+   The former are private to the subtree, and the latter are deferred, so the
+   subtrees are independent. */
+  const int num_subtrees = subtree_columns_.size();
+  std::vector<uint8_t> subtree_succeeded(num_subtrees, 1);
+  CRU_OMP_PARALLEL_FOR_IF(num_subtrees > 1)
+  for (int k = 0; k < num_subtrees; ++k) {
+    const std::vector<int>& columns = subtree_columns_[k];
+    const int root = columns.back();
+    for (int j : columns) {
+      if (!FactorColumn(j)) {
+        subtree_succeeded[k] = 0;
+        break;
+      }
+      RightLookingSymmetricRank1Update(j, root, false);
+    }
+  }
+  if (std::find(subtree_succeeded.begin(), subtree_succeeded.end(), 0) !=
+      subtree_succeeded.end()) {
+    solver_mode_ = SolverMode::kEmpty;
+    return false;
+  }
+
+  /* Apply the deferred updates. Each top column only receives updates into its
+   own blocks, so the top columns can be processed concurrently. */
+  const int num_top_columns = top_columns_.size();
+  CRU_OMP_PARALLEL_FOR_IF(num_top_columns > 1)
+  for (int t = 0; t < num_top_columns; ++t) {
+    const int c = top_columns_[t];
+    for (const auto& [j, flat_c] : deferred_updates_[c]) {
+      const std::vector<int>& blocks_in_col_j = L_->block_row_indices(j);
+      const BlockType& B = L_->block_flat(flat_c, j);
+      for (int l = flat_c; l < ssize(blocks_in_col_j); ++l) {
+        L_->AddToBlock(blocks_in_col_j[l], c,
+                       -L_->block_flat(l, j) * B.transpose());
+      }
+    }
+  }
+
+  /* The top columns form a chain of dependencies; factor them in order,
+   distributing the updates of each among the columns it affects. */
+  const int max_col = L_->block_cols() - 1;
+  for (int j : top_columns_) {
+    if (!FactorColumn(j)) {
+      solver_mode_ = SolverMode::kEmpty;
+      return false;
+    }
+    RightLookingSymmetricRank1Update(j, max_col, true);
   }
   solver_mode_ = SolverMode::kFactored;
   return true;
@@ -157,6 +214,66 @@ void BlockSparseCholeskySolver<BlockType>::SetMatrixImpl(
   L_diag_.resize(A.block_cols());
   /* Fourth documented responsibility: UpdateMatrix. */
   UpdateMatrix(A);
+  /* Fifth documented responsibility: schedule the parallel factorization. */
+  PartitionEliminationTree();
+}
+
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::PartitionEliminationTree() {
+  const int n = L_->block_cols();
+  /* The parent of column j in the elimination tree is the first block row
+   below the diagonal in the j-th block column of L. Since parents come after
+   their children, a single forward pass accumulates each subtree's work,
+   estimated by the number of block products in the rank-1 updates. */
+  std::vector<int> parent(n, -1);
+  std::vector<double> work(n, 0.0);
+  double total_work = 0.0;
+  for (int j = 0; j < n; ++j) {
+    const std::vector<int>& blocks_in_col_j = L_->block_row_indices(j);
+    const double num_blocks = blocks_in_col_j.size();
+    work[j] += num_blocks * num_blocks;
+    total_work += num_blocks * num_blocks;
+    if (blocks_in_col_j.size() > 1) {
+      parent[j] = blocks_in_col_j[1];
+      work[parent[j]] += work[j];
+    }
+  }
+
+  /* The subtrees are the maximal ones with at most the threshold's work. Work
+   only grows towards the roots, so all the ancestors of a subtree are top
+   columns. Visiting parents before their children assigns every column to
+   its subtree (if any). */
+  const double threshold = total_work / kNumSubtreeTasks;
+  std::vector<int> subtree(n, -1);
+  int num_subtrees = 0;
+  for (int j = n - 1; j >= 0; --j) {
+    if (work[j] > threshold) continue;
+    if (parent[j] >= 0 && subtree[parent[j]] >= 0) {
+      subtree[j] = subtree[parent[j]];
+    } else {
+      subtree[j] = num_subtrees++;
+    }
+  }
+
+  subtree_columns_.clear();
+  subtree_columns_.resize(num_subtrees);
+  top_columns_.clear();
+  deferred_updates_.clear();
+  deferred_updates_.resize(n);
+  for (int j = 0; j < n; ++j) {
+    if (subtree[j] < 0) {
+      top_columns_.push_back(j);
+      continue;
+    }
+    subtree_columns_[subtree[j]].push_back(j);
+    const std::vector<int>& blocks_in_col_j = L_->block_row_indices(j);
+    for (int flat = 1; flat < ssize(blocks_in_col_j); ++flat) {
+      const int c = blocks_in_col_j[flat];
+      if (subtree[c] < 0) {
+        deferred_updates_[c].emplace_back(j, flat);
+      }
+    }
+  }
 }
 
 template <typename BlockType>
@@ -232,13 +349,46 @@ BlockSparsityPattern BlockSparseCholeskySolver<BlockType>::SymbolicFactor(
       BlockSparsityPattern(permuted_block_sizes, permuted_sparsity_pattern));
 }
 
+template <typename BlockType>
+bool BlockSparseCholeskySolver<BlockType>::FactorColumn(int j) {
+  /* Update diagonal. */
+  const BlockType& Ajj = L_->diagonal_block(j);
+  L_diag_[j].compute(Ajj);
+  if (L_diag_[j].info() != Eigen::Success) {
+    return false;
+  }
+  L_->SetBlockFlat(0, j, L_diag_[j].matrixL());
+  /* Update L₂₁ column.
+   | a₁₁  *  | = | λ₁₁  0 | * | λ₁₁ᵀ L₂₁ᵀ |
+   | a₂₁ a₂₂ |   | L₂₁ L₂₂|   |  0   L₂₂ᵀ |
+   So we have
+    L₂₁λ₁₁ᵀ = a₂₁, and thus
+    λ₁₁L₂₁ᵀ = a₂₁ᵀ */
+  const std::vector<int>& row_blocks = L_->block_row_indices(j);
+  const auto Ljj = L_diag_[j].matrixL();
+  /* We start from flat = 1 here to skip the j,j diagonal entry. */
+  for (int flat = 1; flat < ssize(row_blocks); ++flat) {
+    const BlockType& Aij = L_->block_flat(flat, j);
+    BlockType Lij = Ljj.solve(Aij.transpose()).transpose();
+    L_->SetBlockFlat(flat, j, std::move(Lij));
+  }
+  return true;
+}
+
 template <typename BlockType>
 void BlockSparseCholeskySolver<BlockType>::RightLookingSymmetricRank1Update(
-    int j) {
+    int j, int max_col, bool parallelize) {
   const std::vector<int>& blocks_in_col_j = L_->block_row_indices(j);
   const int n = blocks_in_col_j.size();
-  /* We start from k = 1 here to skip the j,j diagonal entry. */
-  for (int k = 1; k < n; ++k) {
+  /* The block rows are sorted, so the affected columns are those in
+   [1, end). */
+  const int end = std::upper_bound(blocks_in_col_j.begin() + 1,
+                                   blocks_in_col_j.end(), max_col) -
+                  blocks_in_col_j.begin();
+  /* We start from k = 1 here to skip the j,j diagonal entry. Each k updates a
+   different column. */
+  CRU_OMP_PARALLEL_FOR_IF(parallelize && end - 1 >= kMinParallelUpdateSize)
+  for (int k = 1; k < end; ++k) {
     const int col = blocks_in_col_j[k];
     const BlockType& B = L_->block_flat(k, j);
     for (int l = k; l < n; ++l) {
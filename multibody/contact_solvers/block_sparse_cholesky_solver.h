@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "drake/common/copyable_unique_ptr.h"
@@ -115,10 +116,17 @@ class BlockSparseCholeskySolver {
    matrix set in SetMatrix() or UpdateMatrix() is not positive definite. If
    failure is encountered, the user should verify that the specified matrix is
    positive definite and not poorly conditioned.
+
+   If `parallelize` is true, independent subtrees of the elimination tree are
+   factored concurrently, and the updates from each remaining column are
+   applied to the columns they affect concurrently. The order of the
+   floating point operations then differs from the serial factorization's (so
+   the results may differ by round-off), but it doesn't depend on the number of
+   threads.
    @throws std::exception if solver_mode() is not SolverMode::kAnalyzed.
    @post solver_mode() is SolverMode::kFactored if factorization is successful
    and is SolverMode::kEmpty otherwise. */
-  [[nodiscard]] bool Factor();
+  [[nodiscard]] bool Factor(bool parallelize = false);
 
   /* Solves the system A⋅x = b and returns x.
    @throws std::exception if b.size() is incompatible with the size of the
@@ -156,7 +164,8 @@ class BlockSparseCholeskySolver {
     1. sets `block_permutation_`;
     2. sets `scalar_permutation_`;
     3. allocates for `L_` and `L_diag_`;
-    4. calls UpdateMatrix(A) to copy the numeric values of A to L_.
+    4. calls UpdateMatrix(A) to copy the numeric values of A to L_;
+    5. calls PartitionEliminationTree().
    @param[in] A                     The matrix to be factored.
    @param[in] elimination_ordering  Elimination ordering of the blocks of A.
                                     Must be a permutation of {0, 1, ...,
@@ -186,9 +195,27 @@ class BlockSparseCholeskySolver {
   BlockSparsityPattern SymbolicFactor(
       const SymmetricMatrix& A, const std::vector<int>& elimination_ordering);
 
-  /* Performs L(j+1:, j+1:) -= L(j+1:, j) * L(j+1:, j).transpose().
+  /* Partitions the elimination tree of L_ into the subtrees that Factor() may
+   factor in parallel and the remaining (top) columns, setting
+   `subtree_columns_`, `top_columns_`, and `deferred_updates_`.
+   @pre L_ has been allocated. */
+  void PartitionEliminationTree();
+
+  /* Computes the j-th block column of L, assuming all updates from the columns
+   preceding it have been applied. Returns false if the diagonal block is not
+   positive definite.
+   @pre 0 <= j < L.block_cols(). */
+  bool FactorColumn(int j);
+
+  /* Performs L(j+1:, j+1:) -= L(j+1:, j) * L(j+1:, j).transpose(), restricted
+   to the block columns of L(j+1:, j+1:) whose index is no greater than
+   `max_col`. The affected block columns are updated concurrently if
+   `parallelize` is true.
    @pre 0 <= j < L.block_cols(). */
-  void RightLookingSymmetricRank1Update(int j);
+  void RightLookingSymmetricRank1Update(int j, int max_col, bool parallelize);
+
+  /* The parallel variant of Factor(). */
+  bool ParallelFactor();
 
   /* Permutes the given matrix A with `block_permutation_` p and set L such that
    the lower triangular part of L satisfies L(p(i), p(j)) = A(i, j).
@@ -211,6 +238,18 @@ class BlockSparseCholeskySolver {
    index into L_. */
   PartialPermutation scalar_permutation_;
 
+  /* The schedule for ParallelFactor(), computed by PartitionEliminationTree().
+   Each entry of `subtree_columns_` lists (in increasing order) the block
+   columns of a subtree of the elimination tree that can be factored
+   independently of all the others; its root is the last entry. The columns in
+   no such subtree are listed (in increasing order) in `top_columns_`. For a
+   top column c, `deferred_updates_[c]` lists the pairs (j, flat) for all
+   subtree columns j whose rank-1 update affects c, where L(c, j) is
+   `L_->block_flat(flat, j)`. */
+  std::vector<std::vector<int>> subtree_columns_;
+  std::vector<int> top_columns_;
+  std::vector<std::vector<std::pair<int, int>>> deferred_updates_;
+
   reset_after_move<SolverMode> solver_mode_{SolverMode::kEmpty};
 };
 
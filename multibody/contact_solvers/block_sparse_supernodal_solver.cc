@@ -0,0 +1,144 @@
+#include "drake/multibody/contact_solvers/block_sparse_supernodal_solver.h"
+
+#include <tuple>
+#include <utility>
+
+using Eigen::MatrixXd;
+using std::vector;
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+/* Returns the block sparsity pattern of H = M + Jᵀ G J, with one block per
+ block column of J. Block columns t₁ and t₂ of H are coupled iff some block
+ row of J has nonzero blocks in both of them.
+ @throws std::exception if `jacobian_blocks` are invalid (see
+ GetJacobianBlockSizesVerifyTriplets()). */
+BlockSparsityPattern MakeHessianSparsityPattern(
+    const vector<BlockMatrixTriplet>& jacobian_blocks,
+    const vector<vector<int>>& row_to_triplet_index) {
+  vector<int> block_sizes =
+      GetJacobianBlockSizesVerifyTriplets(jacobian_blocks);
+  const int num_column_blocks = block_sizes.size();
+  vector<vector<int>> neighbors(num_column_blocks);
+  for (int t = 0; t < num_column_blocks; ++t) {
+    neighbors[t].push_back(t);
+  }
+  for (const vector<int>& triplets : row_to_triplet_index) {
+    if (triplets.size() == 2) {
+      /* GetRowToTripletMapping() sorts the triplets by block column. */
+      const int t1 = std::get<1>(jacobian_blocks[triplets[0]]);
+      const int t2 = std::get<1>(jacobian_blocks[triplets[1]]);
+      neighbors[t1].push_back(t2);
+    }
+  }
+  return BlockSparsityPattern(std::move(block_sizes), std::move(neighbors));
+}
+
+}  // namespace
+
+BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
+    int num_jacobian_row_blocks,
+    const vector<BlockMatrixTriplet>& jacobian_blocks,
+    const vector<MatrixXd>& mass_matrices, bool parallelize)
+    : jacobian_blocks_(jacobian_blocks),
+      row_to_triplet_index_(
+          GetRowToTripletMapping(num_jacobian_row_blocks, jacobian_blocks)),
+      H_(MakeHessianSparsityPattern(jacobian_blocks, row_to_triplet_index_)),
+      parallelize_(parallelize) {
+  const vector<int>& block_sizes = H_.sparsity_pattern().block_sizes();
+  // Will throw an exception if verification fails.
+  VerifyMassMatrixPartitionRefinesJacobianPartition(block_sizes,
+                                                    mass_matrices);
+  /* Gather the mass matrices into one diagonal block per block column of J. */
+  mass_matrix_blocks_.reserve(block_sizes.size());
+  int m = 0;
+  for (int size : block_sizes) {
+    MatrixXd& M = mass_matrix_blocks_.emplace_back(MatrixXd::Zero(size, size));
+    int offset = 0;
+    while (offset < size) {
+      const int mass_size = mass_matrices[m].rows();
+      M.block(offset, offset, mass_size, mass_size) = mass_matrices[m];
+      offset += mass_size;
+      ++m;
+    }
+  }
+}
+
+BlockSparseSuperNodalSolver::~BlockSparseSuperNodalSolver() = default;
+
+bool BlockSparseSuperNodalSolver::DoSetWeightMatrix(
+    const vector<MatrixXd>& block_diagonal_G) {
+  H_.SetZero();
+  for (int t = 0; t < ssize(mass_matrix_blocks_); ++t) {
+    H_.AddToBlock(t, t, mass_matrix_blocks_[t]);
+  }
+  /* Each block row p of J spans the consecutive blocks of G in
+   [g_start, g_end], and contributes Jₚᵀ Gₚ Jₚ to H. */
+  int g = 0;
+  for (const vector<int>& triplets : row_to_triplet_index_) {
+    const int num_rows = std::get<2>(jacobian_blocks_[triplets[0]]).rows();
+    const int g_start = g;
+    int num_rows_found = 0;
+    while (num_rows_found < num_rows && g < ssize(block_diagonal_G)) {
+      num_rows_found += block_diagonal_G[g].rows();
+      ++g;
+    }
+    if (num_rows_found != num_rows) {
+      return false;
+    }
+    const int g_end = g - 1;
+    vector<MatrixBlock<double>> GJs;
+    for (int triplet : triplets) {
+      GJs.push_back(std::get<2>(jacobian_blocks_[triplet])
+                        .LeftMultiplyByBlockDiagonal(block_diagonal_G, g_start,
+                                                     g_end));
+    }
+    /* The triplets are sorted by block column, so b <= a gives the blocks in
+     the lower triangle. */
+    for (int a = 0; a < ssize(triplets); ++a) {
+      const int ta = std::get<1>(jacobian_blocks_[triplets[a]]);
+      const MatrixBlock<double>& Ja =
+          std::get<2>(jacobian_blocks_[triplets[a]]);
+      for (int b = 0; b <= a; ++b) {
+        const int tb = std::get<1>(jacobian_blocks_[triplets[b]]);
+        MatrixXd JaT_G_Jb = MatrixXd::Zero(Ja.cols(), GJs[b].cols());
+        Ja.TransposeAndMultiplyAndAddTo(GJs[b], &JaT_G_Jb);
+        H_.AddToBlock(ta, tb, JaT_G_Jb);
+      }
+    }
+  }
+  if (g != ssize(block_diagonal_G)) {
+    return false;
+  }
+
+  /* The sparsity pattern of H never changes, so the elimination ordering is
+   only computed the first time (or after a failed factorization). */
+  if (solver_.solver_mode() ==
+      BlockSparseCholeskySolver<MatrixXd>::SolverMode::kEmpty) {
+    solver_.SetMatrix(H_);
+  } else {
+    solver_.UpdateMatrix(H_);
+  }
+  return true;
+}
+
+MatrixXd BlockSparseSuperNodalSolver::DoMakeFullMatrix() const {
+  return H_.MakeDenseMatrix();
+}
+
+bool BlockSparseSuperNodalSolver::DoFactor() {
+  return solver_.Factor(parallelize_);
+}
+
+void BlockSparseSuperNodalSolver::DoSolveInPlace(Eigen::VectorXd* b) const {
+  solver_.SolveInPlace(b);
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
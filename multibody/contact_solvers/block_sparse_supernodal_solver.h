@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
+#include "drake/multibody/contact_solvers/supernodal_solver.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+// A SuperNodalSolver that assembles H = M + Jᵀ G J into a block sparse matrix
+// (with one block per block column of J) and factors it with a
+// BlockSparseCholeskySolver. Unlike ConexSuperNodalSolver, it can factor
+// independent parts of H (e.g. the dofs of different robots that aren't in
+// contact with each other) concurrently; see
+// BlockSparseCholeskySolver::Factor().
+class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BlockSparseSuperNodalSolver)
+
+  // Constructs a solver for H = M + Jᵀ G J. See ConexSuperNodalSolver for the
+  // requirements on `num_jacobian_row_blocks`, `jacobian_blocks`, and
+  // `mass_matrices`; an exception is thrown if they aren't met.
+  // @param parallelize
+  //   If true, Factor() distributes the factorization across threads.
+  BlockSparseSuperNodalSolver(
+      int num_jacobian_row_blocks,
+      const std::vector<BlockMatrixTriplet>& jacobian_blocks,
+      const std::vector<Eigen::MatrixXd>& mass_matrices,
+      bool parallelize = false);
+
+  ~BlockSparseSuperNodalSolver();
+
+ private:
+  /* NVI implementations. */
+  bool DoSetWeightMatrix(
+      const std::vector<Eigen::MatrixXd>& block_diagonal_G) final;
+  Eigen::MatrixXd DoMakeFullMatrix() const final;
+  bool DoFactor() final;
+  void DoSolveInPlace(Eigen::VectorXd* b) const final;
+  int DoGetSize() const final { return H_.rows(); }
+
+  // The blocks of J, and for each block row of J the indices into
+  // `jacobian_blocks_` of its (one or two) blocks, sorted by block column.
+  std::vector<BlockMatrixTriplet> jacobian_blocks_;
+  std::vector<std::vector<int>> row_to_triplet_index_;
+  // The diagonal blocks of M, one for each block column of J.
+  std::vector<Eigen::MatrixXd> mass_matrix_blocks_;
+  BlockSparseSymmetricMatrix H_;
+  BlockSparseCholeskySolver<Eigen::MatrixXd> solver_;
+  bool parallelize_{};
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -57,42 +57,6 @@ void ComputeWeightMatrixTerms(const vector<MatrixBlock<double>>& J_blocks,
   }
 }
 
-void VerifyMassMatrixPartitionRefinesJacobianPartition(
-    const std::vector<int>& jacobian_column_block_size,
-    const vector<MatrixXd>& mass_matrices) {
-  int size = 0;
-  size_t block_column = 0;
-  for (size_t i = 0; i < mass_matrices.size(); ++i) {
-    // Check if too many mass matrices
-    if (block_column >= jacobian_column_block_size.size()) {
-      throw std::runtime_error(
-          "The dimensions of the mass matrix and Jacobian are incompatible. "
-          "The mass matrix has more scalar columns than the Jacobian.");
-    }
-
-    size += mass_matrices[i].cols();
-    // Check if mass matrix overlaps two jacobian blocks.
-    if (size > jacobian_column_block_size[block_column]) {
-      throw std::runtime_error(
-          "Column partition induced by mass matrix must refine the partition "
-          "induced by the Jacobian.");
-    }
-
-    // Advance to next block if refinement of current block found.
-    if (size == jacobian_column_block_size[block_column]) {
-      ++block_column;
-      size = 0;
-    }
-  }
-
-  // Verify all jacobian blocks are refined.
-  if (block_column < jacobian_column_block_size.size()) {
-    throw std::runtime_error(
-        "The dimensions of the mass matrix and Jacobian are incompatible. The "
-        "Jacobian has more scalar columns than the mass matrix.");
-  }
-}
-
 std::vector<int> GetMassMatrixStartingColumn(
     const std::vector<Eigen::MatrixXd>& mass_matrices) {
   vector<int> y;
@@ -1,5 +1,6 @@
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
+#include <numeric>
 #include <utility>
 
 namespace drake {
@@ -70,6 +71,43 @@ int ContactProblemGraph::AddConstraint(int first_clique, int second_clique,
                        num_constraint_equations);
 }
 
+std::vector<std::vector<int>> ContactProblemGraph::CalcIslands() const {
+  /* Union-find over the cliques, with path halving. */
+  std::vector<int> root(num_cliques());
+  std::iota(root.begin(), root.end(), 0);
+  auto find_root = [&root](int c) {
+    while (root[c] != c) {
+      root[c] = root[root[c]];
+      c = root[c];
+    }
+    return c;
+  };
+  for (const ConstraintCluster& cluster : clusters_) {
+    const int r1 = find_root(cluster.cliques().first());
+    const int r2 = find_root(cluster.cliques().second());
+    /* Keeping the lowest index as the root makes the island order below
+     independent of the order in which clusters were added. */
+    if (r1 < r2) {
+      root[r2] = r1;
+    } else {
+      root[r1] = r2;
+    }
+  }
+
+  std::vector<int> island_index(num_cliques(), -1);
+  std::vector<std::vector<int>> islands;
+  for (int c = 0; c < num_cliques(); ++c) {
+    if (!participating_cliques_.participates(c)) continue;
+    const int r = find_root(c);
+    if (island_index[r] < 0) {
+      island_index[r] = islands.size();
+      islands.emplace_back();
+    }
+    islands[island_index[r]].push_back(c);
+  }
+  return islands;
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
@@ -149,6 +149,15 @@ class ContactProblemGraph {
     return participating_cliques_;
   }
 
+  /* Computes the "islands" of this graph, i.e. its connected components that
+   contain at least one cluster. Cliques in different islands are not coupled
+   by any constraint and therefore the problem can be solved independently for
+   each island. Non-participating cliques (see participating_cliques()) belong
+   to no island.
+   @returns The cliques in each island, sorted in increasing order. Islands are
+   sorted by their first (lowest) clique index. */
+  std::vector<std::vector<int>> CalcIslands() const;
+
  private:
   /* Helper to add a constraint between a pair of cliques. */
   int AddConstraint(SortedPair<int> cliques, int num_constrained_dofs);
@@ -192,6 +192,91 @@ void SapContactProblem<T>::ExpandContactSolverResults(
       reduced_results.vc, &results->vc);
 }
 
+template <typename T>
+std::vector<std::unique_ptr<SapContactProblem<T>>>
+SapContactProblem<T>::MakeIslands(const std::vector<std::vector<int>>& islands,
+                                  std::vector<ReducedMapping>* mappings) const {
+  DRAKE_DEMAND(mappings != nullptr);
+  const int num_islands = islands.size();
+  mappings->clear();
+  mappings->resize(num_islands);
+
+  std::vector<int> clique_to_island(num_cliques(), -1);
+  std::vector<std::unique_ptr<SapContactProblem<T>>> problems;
+  problems.reserve(num_islands);
+  for (int i = 0; i < num_islands; ++i) {
+    ReducedMapping& mapping = (*mappings)[i];
+    mapping.velocity_permutation = PartialPermutation(num_velocities());
+    mapping.clique_permutation = PartialPermutation(num_cliques());
+    mapping.constraint_equation_permutation =
+        PartialPermutation(num_constraint_equations());
+    std::vector<MatrixX<T>> A_island;
+    A_island.reserve(islands[i].size());
+    for (int c : islands[i]) {
+      DRAKE_DEMAND(clique_to_island[c] < 0);
+      clique_to_island[c] = i;
+      mapping.clique_permutation.push(c);
+      for (int k = 0; k < num_velocities(c); ++k) {
+        mapping.velocity_permutation.push(velocities_start(c) + k);
+      }
+      A_island.push_back(A_[c]);
+    }
+    VectorX<T> v_star_island(
+        mapping.velocity_permutation.permuted_domain_size());
+    mapping.velocity_permutation.Apply(v_star_, &v_star_island);
+    problems.push_back(std::make_unique<SapContactProblem<T>>(
+        time_step(), std::move(A_island), std::move(v_star_island)));
+    problems.back()->set_num_objects(num_objects());
+  }
+
+  // Every constraint belongs to the island of its cliques. Since no DoFs are
+  // eliminated, MakeReduced() only maps the constraint's cliques.
+  const std::vector<std::vector<int>> no_known_dofs;
+  for (int k = 0; k < num_constraints(); ++k) {
+    const SapConstraint<T>& c = get_constraint(k);
+    const int i = clique_to_island[c.first_clique()];
+    DRAKE_DEMAND(i >= 0);
+    ReducedMapping& mapping = (*mappings)[i];
+    problems[i]->AddConstraint(
+        c.MakeReduced(mapping.clique_permutation, no_known_dofs));
+    for (int j = 0; j < c.num_constraint_equations(); ++j) {
+      mapping.constraint_equation_permutation.push(
+          constraint_equations_start(k) + j);
+    }
+  }
+
+  return problems;
+}
+
+template <typename T>
+void SapContactProblem<T>::ExpandContactSolverResults(
+    const std::vector<ReducedMapping>& island_mappings,
+    const std::vector<SapSolverResults<T>>& island_results,
+    SapSolverResults<T>* results) const {
+  DRAKE_DEMAND(island_results.size() == island_mappings.size());
+  DRAKE_DEMAND(results != nullptr);
+
+  // Cliques in no island have no constraints and therefore v = v*. Since every
+  // constraint belongs to an island, gamma and vc are entirely overwritten
+  // below.
+  results->Resize(num_velocities(), num_constraint_equations());
+  results->v = v_star();
+  results->gamma.setZero();
+  results->vc.setZero();
+  results->j.setZero();
+
+  for (int i = 0; i < ssize(island_mappings); ++i) {
+    const ReducedMapping& mapping = island_mappings[i];
+    const SapSolverResults<T>& island = island_results[i];
+    mapping.velocity_permutation.ApplyInverse(island.v, &results->v);
+    mapping.velocity_permutation.ApplyInverse(island.j, &results->j);
+    mapping.constraint_equation_permutation.ApplyInverse(island.gamma,
+                                                         &results->gamma);
+    mapping.constraint_equation_permutation.ApplyInverse(island.vc,
+                                                         &results->vc);
+  }
+}
+
 template <typename T>
 int SapContactProblem<T>::AddConstraint(std::unique_ptr<SapConstraint<T>> c) {
   if (c->first_clique() >= num_cliques()) {
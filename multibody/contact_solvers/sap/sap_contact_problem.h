@@ -165,6 +165,39 @@ class SapContactProblem {
                                   const SapSolverResults<T>& reduced_results,
                                   SapSolverResults<T>* results) const;
 
+  /* Splits this problem into one independent problem per island in `islands`,
+   where each island lists the cliques of a connected component of graph(), as
+   computed by ContactProblemGraph::CalcIslands(). The i-th returned problem
+   contains the cliques in islands[i] (in that order) and the constraints among
+   them (in the order they were added to this problem).
+
+    @param[in] islands The islands of this problem's graph.
+    @param[out] mappings On output, mappings[i] stores the mapping between this
+    problem and the problem for the i-th island, in the format documented for
+    MakeReduced().
+
+    @pre islands equals graph().CalcIslands().
+    @pre mappings != nullptr. */
+  std::vector<std::unique_ptr<SapContactProblem<T>>> MakeIslands(
+      const std::vector<std::vector<int>>& islands,
+      std::vector<ReducedMapping>* mappings) const;
+
+  /* Maps solver results for each of the islands of this problem obtained with
+   MakeIslands() into solver results for this problem. Velocities for cliques
+   that belong to no island (cliques with no constraints) are set to v*, with
+   zero generalized impulses.
+
+     @param[in] island_mappings The mappings computed by MakeIslands().
+     @param[in] island_results Solver results for each of the problems computed
+       by MakeIslands().
+     @param[out] results On output stores the combined solver results.
+     @pre island_results.size() == island_mappings.size().
+     @pre results != nullptr. */
+  void ExpandContactSolverResults(
+      const std::vector<ReducedMapping>& island_mappings,
+      const std::vector<SapSolverResults<T>>& island_results,
+      SapSolverResults<T>* results) const;
+
   /* TODO(amcastro-tri): consider constructor API taking std::vector<VectorX<T>>
    for v_star. It could be useful for deformables. */
 
@@ -1,14 +1,18 @@
 #include "drake/multibody/contact_solvers/sap/sap_solver.h"
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <common_robotics_utilities/openmp_helpers.hpp>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/extract_double.h"
 #include "drake/math/linear_solve.h"
+#include "drake/multibody/contact_solvers/block_sparse_supernodal_solver.h"
 #include "drake/multibody/contact_solvers/conex_supernodal_solver.h"
 #include "drake/multibody/contact_solvers/newton_with_bisection.h"
 
@@ -115,6 +119,15 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     return SapSolverStatus::kSuccess;
   }
 
+  if (parameters_.solve_islands_independently) {
+    const std::vector<std::vector<int>> islands =
+        problem.graph().CalcIslands();
+    // With a single island there is nothing to split.
+    if (islands.size() > 1) {
+      return SolveIslandsWithGuess(problem, islands, v_guess, results);
+    }
+  }
+
   // Make model for the given contact problem.
   model_ = std::make_unique<SapModel<double>>(&problem);
   const int nv = model_->num_velocities();
@@ -246,6 +259,66 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   return SapSolverStatus::kSuccess;
 }
 
+template <typename T>
+SapSolverStatus SapSolver<T>::SolveIslandsWithGuess(
+    const SapContactProblem<T>& problem,
+    const std::vector<std::vector<int>>& islands, const VectorX<T>& v_guess,
+    SapSolverResults<T>* results) {
+  std::vector<ReducedMapping> mappings;
+  const std::vector<std::unique_ptr<SapContactProblem<T>>> island_problems =
+      problem.MakeIslands(islands, &mappings);
+  const int num_islands = island_problems.size();
+
+  SapSolverParameters island_parameters = parameters_;
+  island_parameters.solve_islands_independently = false;
+  if (ssize(island_solvers_) < num_islands) {
+    island_solvers_.resize(num_islands);
+  }
+  for (int i = 0; i < num_islands; ++i) {
+    if (island_solvers_[i] == nullptr) {
+      island_solvers_[i] = std::make_unique<SapSolver<T>>();
+    }
+    island_solvers_[i]->set_parameters(island_parameters);
+  }
+  // N.B. ExpandContactSolverResults() needs exactly one result per island.
+  island_results_.resize(num_islands);
+  std::vector<SapSolverStatus> island_status(num_islands);
+  // Exceptions cannot propagate out of an OpenMP parallel region. Therefore we
+  // store them and rethrow the first one (in island order) afterwards.
+  std::vector<std::exception_ptr> island_exception(num_islands);
+  CRU_OMP_PARALLEL_FOR_IF(parameters_.parallelize_islands)
+  for (int i = 0; i < num_islands; ++i) {
+    try {
+      VectorX<T> v_guess_island(island_problems[i]->num_velocities());
+      mappings[i].velocity_permutation.Apply(v_guess, &v_guess_island);
+      SapSolver<T>& sap = *island_solvers_[i];
+      island_status[i] = sap.SolveWithGuess(*island_problems[i], v_guess_island,
+                                            &island_results_[i]);
+    } catch (...) {
+      island_exception[i] = std::current_exception();
+    }
+  }
+  for (const std::exception_ptr& e : island_exception) {
+    if (e != nullptr) std::rethrow_exception(e);
+  }
+
+  stats_ = SolverStats();
+  stats_.optimality_criterion_reached = true;
+  for (int i = 0; i < num_islands; ++i) {
+    const SolverStats& s = island_solvers_[i]->get_statistics();
+    stats_.num_iters = std::max(stats_.num_iters, s.num_iters);
+    stats_.num_line_search_iters += s.num_line_search_iters;
+    stats_.optimality_criterion_reached &= s.optimality_criterion_reached;
+    stats_.cost_criterion_reached |= s.cost_criterion_reached;
+  }
+  for (SapSolverStatus status : island_status) {
+    if (status != SapSolverStatus::kSuccess) return status;
+  }
+
+  problem.ExpandContactSolverResults(mappings, island_results_, results);
+  return SapSolverStatus::kSuccess;
+}
+
 template <typename T>
 T SapSolver<T>::CalcCostAlongLine(
     const systems::Context<T>& context,
@@ -611,6 +684,12 @@ template <typename T>
 std::unique_ptr<SuperNodalSolver> SapSolver<T>::MakeSuperNodalSolver() const {
   if constexpr (std::is_same_v<T, double>) {
     const BlockSparseMatrix<T>& J = model_->constraints_bundle().J();
+    if (parameters_.supernodal_solver_type ==
+        SapSolverParameters::SuperNodalSolverType::kBlockSparseCholesky) {
+      return std::make_unique<BlockSparseSuperNodalSolver>(
+          J.block_rows(), J.get_blocks(), model_->dynamics_matrix(),
+          parameters_.parallelize_factorization);
+    }
     return std::make_unique<ConexSuperNodalSolver>(
         J.block_rows(), J.get_blocks(), model_->dynamics_matrix());
   } else {
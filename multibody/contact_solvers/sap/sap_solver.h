@@ -149,6 +149,38 @@ struct SapSolverParameters {
   // dense algebra instead. Typically used for testing.
   bool use_dense_algebra{false};
 
+  // Supernodal solver used to factor the Hessian when use_dense_algebra =
+  // false.
+  enum SuperNodalSolverType {
+    // Conex's supernodal solver.
+    kConex,
+    // Drake's BlockSparseCholeskySolver, which can factor the dofs of trees
+    // that aren't coupled by constraints concurrently.
+    kBlockSparseCholesky,
+  };
+  SuperNodalSolverType supernodal_solver_type{SuperNodalSolverType::kConex};
+
+  // If true and supernodal_solver_type = kBlockSparseCholesky, the Hessian is
+  // factored in parallel. The factorization is deterministic (independent of
+  // the number of threads) but may differ from the serial one by round-off.
+  // Ignored otherwise.
+  bool parallelize_factorization{false};
+
+  // If true, SapSolver::SolveWithGuess() splits the problem into its islands,
+  // the sets of cliques coupled (directly or indirectly) through constraints,
+  // see ContactProblemGraph::CalcIslands(). Each island is solved as an
+  // independent problem and converges on its own. In particular, an island at
+  // rest for which the initial guess is already optimal takes no Newton
+  // iterations, regardless of what happens in the rest of the problem. This
+  // changes the meaning of some of the solver statistics, see
+  // SapSolver::get_statistics().
+  bool solve_islands_independently{false};
+
+  // If true and solve_islands_independently = true, the islands are solved
+  // concurrently. The results do not depend on the number of threads.
+  // Ignored otherwise.
+  bool parallelize_islands{false};
+
   // Dimensionless number used to allow some slop on the check near zero for
   // certain quantities such as the gradient of the cost.
   // It is also used to check for monotonic convergence. In particular, we allow
@@ -212,7 +244,9 @@ class SapSolver {
       cost.clear();
       alpha.clear();
     }
-    int num_iters{0};              // Number of Newton iterations.
+    // Number of Newton iterations. When islands are solved independently,
+    // this is the largest number taken by any island, see get_statistics().
+    int num_iters{0};
     int num_line_search_iters{0};  // Total number of line search iterations.
 
     // Indicates if the optimality condition was reached.
@@ -221,6 +255,10 @@ class SapSolver {
     // Indicates if the cost condition was reached.
     bool cost_criterion_reached{false};
 
+    // The histories below are not recorded (they are left empty) when
+    // islands are solved independently, since islands don't iterate in
+    // lockstep.
+
     // Cost at each SAP Newton iteration. cost[0] stores cost at the initial
     // guess.
     std::vector<double> cost;
@@ -262,6 +300,14 @@ class SapSolver {
   // Returns solver statistics from the last call to SolveWithGuess().
   // Statistics are reset with SolverStats::Reset() on each new call to
   // SolveWithGuess().
+  //
+  // When the problem was solved one island at a time (see
+  // SapSolverParameters::solve_islands_independently), num_iters is the
+  // largest number of iterations taken by any of the islands,
+  // num_line_search_iters is the total over all islands,
+  // optimality_criterion_reached is true if it was reached by all islands and
+  // cost_criterion_reached is true if it was reached by any of them. The
+  // per-iteration histories are not recorded.
   const SolverStats& get_statistics() const;
 
  private:
@@ -411,6 +457,16 @@ class SapSolver {
                                SuperNodalSolver* supernodal_solver,
                                SearchDirectionData* data) const;
 
+  // Solves each of the `islands` of `problem` (see
+  // ContactProblemGraph::CalcIslands()) independently, with its own SapSolver
+  // from island_solvers_, and combines the results into `results`. Statistics
+  // are aggregated as documented in get_statistics().
+  // @pre islands == problem.graph().CalcIslands().
+  SapSolverStatus SolveIslandsWithGuess(
+      const SapContactProblem<T>& problem,
+      const std::vector<std::vector<int>>& islands, const VectorX<T>& v_guess,
+      SapSolverResults<T>* results);
+
   std::unique_ptr<SapModel<T>> model_;
   SapSolverParameters parameters_;
   // Stats are mutable so we can update them from within const methods (e.g.
@@ -419,6 +475,11 @@ class SapSolver {
   // TODO(amcastro-tri): Consider moving stats into the solver's state stored as
   // part of the model's context.
   mutable SolverStats stats_;
+  // Workspace for SolveIslandsWithGuess(), one entry per island. It is kept
+  // across calls to SolveWithGuess() so that the solvers, and the storage for
+  // their results, are only allocated when the number of islands grows.
+  std::vector<std::unique_ptr<SapSolver<T>>> island_solvers_;
+  std::vector<SapSolverResults<T>> island_results_;
 };
 
 // Forward-declare specializations, prior to DRAKE_DECLARE... below.
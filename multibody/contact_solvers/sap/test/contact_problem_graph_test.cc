@@ -1,5 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 namespace drake {
@@ -129,6 +131,26 @@ TEST_F(ContactGraphTest, ResetGraph) {
   VerifyForExpectedGraph(graph);
 }
 
+TEST_F(ContactGraphTest, CalcIslands) {
+  // Clique 2 doesn't participate, and the rest form a single island.
+  const ContactProblemGraph graph = MakeGraph();
+  EXPECT_EQ(graph.CalcIslands(), std::vector<std::vector<int>>({{0, 1, 3}}));
+
+  // Graph with islands {1, 4, 5} and {2, 3}, a self-constrained clique 6 and
+  // non-participating cliques 0 and 7.
+  ContactProblemGraph islands_graph(8);
+  islands_graph.AddConstraint(5, 4, 3);
+  islands_graph.AddConstraint(3, 2, 3);
+  islands_graph.AddConstraint(6, 1);
+  islands_graph.AddConstraint(1, 5, 3);
+  islands_graph.AddConstraint(4, 3);
+  const std::vector<std::vector<int>> expected_islands = {
+      {1, 4, 5}, {2, 3}, {6}};
+  EXPECT_EQ(islands_graph.CalcIslands(), expected_islands);
+
+  EXPECT_TRUE(ContactProblemGraph(3).CalcIslands().empty());
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -1,6 +1,8 @@
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 
+#include <memory>
 #include <set>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -560,6 +562,79 @@ GTEST_TEST(ContactProblem, ExpandContactSolverResults) {
   EXPECT_TRUE(CompareMatrices(results.vc, vc_expected));
 }
 
+// Unit test MakeIslands() and the ExpandContactSolverResults() overload that
+// combines the results for each island.
+GTEST_TEST(ContactProblem, MakeIslands) {
+  const double time_step = 0.01;
+  const std::vector<MatrixXd> A{S22, S33, S44, S22, S33};
+  const VectorXd v_star = VectorXd::LinSpaced(14, 1.0, 14.0);
+  SapContactProblem<double> problem(time_step, A, v_star);
+  // Clique 1 doesn't participate. The islands are {0, 2}, {3} and {4}.
+  problem.AddConstraint(std::make_unique<TestConstraint>(3, 2, 4, 0, 2));
+  problem.AddConstraint(std::make_unique<TestConstraint>(2, 3, 2));
+  problem.AddConstraint(std::make_unique<TestConstraint>(1, 0, 2, 2, 4));
+  problem.AddConstraint(std::make_unique<TestConstraint>(2, 4, 3));
+  const std::vector<std::vector<int>> islands = problem.graph().CalcIslands();
+  ASSERT_EQ(islands, std::vector<std::vector<int>>({{0, 2}, {3}, {4}}));
+
+  std::vector<ReducedMapping> mappings;
+  const std::vector<std::unique_ptr<SapContactProblem<double>>>
+      island_problems = problem.MakeIslands(islands, &mappings);
+  ASSERT_EQ(island_problems.size(), 3);
+  ASSERT_EQ(mappings.size(), 3);
+
+  const SapContactProblem<double>& island0 = *island_problems[0];
+  EXPECT_EQ(island0.time_step(), time_step);
+  EXPECT_EQ(island0.dynamics_matrix(), std::vector<MatrixXd>({S22, S44}));
+  VectorXd v_star0(6);
+  v_star0 << v_star.segment<2>(0), v_star.segment<4>(5);
+  EXPECT_EQ(island0.v_star(), v_star0);
+  ASSERT_EQ(island0.num_constraints(), 2);
+  EXPECT_EQ(island0.get_constraint(0).first_clique(), 1);
+  EXPECT_EQ(island0.get_constraint(0).second_clique(), 0);
+  EXPECT_EQ(island0.get_constraint(0).num_constraint_equations(), 3);
+  EXPECT_EQ(island0.get_constraint(1).first_clique(), 0);
+  EXPECT_EQ(island0.get_constraint(1).second_clique(), 1);
+  EXPECT_EQ(island0.get_constraint(1).num_constraint_equations(), 1);
+  EXPECT_EQ(mappings[0].constraint_equation_permutation.permutation(),
+            std::vector<int>({0, 1, 2, -1, -1, 3, -1, -1}));
+
+  const SapContactProblem<double>& island2 = *island_problems[2];
+  EXPECT_EQ(island2.dynamics_matrix(), std::vector<MatrixXd>({S33}));
+  EXPECT_EQ(island2.v_star(), v_star.tail<3>());
+  ASSERT_EQ(island2.num_constraints(), 1);
+  EXPECT_EQ(island2.get_constraint(0).first_clique(), 0);
+  EXPECT_EQ(mappings[2].velocity_permutation.permuted_domain_size(), 3);
+
+  // Set up some dummy results, with values offset by 100 times the island
+  // index.
+  std::vector<SapSolverResults<double>> island_results(3);
+  for (int i = 0; i < 3; ++i) {
+    const int nv = island_problems[i]->num_velocities();
+    const int ne = island_problems[i]->num_constraint_equations();
+    island_results[i].Resize(nv, ne);
+    island_results[i].v = VectorXd::Constant(nv, 100 * i + 1);
+    island_results[i].j = VectorXd::Constant(nv, 100 * i + 2);
+    island_results[i].gamma = VectorXd::Constant(ne, 100 * i + 3);
+    island_results[i].vc = VectorXd::Constant(ne, 100 * i + 4);
+  }
+  SapSolverResults<double> results;
+  problem.ExpandContactSolverResults(mappings, island_results, &results);
+
+  // Velocities for clique 1 (in no island) equal v*.
+  VectorXd v_expected(14);
+  v_expected << 1, 1, v_star.segment<3>(2), 1, 1, 1, 1, 101, 101, 201, 201,
+      201;
+  VectorXd j_expected(14);
+  j_expected << 2, 2, 0, 0, 0, 2, 2, 2, 2, 102, 102, 202, 202, 202;
+  VectorXd gamma_expected(8);
+  gamma_expected << 3, 3, 3, 103, 103, 3, 203, 203;
+  EXPECT_EQ(results.v, v_expected);
+  EXPECT_EQ(results.j, j_expected);
+  EXPECT_EQ(results.gamma, gamma_expected);
+  EXPECT_EQ(results.vc, (gamma_expected.array() + 1).matrix());
+}
+
 GTEST_TEST(ContactProblem, CalcConstraintMultibodyForces) {
   const double time_step = 0.01;
   const std::vector<MatrixXd> A{S22, S33, S44, S22};
@@ -905,6 +905,17 @@ class SapNewtonIterationTest
     // close to machine epsilon for this small problem.
     EXPECT_TRUE(CompareMatrices(v_supernodal, v_dense, 5.0 * relative_tolerance,
                                 MatrixCompareType::relative));
+
+    // Perform computation with the block sparse supernodal solver.
+    SapSolverParameters params_block_sparse = params_supernodal;
+    params_block_sparse.supernodal_solver_type =
+        SapSolverParameters::SuperNodalSolverType::kBlockSparseCholesky;
+    params_block_sparse.parallelize_factorization = true;
+    const VectorXd v_block_sparse =
+        SolveWithGuess(params_block_sparse, v_guess);
+    EXPECT_TRUE(CompareMatrices(v_block_sparse, v_dense,
+                                5.0 * relative_tolerance,
+                                MatrixCompareType::relative));
   }
 
  protected:
@@ -1062,6 +1073,63 @@ TEST_P(SapNewtonIterationTest, GuessOutsideLimits) {
   CompareDenseAgainstSupernodal(v_guess);
 }
 
+// Adds a second, independent, limit constraint on clique 0 so that the problem
+// has two islands, and verifies that solving them independently (and
+// concurrently) gives the same solution as solving the full problem.
+TEST_P(SapNewtonIterationTest, SolveIslandsIndependently) {
+  std::unique_ptr<SapContactProblem<double>> problem = sap_problem_->Clone();
+  const Vector2d vl0(-10.0, -10.0);
+  const Vector2d vu0(10.0, 10.0);
+  problem->AddConstraint(std::make_unique<LimitConstraint<double>>(
+      0, vl0, vu0, VectorXd::Constant(4, 1.0e-3)));
+  ASSERT_EQ(problem->graph().CalcIslands().size(), 2);
+
+  // The guess for clique 0 is within its limits and is therefore the solution
+  // for its island. The guess for clique 1 is outside its limits.
+  VectorXd v_guess = v_star_;
+  v_guess.segment<3>(2) = Vector3d(1.2 * vl_(0), v_star_(1), 1.1 * vu_(2));
+
+  SapSolverParameters params;
+  params.line_search_type = GetParam();
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+  SapSolverResults<double> expected_result;
+  ASSERT_EQ(sap.SolveWithGuess(*problem, v_guess, &expected_result),
+            SapSolverStatus::kSuccess);
+  const int expected_num_iters = sap.get_statistics().num_iters;
+
+  params.solve_islands_independently = true;
+  params.parallelize_islands = true;
+  sap.set_parameters(params);
+  SapSolverResults<double> result;
+  ASSERT_EQ(sap.SolveWithGuess(*problem, v_guess, &result),
+            SapSolverStatus::kSuccess);
+  const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+  EXPECT_TRUE(stats.optimality_criterion_reached);
+  // The island for clique 1 dominates the number of iterations.
+  EXPECT_EQ(stats.num_iters, expected_num_iters);
+
+  EXPECT_TRUE(CompareMatrices(result.v, expected_result.v, 3.0 * kEps,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(result.j, expected_result.j, 3.0 * kEps,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(result.gamma, expected_result.gamma, 3.0 * kEps,
+                              MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(result.vc, expected_result.vc, 3.0 * kEps,
+                              MatrixCompareType::relative));
+  // Per-iteration histories are not recorded for islands.
+  EXPECT_TRUE(stats.cost.empty());
+  EXPECT_TRUE(stats.momentum_residual.empty());
+
+  // A second solve reuses the per-island solvers, with the same outcome.
+  SapSolverResults<double> second_result;
+  ASSERT_EQ(sap.SolveWithGuess(*problem, v_guess, &second_result),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(sap.get_statistics().num_iters, expected_num_iters);
+  EXPECT_EQ(second_result.v, result.v);
+  EXPECT_EQ(second_result.gamma, result.gamma);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TestLineSearchMethods, SapNewtonIterationTest,
     testing::Values(SapSolverParameters::LineSearchType::kBackTracking,
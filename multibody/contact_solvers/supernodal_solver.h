@@ -139,6 +139,16 @@ std::vector<std::vector<int>> GetRowToTripletMapping(
 std::vector<int> GetJacobianBlockSizesVerifyTriplets(
     const std::vector<BlockMatrixTriplet>& jacobian_blocks);
 
+// Verifies that the block columns of the block diagonal mass matrix (whose
+// diagonal blocks are `mass_matrices`) refine the block columns of the
+// Jacobian (whose sizes are `jacobian_column_block_size`, see
+// GetJacobianBlockSizesVerifyTriplets()). That is, each block column of the
+// Jacobian spans a whole number of consecutive mass matrix blocks. If not,
+// throws an exception.
+void VerifyMassMatrixPartitionRefinesJacobianPartition(
+    const std::vector<int>& jacobian_column_block_size,
+    const std::vector<Eigen::MatrixXd>& mass_matrices);
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
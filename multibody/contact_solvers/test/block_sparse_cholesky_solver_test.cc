@@ -1,7 +1,9 @@
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 
+#include <cmath>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -125,6 +127,86 @@ GTEST_TEST(BlockSparseCholeskySolverTest, Solve) {
   EXPECT_TRUE(CompareMatrices(x4, expected_x4, 1e-13));
 }
 
+/* Makes an SPD matrix with the sparsity pattern of `num_chains` chains of
+ `chain_length` 3x3 blocks, each coupled to the next along the chain, where the
+ last block of every chain is coupled to one extra, shared, block. This is the
+ pattern of the Hessian for many robots resting on a shared free body, and its
+ elimination tree has many independent subtrees. */
+BlockSparseSymmetricMatrix MakeChainsSpdMatrix(int num_chains,
+                                               int chain_length) {
+  const int num_blocks = num_chains * chain_length + 1;
+  const int shared = num_blocks - 1;
+  std::vector<std::vector<int>> sparsity(num_blocks);
+  for (int b = 0; b < num_blocks; ++b) {
+    sparsity[b].push_back(b);
+  }
+  std::vector<std::pair<int, int>> off_diagonal_blocks;
+  for (int c = 0; c < num_chains; ++c) {
+    for (int i = 0; i < chain_length; ++i) {
+      const int b = c * chain_length + i;
+      const int next = (i + 1 < chain_length) ? b + 1 : shared;
+      sparsity[b].push_back(next);
+      off_diagonal_blocks.emplace_back(next, b);
+    }
+  }
+  BlockSparseSymmetricMatrix A(BlockSparsityPattern(
+      std::vector<int>(num_blocks, 3), std::move(sparsity)));
+  /* Each off-diagonal entry has magnitude at most 0.1, and each block row has
+   at most num_chains + 1 nonzero blocks, so this diagonal keeps A strictly
+   diagonally dominant and hence SPD. */
+  for (int b = 0; b < num_blocks; ++b) {
+    A.AddToBlock(b, b,
+                 (num_chains + 1.0) * Eigen::Matrix3d::Identity() +
+                     0.01 * (b % 5) * Eigen::Matrix3d::Ones());
+  }
+  for (const auto& [a, b] : off_diagonal_blocks) {
+    Eigen::Matrix3d block;
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        block(i, j) = 0.1 * std::sin(a + 2 * b + 3 * i + 5 * j);
+      }
+    }
+    A.AddToBlock(a, b, block);
+  }
+  return A;
+}
+
+GTEST_TEST(BlockSparseCholeskySolverTest, ParallelFactor) {
+  const BlockSparseSymmetricMatrix A = MakeChainsSpdMatrix(80, 3);
+  const MatrixXd dense_A = A.MakeDenseMatrix();
+  const VectorXd b = VectorXd::LinSpaced(A.cols(), -1.0, 1.0);
+  const VectorXd expected_x = dense_A.llt().solve(b);
+
+  BlockSparseCholeskySolver<MatrixXd> serial_solver;
+  serial_solver.SetMatrix(A);
+  ASSERT_TRUE(serial_solver.Factor());
+  const VectorXd serial_x = serial_solver.Solve(b);
+  EXPECT_TRUE(CompareMatrices(serial_x, expected_x, 1e-13));
+
+  BlockSparseCholeskySolver<MatrixXd> parallel_solver;
+  parallel_solver.SetMatrix(A);
+  ASSERT_TRUE(parallel_solver.Factor(true));
+  EXPECT_EQ(parallel_solver.solver_mode(),
+            BlockSparseCholeskySolver<MatrixXd>::SolverMode::kFactored);
+  const VectorXd parallel_x = parallel_solver.Solve(b);
+  EXPECT_TRUE(CompareMatrices(parallel_x, expected_x, 1e-13));
+  EXPECT_TRUE(CompareMatrices(parallel_solver.L().MakeDenseMatrix(),
+                              serial_solver.L().MakeDenseMatrix(), 1e-13));
+
+  /* Refactoring the same matrix in parallel gives bitwise identical results. */
+  parallel_solver.UpdateMatrix(A);
+  ASSERT_TRUE(parallel_solver.Factor(true));
+  EXPECT_EQ(parallel_solver.Solve(b), parallel_x);
+
+  /* A failure in any of the subtrees is reported. */
+  BlockSparseSymmetricMatrix B = A;
+  B.AddToBlock(5, 5, -1000.0 * Eigen::Matrix3d::Identity());
+  parallel_solver.UpdateMatrix(B);
+  EXPECT_FALSE(parallel_solver.Factor(true));
+  EXPECT_EQ(parallel_solver.solver_mode(),
+            BlockSparseCholeskySolver<MatrixXd>::SolverMode::kEmpty);
+}
+
 GTEST_TEST(BlockSparseCholeskySolverTest, SolveFailureDueToNonSpdness) {
   std::vector<std::vector<int>> sparsity;
   sparsity.emplace_back(std::vector<int>{0});
@@ -4,6 +4,7 @@
 
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/unused.h"
+#include "drake/multibody/contact_solvers/block_sparse_supernodal_solver.h"
 #include "drake/multibody/contact_solvers/conex_supernodal_solver.h"
 
 using Eigen::MatrixXd;
@@ -114,7 +115,8 @@ std::vector<BlockMatrixTriplet> MakeBlockTriplets(
 
 template <typename ConcreteSolver>
 class SuperNodalSolverTest : public ::testing::Test {};
-using Implementations = ::testing::Types<ConexSuperNodalSolver>;
+using Implementations =
+    ::testing::Types<ConexSuperNodalSolver, BlockSparseSuperNodalSolver>;
 TYPED_TEST_SUITE(SuperNodalSolverTest, Implementations);
 
 // In this test the partition of the columns of J doesn't refine the partition
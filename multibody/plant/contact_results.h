@@ -21,9 +21,9 @@ template <typename T> class MultibodyPlant;
 
 /**
  A container class storing the contact results information for each contact
- pair for a given state of the simulation. Note that copying this data structure
- is expensive when `num_hydroelastic_contacts() > 0` because a deep copy is
- performed.
+ pair for a given state of the simulation. Copying this data structure copies
+ each HydroelasticContactInfo, but not the meshes and fields of their contact
+ surfaces; those are shared with the original (see geometry::ContactSurface).
 
  @tparam_default_scalar
  */
@@ -65,7 +65,8 @@ class ContactResults {
    @param selector Boolean predicate that returns true to select which
                    HydroelasticContactInfo.
 
-   @note It uses deep copy. */
+   @note It copies the selected HydroelasticContactInfo instances, which share
+         their contact surfaces' data with this. */
   ContactResults<T> SelectHydroelastic(
       std::function<bool(const HydroelasticContactInfo<T>&)> selector) const;
 
@@ -99,10 +99,12 @@ class HydroelasticContactInfo {
   /// MoveAssignable.
   //@{
 
-  /** Clones this data structure, making deep copies of all underlying data.
+  /** Clones this data structure.
    @note The new object will contain a cloned ContactSurface even if the
          original was constructed using a raw pointer referencing an existing
-         ContactSurface.
+         ContactSurface. The clone shares the original surface's mesh and field
+         rather than copying them (see geometry::ContactSurface), so it is
+         cheap and remains valid after the original surface is destroyed.
    */
   HydroelasticContactInfo(const HydroelasticContactInfo& info) {
     *this = info;
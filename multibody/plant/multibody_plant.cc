@@ -336,6 +336,8 @@ MultibodyPlant<T>::MultibodyPlant(const MultibodyPlant<U>& other)
     contact_model_ = other.contact_model_;
     contact_solver_enum_ = other.contact_solver_enum_;
     sap_near_rigid_threshold_ = other.sap_near_rigid_threshold_;
+    sleeping_velocity_threshold_ = other.sleeping_velocity_threshold_;
+    sleeping_num_steps_ = other.sleeping_num_steps_;
     contact_surface_representation_ = other.contact_surface_representation_;
     // geometry_query_port_ is set during DeclareSceneGraphPorts() below.
     // geometry_pose_port_ is set during DeclareSceneGraphPorts() below.
@@ -617,6 +619,52 @@ double MultibodyPlant<T>::get_sap_near_rigid_threshold() const {
   return sap_near_rigid_threshold_;
 }
 
+template <typename T>
+void MultibodyPlant<T>::set_sleeping_parameters(double velocity_threshold,
+                                                int num_steps) {
+  DRAKE_MBP_THROW_IF_FINALIZED();
+  DRAKE_THROW_UNLESS(is_discrete());
+  DRAKE_THROW_UNLESS(velocity_threshold >= 0.0);
+  DRAKE_THROW_UNLESS(num_steps > 0);
+  sleeping_velocity_threshold_ = velocity_threshold;
+  sleeping_num_steps_ = num_steps;
+}
+
+template <typename T>
+bool MultibodyPlant<T>::IsSleeping(const systems::Context<T>& context,
+                                   const Body<T>& body) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(is_sleeping_enabled());
+  this->ValidateContext(context);
+  const internal::TreeIndex tree_index =
+      internal_tree().get_topology().body_to_tree_index(body.index());
+  return tree_index.is_valid() && IsTreeSleeping(context, tree_index);
+}
+
+template <typename T>
+void MultibodyPlant<T>::WakeUp(systems::Context<T>* context,
+                               const Body<T>& body) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(is_sleeping_enabled());
+  DRAKE_THROW_UNLESS(context != nullptr);
+  this->ValidateContext(context);
+  const internal::TreeIndex tree_index =
+      internal_tree().get_topology().body_to_tree_index(body.index());
+  if (tree_index.is_valid()) {
+    context->get_mutable_discrete_state(sleep_counters_index_)
+        .SetAtIndex(tree_index, 0.0);
+  }
+}
+
+template <typename T>
+bool MultibodyPlant<T>::IsTreeSleeping(const systems::Context<T>& context,
+                                       internal::TreeIndex tree_index) const {
+  DRAKE_ASSERT(is_sleeping_enabled());
+  const T& counter =
+      context.get_discrete_state(sleep_counters_index_).value()[tree_index];
+  return ExtractDoubleOrThrow(counter) >= sleeping_num_steps_;
+}
+
 template <typename T>
 ContactModel MultibodyPlant<T>::get_contact_model() const {
   return contact_model_;
@@ -2328,11 +2376,22 @@ void MultibodyPlant<T>::CalcJointLockingCache(
   unlocked_per_tree.resize(topology.num_trees());
   locked_per_tree.resize(topology.num_trees());
 
+  // The dofs of sleeping trees are treated as locked.
+  std::vector<bool> is_sleeping(topology.num_trees(), false);
+  if (is_sleeping_enabled()) {
+    for (internal::TreeIndex t(0); t < topology.num_trees(); ++t) {
+      is_sleeping[t] = IsTreeSleeping(context, t);
+    }
+  }
+
   int unlocked_cursor = 0;
   int locked_cursor = 0;
   for (JointIndex joint_index(0); joint_index < num_joints(); ++joint_index) {
     const Joint<T>& joint = get_joint(joint_index);
-    if (joint.is_locked(context)) {
+    const bool is_tree_sleeping =
+        joint.num_velocities() > 0 &&
+        is_sleeping[topology.velocity_to_tree_index(joint.velocity_start())];
+    if (joint.is_locked(context) || is_tree_sleeping) {
       for (int k = 0; k < joint.num_velocities(); ++k) {
         locked[locked_cursor++] = joint.velocity_start() + k;
       }
@@ -2548,6 +2607,9 @@ systems::EventStatus MultibodyPlant<T>::CalcDiscreteStep(
   // MultibodyPlant manager.
   if (discrete_update_manager_) {
     discrete_update_manager_->CalcDiscreteValues(context0, updates);
+    if (is_sleeping_enabled()) {
+      CalcSleepCountersUpdate(context0, updates);
+    }
     return systems::EventStatus::Succeeded();
   }
 
@@ -2577,6 +2639,106 @@ systems::EventStatus MultibodyPlant<T>::CalcDiscreteStep(
   return systems::EventStatus::Succeeded();
 }
 
+template <typename T>
+void MultibodyPlant<T>::CalcSleepCountersUpdate(
+    const systems::Context<T>& context0,
+    systems::DiscreteValues<T>* updates) const {
+  DRAKE_DEMAND(is_sleeping_enabled());
+  const internal::MultibodyTreeTopology& topology =
+      internal_tree().get_topology();
+  const int num_trees = topology.num_trees();
+  const int nv = num_velocities();
+  const systems::DiscreteStateIndex state_index =
+      this->GetDiscreteStateIndexOrThrow();
+  const auto v0 = context0.get_discrete_state(state_index).value().tail(nv);
+  auto v_next = updates->get_mutable_value(state_index).tail(nv);
+
+  // A tree is moving if any of its velocities exceeds the threshold, either
+  // at the start or at the end of the step. Considering v0 allows a moving
+  // tree that comes to a sudden stop against a sleeping tree to wake it up.
+  std::vector<bool> is_moving(num_trees, false);
+  for (internal::TreeIndex t(0); t < num_trees; ++t) {
+    const int start = topology.tree_velocities_start(t);
+    const int end = start + topology.num_tree_velocities(t);
+    for (int i = start; i < end && !is_moving[t]; ++i) {
+      is_moving[t] =
+          std::abs(ExtractDoubleOrThrow(v0[i])) >
+              sleeping_velocity_threshold_ ||
+          std::abs(ExtractDoubleOrThrow(v_next[i])) >
+              sleeping_velocity_threshold_;
+    }
+  }
+
+  std::vector<bool> wake_up(num_trees, false);
+
+  // Wake up trees with non-zero forces applied through input ports.
+  MultibodyForces<T> forces(*this);
+  AddInForcesFromInputPorts(context0, &forces);
+  const VectorX<T>& tau = forces.generalized_forces();
+  for (int i = 0; i < nv; ++i) {
+    if (ExtractDoubleOrThrow(tau[i]) != 0.0) {
+      wake_up[topology.velocity_to_tree_index(i)] = true;
+    }
+  }
+  for (BodyIndex body_index(1); body_index < num_bodies(); ++body_index) {
+    const internal::TreeIndex t = topology.body_to_tree_index(body_index);
+    if (!t.is_valid()) continue;
+    const SpatialForce<T>& F_Bo_W =
+        get_body(body_index).GetForceInWorld(context0, forces);
+    for (int k = 0; k < 6; ++k) {
+      if (ExtractDoubleOrThrow(F_Bo_W.get_coeffs()[k]) != 0.0) {
+        wake_up[t] = true;
+        break;
+      }
+    }
+  }
+
+  // Wake up trees in contact with a moving tree.
+  const auto wake_up_if_touched = [&](geometry::GeometryId id_A,
+                                      geometry::GeometryId id_B) {
+    const internal::TreeIndex tree_A =
+        topology.body_to_tree_index(geometry_id_to_body_index_.at(id_A));
+    const internal::TreeIndex tree_B =
+        topology.body_to_tree_index(geometry_id_to_body_index_.at(id_B));
+    if (!tree_A.is_valid() || !tree_B.is_valid()) return;
+    if (is_moving[tree_B]) wake_up[tree_A] = true;
+    if (is_moving[tree_A]) wake_up[tree_B] = true;
+  };
+  if (num_collision_geometries() > 0) {
+    if (contact_model_ == ContactModel::kPoint ||
+        contact_model_ == ContactModel::kHydroelasticWithFallback) {
+      for (const auto& pair : EvalPointPairPenetrations(context0)) {
+        wake_up_if_touched(pair.id_A, pair.id_B);
+      }
+    }
+    if (contact_model_ == ContactModel::kHydroelastic ||
+        contact_model_ == ContactModel::kHydroelasticWithFallback) {
+      for (const auto& surface : EvalContactSurfaces(context0)) {
+        wake_up_if_touched(surface.id_M(), surface.id_N());
+      }
+    }
+  }
+
+  const VectorX<T>& counters0 =
+      context0.get_discrete_state(sleep_counters_index_).value();
+  VectorX<T> counters(num_trees);
+  for (internal::TreeIndex t(0); t < num_trees; ++t) {
+    const int counter0 = ExtractDoubleOrThrow(counters0[t]);
+    const int counter = (is_moving[t] || wake_up[t])
+                            ? 0
+                            : std::min(counter0 + 1, sleeping_num_steps_);
+    // Trees falling asleep in this step are frozen.
+    if (counter == sleeping_num_steps_ && counter0 < sleeping_num_steps_) {
+      v_next
+          .segment(topology.tree_velocities_start(t),
+                   topology.num_tree_velocities(t))
+          .setZero();
+    }
+    counters[t] = counter;
+  }
+  updates->set_value(sleep_counters_index_, counters);
+}
+
 template<typename T>
 void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
   // The model must be finalized.
@@ -2591,6 +2753,12 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
         &MultibodyPlant<T>::CalcDiscreteStep);
   }
 
+  if (is_sleeping_enabled()) {
+    // All trees start awake.
+    sleep_counters_index_ = this->DeclareDiscreteState(
+        VectorX<T>::Zero(internal_tree().get_topology().num_trees()));
+  }
+
   DeclareCacheEntries();
 
   // Declare per model instance actuation ports.
@@ -2896,12 +3064,19 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
       generalized_contact_forces_continuous_cache_entry.cache_index();
 
   // Cache joint locking data. A joint's locked/unlocked state is stored as an
-  // abstract parameter, so this is the only dependency needed.
+  // abstract parameter. When sleeping is enabled, the dofs of sleeping trees
+  // are locked as well, and thus the sleep counters are also a dependency.
+  std::set<systems::DependencyTicket> joint_locking_prerequisites{
+      this->all_parameters_ticket()};
+  if (is_sleeping_enabled()) {
+    joint_locking_prerequisites.insert(
+        this->discrete_state_ticket(sleep_counters_index_));
+  }
   const auto& joint_locking_data_cache_entry = this->DeclareCacheEntry(
       "Joint locking indices.",
       internal::JointLockingCacheData<T>{},
       &MultibodyPlant::CalcJointLockingCache,
-      {this->all_parameters_ticket()});
+      std::move(joint_locking_prerequisites));
   cache_indexes_.joint_locking_data =
       joint_locking_data_cache_entry.cache_index();
 }
@@ -1833,6 +1833,53 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   /// @see See set_sap_near_rigid_threshold().
   double get_sap_near_rigid_threshold() const;
 
+  /// Enables sleeping, an opt-in optimization for discrete models with many
+  /// bodies at rest (e.g. hundreds of boxes stacked in a warehouse). A tree of
+  /// bodies (a body connected to the world by a joint, together with all of
+  /// the bodies outboard of it) whose generalized velocities all stay below
+  /// `velocity_threshold` in magnitude for `num_steps` consecutive discrete
+  /// updates falls asleep. While asleep, the velocities of the tree are held
+  /// at zero (and therefore its positions are frozen), and its degrees of
+  /// freedom are eliminated from the contact problem exactly as if all of its
+  /// joints were locked, see Joint::Lock(). In particular, contact between a
+  /// sleeping tree and the world or another sleeping tree is not resolved by
+  /// the contact solver, nor reported in ContactResults.
+  ///
+  /// A sleeping tree is woken up when it is in contact with a tree whose
+  /// velocities exceed `velocity_threshold`, when a non-zero force is applied
+  /// to it through the actuation or the applied force input ports, or
+  /// explicitly with WakeUp(). The sleep state of each tree is stored in the
+  /// context, see IsSleeping().
+  ///
+  /// @note Kinematics and geometry poses are still evaluated for sleeping
+  /// bodies; since their positions don't change, it is the contact solve that
+  /// sleeping saves.
+  ///
+  /// @throws std::exception if `this` plant is not discrete.
+  /// @throws std::exception if velocity_threshold is negative or num_steps is
+  /// not positive.
+  /// @throws std::exception if called post-finalize.
+  void set_sleeping_parameters(double velocity_threshold, int num_steps);
+
+  /// Returns `true` iff sleeping was enabled with set_sleeping_parameters().
+  bool is_sleeping_enabled() const { return sleeping_num_steps_ > 0; }
+
+  /// Returns `true` iff the tree `body` belongs to is asleep in `context`.
+  /// Bodies anchored to the world are never asleep.
+  /// @see set_sleeping_parameters().
+  /// @throws std::exception if sleeping is not enabled.
+  /// @throws std::exception if called pre-finalize.
+  bool IsSleeping(const systems::Context<T>& context,
+                  const Body<T>& body) const;
+
+  /// Wakes up the tree `body` belongs to, if asleep, and resets the count of
+  /// steps it has been at rest. This is a no-op for bodies anchored to the
+  /// world.
+  /// @see set_sleeping_parameters().
+  /// @throws std::exception if sleeping is not enabled.
+  /// @throws std::exception if called pre-finalize.
+  void WakeUp(systems::Context<T>* context, const Body<T>& body) const;
+
   /// Return the default value for contact representation, given the desired
   /// time step. Discrete systems default to use polygons; continuous systems
   /// default to use triangles.
@@ -4907,6 +4954,19 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
       const systems::Context<T>& context0,
       systems::DiscreteValues<T>* updates) const;
 
+  // Returns true iff the tree with index `tree_index` is asleep in `context`.
+  // @pre Sleeping is enabled.
+  bool IsTreeSleeping(const systems::Context<T>& context,
+                      internal::TreeIndex tree_index) const;
+
+  // Given the multibody state already written to `updates` by
+  // CalcDiscreteStep(), updates the per-tree sleep counters (see
+  // set_sleeping_parameters()). The velocities of trees that fall asleep in
+  // this step are zeroed.
+  // @pre Sleeping is enabled.
+  void CalcSleepCountersUpdate(const systems::Context<T>& context0,
+                               systems::DiscreteValues<T>* updates) const;
+
   // Data will be resized on output according to the documentation for
   // JointLockingCacheData.
   void CalcJointLockingCache(const systems::Context<T>& context,
@@ -5320,6 +5380,16 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   double sap_near_rigid_threshold_{
       MultibodyPlantConfig{}.sap_near_rigid_threshold};
 
+  // Sleeping parameters, see set_sleeping_parameters(). Sleeping is disabled
+  // when sleeping_num_steps_ is zero.
+  double sleeping_velocity_threshold_{0.0};
+  int sleeping_num_steps_{0};
+
+  // When sleeping is enabled, the discrete state storing, for each tree, the
+  // number of consecutive steps the tree has been at rest (saturated at
+  // sleeping_num_steps_, when the tree is asleep).
+  systems::DiscreteStateIndex sleep_counters_index_;
+
   // User's choice of the representation of contact surfaces in discrete
   // systems. The default value is dependent on whether the system is
   // continuous or discrete, so the constructor will set it. See
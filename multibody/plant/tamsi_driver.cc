@@ -9,6 +9,7 @@
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/slicing_and_indexing.h"
 #include "drake/multibody/plant/tamsi_solver.h"
+#include "drake/multibody/tree/ltdl_factorization.h"
 
 using drake::multibody::contact_solvers::internal::ContactSolverResults;
 
@@ -60,8 +61,10 @@ void TamsiDriver<T>::CalcContactSolverResults(
   // Assert this method was called on a context storing discrete state.
   plant().ValidateContext(context);
   DRAKE_ASSERT(context.num_continuous_states() == 0);
-  // Only discrete state updates for rigid bodies is supported.
-  DRAKE_ASSERT(context.num_discrete_state_groups() == 1);
+  // Only discrete state updates for rigid bodies (and their sleep counters)
+  // is supported.
+  DRAKE_ASSERT(context.num_discrete_state_groups() ==
+               (plant().is_sleeping_enabled() ? 2 : 1));
 
   // Compute non-contact forces at the previous time step. This also checks
   // whether an algebra loop exists but isn't detected when building the diagram
@@ -158,6 +161,23 @@ void TamsiDriver<T>::CalcContactSolverResults(
 
   VectorX<T> v0_unlocked = SelectRows(v0, indices);
 
+  // Without contact the update reduces to solving M⋅v = M⋅v₀ - dt⋅(-τ), which
+  // we solve exploiting the tree sparsity of M rather than with the dense
+  // factorization within TamsiSolver. We fall back to TamsiSolver if the
+  // factorization fails.
+  if (num_contacts == 0) {
+    LtdlFactorization<T> M0_ltdl(tree_topology(), indices);
+    if (M0_ltdl.Factor(M0_unlocked)) {
+      VectorX<T> v_next_unlocked = M0_ltdl.Multiply(v0_unlocked) -
+                                   plant().time_step() * minus_tau_unlocked;
+      M0_ltdl.SolveInPlace(&v_next_unlocked);
+      results->Resize(nv, num_contacts);
+      results->v_next = ExpandRows(v_next_unlocked, nv, indices);
+      results->tau_contact.setZero();
+      return;
+    }
+  }
+
   contact_solvers::internal::ContactSolverResults<T> results_unlocked;
   results_unlocked.Resize(indices.size(), num_contacts);
 
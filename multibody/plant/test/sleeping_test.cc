@@ -0,0 +1,318 @@
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/spatial_inertia.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+
+class MultibodyPlantTester {
+ public:
+  MultibodyPlantTester() = delete;
+
+  static const internal::JointLockingCacheData<double>& EvalJointLockingCache(
+      const MultibodyPlant<double>& plant,
+      const systems::Context<double>& context) {
+    return plant.EvalJointLockingCache(context);
+  }
+};
+
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using systems::Context;
+
+const double kTimeStep = 0.01;
+const double kVelocityThreshold = 1.0e-3;
+const int kNumSleepingSteps = 3;
+
+// Fixture for a plant with two free bodies, each in its own tree, in zero
+// gravity. Body "resting" starts with a velocity below the sleeping threshold
+// while body "moving" starts with a velocity well above it.
+class SleepingTest : public ::testing::TestWithParam<DiscreteContactSolver> {
+ public:
+  void SetUp() override {
+    plant_ = std::make_unique<MultibodyPlant<double>>(kTimeStep);
+    plant_->set_discrete_contact_solver(GetParam());
+    plant_->mutable_gravity_field().set_gravity_vector(Vector3<double>::Zero());
+    resting_ =
+        &plant_->AddRigidBody("resting", SpatialInertia<double>::MakeUnitary());
+    moving_ =
+        &plant_->AddRigidBody("moving", SpatialInertia<double>::MakeUnitary());
+    plant_->set_sleeping_parameters(kVelocityThreshold, kNumSleepingSteps);
+    plant_->Finalize();
+    context_ = plant_->CreateDefaultContext();
+
+    plant_->SetFreeBodySpatialVelocity(
+        context_.get(), *resting_,
+        SpatialVelocity<double>(Vector3<double>::Zero(),
+                                Vector3<double>(1.0e-4, 0.0, 0.0)));
+    plant_->SetFreeBodySpatialVelocity(
+        context_.get(), *moving_,
+        SpatialVelocity<double>(Vector3<double>::Zero(),
+                                Vector3<double>(1.0, 0.0, 0.0)));
+  }
+
+ protected:
+  // Advances the state in `context_` by one discrete update.
+  void Step() {
+    const systems::DiscreteValues<double>& next =
+        plant_->EvalUniquePeriodicDiscreteUpdate(*context_);
+    context_->SetDiscreteState(next);
+  }
+
+  VectorXd GetBodyPositions(const RigidBody<double>& body) const {
+    return plant_->GetPositions(*context_).segment(
+        body.floating_positions_start(), 7);
+  }
+
+  VectorXd GetBodyVelocities(const RigidBody<double>& body) const {
+    return plant_->GetVelocities(*context_).segment(
+        body.floating_velocities_start() - plant_->num_positions(), 6);
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  const RigidBody<double>* resting_{nullptr};
+  const RigidBody<double>* moving_{nullptr};
+  std::unique_ptr<Context<double>> context_;
+};
+
+// Verifies that a tree at rest falls asleep after the prescribed number of
+// steps, that it remains frozen while asleep, and that applied forces wake it
+// up.
+TEST_P(SleepingTest, FallAsleepAndWakeUp) {
+  EXPECT_FALSE(plant_->IsSleeping(*context_, plant_->world_body()));
+  for (int i = 0; i < kNumSleepingSteps; ++i) {
+    EXPECT_FALSE(plant_->IsSleeping(*context_, *resting_));
+    Step();
+  }
+  EXPECT_TRUE(plant_->IsSleeping(*context_, *resting_));
+  EXPECT_FALSE(plant_->IsSleeping(*context_, *moving_));
+  // Trees that fall asleep are frozen.
+  EXPECT_EQ(GetBodyVelocities(*resting_), VectorXd::Zero(6));
+
+  const VectorXd resting_q = GetBodyPositions(*resting_);
+  const VectorXd moving_q = GetBodyPositions(*moving_);
+  Step();
+  EXPECT_TRUE(plant_->IsSleeping(*context_, *resting_));
+  EXPECT_EQ(GetBodyPositions(*resting_), resting_q);
+  EXPECT_NE(GetBodyPositions(*moving_), moving_q);
+
+  // Applying a force wakes the sleeping tree up.
+  VectorXd tau = VectorXd::Zero(plant_->num_velocities());
+  tau(resting_->floating_velocities_start() - plant_->num_positions() + 3) =
+      1.0;
+  plant_->get_applied_generalized_force_input_port().FixValue(context_.get(),
+                                                              tau);
+  Step();
+  EXPECT_FALSE(plant_->IsSleeping(*context_, *resting_));
+  Step();
+  EXPECT_GT(GetBodyVelocities(*resting_)(3), kVelocityThreshold);
+}
+
+// Verifies that WakeUp() resets the sleep state stored in the context.
+TEST_P(SleepingTest, WakeUp) {
+  for (int i = 0; i < kNumSleepingSteps; ++i) {
+    Step();
+  }
+  ASSERT_TRUE(plant_->IsSleeping(*context_, *resting_));
+  plant_->WakeUp(context_.get(), *resting_);
+  EXPECT_FALSE(plant_->IsSleeping(*context_, *resting_));
+  // Anchored bodies are never asleep, and waking them up is a no-op.
+  plant_->WakeUp(context_.get(), plant_->world_body());
+  EXPECT_FALSE(plant_->IsSleeping(*context_, plant_->world_body()));
+
+  // The tree must be at rest for kNumSleepingSteps steps to fall asleep again.
+  for (int i = 0; i < kNumSleepingSteps; ++i) {
+    EXPECT_FALSE(plant_->IsSleeping(*context_, *resting_));
+    Step();
+  }
+  EXPECT_TRUE(plant_->IsSleeping(*context_, *resting_));
+}
+
+// Verifies that the dofs of sleeping trees drop out of the contact problem.
+// Both the TAMSI and SAP drivers only solve for the velocities listed as
+// unlocked in the joint locking cache.
+TEST_P(SleepingTest, SleepingTreesAreLocked) {
+  const int resting_start =
+      resting_->floating_velocities_start() - plant_->num_positions();
+  const int moving_start =
+      moving_->floating_velocities_start() - plant_->num_positions();
+  std::vector<int> resting_velocities(6);
+  std::iota(resting_velocities.begin(), resting_velocities.end(),
+            resting_start);
+  std::vector<int> moving_velocities(6);
+  std::iota(moving_velocities.begin(), moving_velocities.end(), moving_start);
+
+  {
+    const internal::JointLockingCacheData<double>& cache =
+        MultibodyPlantTester::EvalJointLockingCache(*plant_, *context_);
+    EXPECT_EQ(cache.unlocked_velocity_indices.size(), 12);
+    EXPECT_TRUE(cache.locked_velocity_indices.empty());
+  }
+
+  for (int i = 0; i < kNumSleepingSteps; ++i) {
+    Step();
+  }
+  ASSERT_TRUE(plant_->IsSleeping(*context_, *resting_));
+  {
+    const internal::JointLockingCacheData<double>& cache =
+        MultibodyPlantTester::EvalJointLockingCache(*plant_, *context_);
+    EXPECT_EQ(cache.unlocked_velocity_indices, moving_velocities);
+    EXPECT_EQ(cache.locked_velocity_indices, resting_velocities);
+  }
+
+  plant_->WakeUp(context_.get(), *resting_);
+  {
+    const internal::JointLockingCacheData<double>& cache =
+        MultibodyPlantTester::EvalJointLockingCache(*plant_, *context_);
+    EXPECT_EQ(cache.unlocked_velocity_indices.size(), 12);
+    EXPECT_TRUE(cache.locked_velocity_indices.empty());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Solvers, SleepingTest,
+                         ::testing::Values(DiscreteContactSolver::kTamsi,
+                                           DiscreteContactSolver::kSap));
+
+// Fixture for a box "upper" dropped onto a box "lower", in zero gravity and
+// with point contact. Both boxes are free bodies with a side of kBoxSize.
+// Box "lower" starts at rest, while box "upper" starts kGap above it and
+// moves towards it.
+class SleepingContactTest
+    : public ::testing::TestWithParam<DiscreteContactSolver> {
+ public:
+  static constexpr double kBoxSize = 0.1;
+  static constexpr double kGap = 0.055;
+  static constexpr double kUpperSpeed = 1.0;
+
+  void SetUp() override {
+    systems::DiagramBuilder<double> builder;
+    plant_ = &AddMultibodyPlantSceneGraph(&builder, kTimeStep).plant;
+    plant_->set_discrete_contact_solver(GetParam());
+    plant_->set_contact_model(ContactModel::kPoint);
+    plant_->mutable_gravity_field().set_gravity_vector(Vector3d::Zero());
+    lower_ = &AddBox("lower");
+    upper_ = &AddBox("upper");
+    plant_->set_sleeping_parameters(kVelocityThreshold, kNumSleepingSteps);
+    plant_->Finalize();
+    diagram_ = builder.Build();
+    diagram_context_ = diagram_->CreateDefaultContext();
+    context_ = &plant_->GetMyMutableContextFromRoot(diagram_context_.get());
+
+    plant_->SetFreeBodyPose(context_, *lower_, RigidTransformd());
+    plant_->SetFreeBodyPose(
+        context_, *upper_,
+        RigidTransformd(Vector3d(0.0, 0.0, kBoxSize + kGap)));
+    plant_->SetFreeBodySpatialVelocity(
+        context_, *upper_,
+        SpatialVelocity<double>(Vector3d::Zero(),
+                                Vector3d(0.0, 0.0, -kUpperSpeed)));
+  }
+
+ protected:
+  const RigidBody<double>& AddBox(const std::string& name) {
+    const RigidBody<double>& body = plant_->AddRigidBody(
+        name, SpatialInertia<double>::SolidCubeWithMass(1.0, kBoxSize));
+    plant_->RegisterCollisionGeometry(
+        body, RigidTransformd(), geometry::Box(kBoxSize, kBoxSize, kBoxSize),
+        name, CoulombFriction<double>(0.5, 0.5));
+    return body;
+  }
+
+  // Advances the state in `context_` by one discrete update.
+  void Step() {
+    const systems::DiscreteValues<double>& next =
+        plant_->EvalUniquePeriodicDiscreteUpdate(*context_);
+    context_->SetDiscreteState(next);
+  }
+
+  double GetHeight(const RigidBody<double>& body) const {
+    return plant_->EvalBodyPoseInWorld(*context_, body).translation().z();
+  }
+
+  MultibodyPlant<double>* plant_{nullptr};
+  const RigidBody<double>* lower_{nullptr};
+  const RigidBody<double>* upper_{nullptr};
+  std::unique_ptr<systems::Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> diagram_context_;
+  Context<double>* context_{nullptr};
+};
+
+// Verifies that a sleeping box stays frozen until a moving box hits it, and
+// that the contact wakes it up so that the impact can push it.
+TEST_P(SleepingContactTest, ContactWakesUp) {
+  for (int i = 0; i < kNumSleepingSteps; ++i) {
+    Step();
+  }
+  ASSERT_TRUE(plant_->IsSleeping(*context_, *lower_));
+  ASSERT_FALSE(plant_->IsSleeping(*context_, *upper_));
+  // The boxes are not yet in contact.
+  ASSERT_GT(GetHeight(*upper_) - GetHeight(*lower_), kBoxSize);
+
+  const RigidTransformd X_WL = plant_->EvalBodyPoseInWorld(*context_, *lower_);
+  // Upper would need kGap / (kUpperSpeed * kTimeStep) steps to close the gap;
+  // allow a few more.
+  const int max_num_steps = 10;
+  int num_steps = 0;
+  double upper_height_before_step{};
+  while (plant_->IsSleeping(*context_, *lower_)) {
+    ASSERT_LT(num_steps, max_num_steps);
+    EXPECT_TRUE(plant_->EvalBodyPoseInWorld(*context_, *lower_)
+                    .IsExactlyEqualTo(X_WL));
+    upper_height_before_step = GetHeight(*upper_);
+    Step();
+    ++num_steps;
+  }
+  // Lower was woken by the contact with upper, and not before.
+  EXPECT_LT(upper_height_before_step - GetHeight(*lower_), kBoxSize);
+
+  // Now that lower is awake, the contact pushes it away from upper.
+  Step();
+  EXPECT_LT(plant_->EvalBodySpatialVelocityInWorld(*context_, *lower_)
+                .translational()
+                .z(),
+            -kVelocityThreshold);
+}
+
+INSTANTIATE_TEST_SUITE_P(Solvers, SleepingContactTest,
+                         ::testing::Values(DiscreteContactSolver::kTamsi,
+                                           DiscreteContactSolver::kSap));
+
+GTEST_TEST(SleepingParametersTest, Errors) {
+  MultibodyPlant<double> continuous_plant(0.0);
+  EXPECT_THROW(continuous_plant.set_sleeping_parameters(kVelocityThreshold,
+                                                        kNumSleepingSteps),
+               std::exception);
+
+  MultibodyPlant<double> plant(kTimeStep);
+  EXPECT_FALSE(plant.is_sleeping_enabled());
+  EXPECT_THROW(plant.set_sleeping_parameters(-1.0, kNumSleepingSteps),
+               std::exception);
+  EXPECT_THROW(plant.set_sleeping_parameters(kVelocityThreshold, 0),
+               std::exception);
+  plant.set_sleeping_parameters(kVelocityThreshold, kNumSleepingSteps);
+  EXPECT_TRUE(plant.is_sleeping_enabled());
+
+  MultibodyPlant<double> plant_without_sleeping(kTimeStep);
+  plant_without_sleeping.Finalize();
+  auto context = plant_without_sleeping.CreateDefaultContext();
+  EXPECT_THROW(plant_without_sleeping.IsSleeping(
+                   *context, plant_without_sleeping.world_body()),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,194 @@
+#include "drake/multibody/tree/ltdl_factorization.h"
+
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+template <typename T>
+LtdlFactorization<T>::LtdlFactorization(std::vector<int> parents)
+    : parents_(std::move(parents)) {
+  for (int i = 0; i < size(); ++i) {
+    DRAKE_THROW_UNLESS(-1 <= parents_[i] && parents_[i] < i);
+  }
+  AllocateFactors();
+}
+
+template <typename T>
+LtdlFactorization<T>::LtdlFactorization(const MultibodyTreeTopology& topology)
+    : LtdlFactorization(CalcVelocityParents(topology)) {}
+
+template <typename T>
+LtdlFactorization<T>::LtdlFactorization(const MultibodyTreeTopology& topology,
+                                        const std::vector<int>& indices) {
+  const std::vector<int> full_parents = CalcVelocityParents(topology);
+  const int nv = full_parents.size();
+  // Maps each velocity to its row in the submatrix, or to -1 if it is not in
+  // `indices`.
+  std::vector<int> submatrix_row(nv, -1);
+  for (int k = 0; k < ssize(indices); ++k) {
+    DRAKE_THROW_UNLESS(0 <= indices[k] && indices[k] < nv);
+    DRAKE_THROW_UNLESS(k == 0 || indices[k - 1] < indices[k]);
+    submatrix_row[indices[k]] = k;
+  }
+  parents_.resize(indices.size());
+  for (int k = 0; k < ssize(indices); ++k) {
+    int j = full_parents[indices[k]];
+    while (j >= 0 && submatrix_row[j] < 0) {
+      j = full_parents[j];
+    }
+    parents_[k] = j >= 0 ? submatrix_row[j] : -1;
+  }
+  AllocateFactors();
+}
+
+template <typename T>
+std::vector<int> LtdlFactorization<T>::CalcVelocityParents(
+    const MultibodyTreeTopology& topology) {
+  DRAKE_DEMAND(topology.is_valid());
+  std::vector<int> parents(topology.num_velocities(), -1);
+  // last_velocity[n] stores the last velocity of the mobilizer of node n or,
+  // if that mobilizer has no velocities, of its nearest inboard mobilizer with
+  // velocities. It is -1 when there's no such mobilizer, as for the world.
+  // Since nodes are sorted in depth-first order, parent nodes are always
+  // processed before their children.
+  std::vector<int> last_velocity(topology.get_num_body_nodes(), -1);
+  for (BodyNodeIndex n(1); n < topology.get_num_body_nodes(); ++n) {
+    const BodyNodeTopology& node = topology.get_body_node(n);
+    const int start = node.mobilizer_velocities_start_in_v;
+    const int nv = node.num_mobilizer_velocities;
+    int parent = last_velocity[node.parent_body_node];
+    for (int i = start; i < start + nv; ++i) {
+      parents[i] = parent;
+      parent = i;
+    }
+    last_velocity[n] = parent;
+  }
+  return parents;
+}
+
+template <typename T>
+void LtdlFactorization<T>::AllocateFactors() {
+  const int n = size();
+  factor_row_start_.resize(n + 1);
+  std::vector<int> depth(n);
+  factor_row_start_[0] = 0;
+  for (int i = 0; i < n; ++i) {
+    const int p = parents_[i];
+    depth[i] = p >= 0 ? depth[p] + 1 : 0;
+    factor_row_start_[i + 1] = factor_row_start_[i] + depth[i];
+  }
+  L_.resize(factor_row_start_[n]);
+  D_.resize(n);
+  is_factored_ = false;
+}
+
+template <typename T>
+bool LtdlFactorization<T>::Factor(const Eigen::Ref<const MatrixX<T>>& H) {
+  const int n = size();
+  DRAKE_THROW_UNLESS(H.rows() == n && H.cols() == n);
+  is_factored_ = false;
+
+  // Gather the lower triangle of H within the sparsity pattern.
+  for (int i = 0; i < n; ++i) {
+    D_[i] = H(i, i);
+    int e = factor_row_start_[i];
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      L_[e++] = H(i, j);
+    }
+  }
+
+  // Factorization in place, Table 6.3 in [Featherstone 2008]. Row k is
+  // eliminated from the rows of its ancestors, which are the only ones coupled
+  // with it. Since the ancestors of the m-th ancestor i of k are the ancestors
+  // of k after i, all entries Hᵢⱼ updated by row k are in row k as Hₖⱼ.
+  for (int k = n - 1; k >= 0; --k) {
+    if (!(D_[k] > 0)) return false;
+    T* const row_k = L_.data() + factor_row_start_[k];
+    const int depth_k = factor_row_start_[k + 1] - factor_row_start_[k];
+    int i = parents_[k];
+    for (int m = 0; m < depth_k; ++m, i = parents_[i]) {
+      const T a = row_k[m] / D_[k];
+      D_[i] -= row_k[m] * a;
+      T* const row_i = L_.data() + factor_row_start_[i];
+      for (int r = m + 1; r < depth_k; ++r) {
+        row_i[r - m - 1] -= row_k[r] * a;
+      }
+      row_k[m] = a;
+    }
+  }
+
+  is_factored_ = true;
+  return true;
+}
+
+template <typename T>
+void LtdlFactorization<T>::SolveInPlace(EigenPtr<VectorX<T>> b) const {
+  DRAKE_DEMAND(is_factored());
+  DRAKE_DEMAND(b != nullptr);
+  DRAKE_DEMAND(b->size() == size());
+  const int n = size();
+  auto& x = *b;
+  // Solve Lᵀ⋅y = b, Table 6.4 in [Featherstone 2008].
+  for (int i = n - 1; i >= 0; --i) {
+    int e = factor_row_start_[i];
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      x[j] -= L_[e++] * x[i];
+    }
+  }
+  // Solve D⋅z = y.
+  x.array() /= D_.array();
+  // Solve L⋅x = z.
+  for (int i = 0; i < n; ++i) {
+    int e = factor_row_start_[i];
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      x[i] -= L_[e++] * x[j];
+    }
+  }
+}
+
+template <typename T>
+VectorX<T> LtdlFactorization<T>::Solve(
+    const Eigen::Ref<const VectorX<T>>& b) const {
+  VectorX<T> x = b;
+  SolveInPlace(&x);
+  return x;
+}
+
+template <typename T>
+VectorX<T> LtdlFactorization<T>::Multiply(
+    const Eigen::Ref<const VectorX<T>>& x) const {
+  DRAKE_DEMAND(is_factored());
+  DRAKE_DEMAND(x.size() == size());
+  const int n = size();
+  // y = L⋅x. Rows are processed last to first so that the entries of x they
+  // read are not yet overwritten.
+  VectorX<T> y = x;
+  for (int i = n - 1; i >= 0; --i) {
+    int e = factor_row_start_[i];
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      y[i] += L_[e++] * y[j];
+    }
+  }
+  // y = D⋅y.
+  y.array() *= D_.array();
+  // y = Lᵀ⋅y. Row i of L scatters into its ancestors, which precede it.
+  for (int i = 0; i < n; ++i) {
+    int e = factor_row_start_[i];
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      y[j] += L_[e++] * y[i];
+    }
+  }
+  return y;
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::internal::LtdlFactorization)
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/tree/multibody_tree_topology.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// Sparse LTDL factorization H = Lᵀ⋅D⋅L of a symmetric positive definite matrix
+// H with the sparsity pattern of a multibody tree's mass matrix, where L is
+// unit lower triangular and D is diagonal.
+//
+// The sparsity pattern is described by an array λ of "parent" indices, one
+// per row of H, such that λ(i) < i and λ(i) = -1 for the rows with no parent.
+// The entry Hᵢⱼ with i > j can only be nonzero if j is an "ancestor" of i,
+// i.e. if j is in the sequence λ(i), λ(λ(i)), ... For the mass matrix of a
+// MultibodyTree, the generalized velocities are numbered in depth-first order
+// and each velocity only couples with the velocities of the mobilizers
+// inboard or outboard of its own, see CalcVelocityParents(). Since a
+// factorization that eliminates the rows of H from last to first introduces no
+// fill-in for this ordering, L has the same sparsity pattern as H and
+// Factor(), SolveInPlace() and Multiply() are O(n⋅d), with n the size of H and
+// d the depth of the tree, as opposed to the O(n³) and O(n²) costs of their
+// dense counterparts. See Section 6.5 of [Featherstone 2008] for details.
+//
+// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+//   algorithms. Springer.
+//
+// @tparam_default_scalar
+template <typename T>
+class LtdlFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(LtdlFactorization)
+
+  // Constructs a factorization for matrices with the sparsity pattern given by
+  // the array of parent indices `parents`, see the class documentation.
+  // @throws std::exception if parents[i] is not in [-1, i) for some i.
+  explicit LtdlFactorization(std::vector<int> parents);
+
+  // Constructs a factorization for the mass matrix of a multibody tree with
+  // the given `topology`. The size of the matrix is
+  // topology.num_velocities().
+  // @pre topology is compiled.
+  explicit LtdlFactorization(const MultibodyTreeTopology& topology);
+
+  // Constructs a factorization for the principal submatrix of the mass matrix
+  // of a multibody tree with the given `topology` formed by the rows and
+  // columns in `indices`, for instance the mass matrix reduced to its unlocked
+  // velocities. The parent of each row in the submatrix is its nearest
+  // ancestor in the full mass matrix among those in `indices`.
+  // @throws std::exception if `indices` is not strictly increasing or if any
+  // of its entries is not in [0, topology.num_velocities()).
+  // @pre topology is compiled.
+  LtdlFactorization(const MultibodyTreeTopology& topology,
+                    const std::vector<int>& indices);
+
+  // Returns the array λ of parent indices of the mass matrix of a multibody
+  // tree with the given `topology`. The first velocity of a mobilizer has as
+  // parent the last velocity of the nearest inboard mobilizer with
+  // velocities, if any, while each of its other velocities has as parent the
+  // velocity that precedes it.
+  // @pre topology is compiled.
+  static std::vector<int> CalcVelocityParents(
+      const MultibodyTreeTopology& topology);
+
+  // The size of the matrices this factorization is for.
+  int size() const { return parents_.size(); }
+
+  // The array λ of parent indices describing the sparsity pattern of H.
+  const std::vector<int>& parents() const { return parents_; }
+
+  // Returns true if the last call to Factor() succeeded.
+  bool is_factored() const { return is_factored_; }
+
+  // Computes the factorization of `H`. Only the entries of the lower triangle
+  // of `H` that are within the sparsity pattern are read.
+  // @returns true if the factorization succeeded, or false if H isn't
+  // positive definite.
+  // @throws std::exception if H is not size() x size().
+  bool Factor(const Eigen::Ref<const MatrixX<T>>& H);
+
+  // Overwrites `b` with the solution x of H⋅x = b.
+  // @pre is_factored() is true and b->size() equals size().
+  void SolveInPlace(EigenPtr<VectorX<T>> b) const;
+
+  // Returns the solution x of H⋅x = b.
+  // @pre is_factored() is true and b.size() equals size().
+  VectorX<T> Solve(const Eigen::Ref<const VectorX<T>>& b) const;
+
+  // Returns the product H⋅x, computed from the factors of H.
+  // @pre is_factored() is true and x.size() equals size().
+  VectorX<T> Multiply(const Eigen::Ref<const VectorX<T>>& x) const;
+
+ private:
+  // Sets up the storage for the factors, given parents_.
+  void AllocateFactors();
+
+  // Parent indices λ.
+  std::vector<int> parents_;
+  // The strictly lower triangular entries of L (or of H, during the
+  // factorization) are stored row by row. The entries of row i are the
+  // entries Lᵢⱼ for j = λ(i), λ(λ(i)), ... in that order and they start at
+  // factor_row_start_[i]. Therefore, if j is the m-th ancestor of i, the
+  // ancestors of j are stored in row i starting at factor_row_start_[i] + m.
+  std::vector<int> factor_row_start_;
+  std::vector<T> L_;
+  VectorX<T> D_;
+  bool is_factored_{false};
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::internal::LtdlFactorization)
@@ -0,0 +1,235 @@
+#include "drake/multibody/tree/ltdl_factorization.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/tree/ball_rpy_joint.h"
+#include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/universal_joint.h"
+#include "drake/multibody/tree/weld_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using std::vector;
+using systems::Context;
+
+constexpr double kEpsilon = std::numeric_limits<double>::epsilon();
+
+// Returns true if j is an ancestor of i according to `parents`.
+bool IsAncestor(const vector<int>& parents, int i, int j) {
+  for (int k = parents[i]; k >= 0; k = parents[k]) {
+    if (k == j) return true;
+  }
+  return false;
+}
+
+// Makes a symmetric positive definite matrix with the sparsity pattern given
+// by `parents`.
+MatrixXd MakeSparseSpdMatrix(const vector<int>& parents) {
+  const int n = parents.size();
+  // H = Lᵀ⋅D⋅L, with L unit lower triangular and with the same sparsity
+  // pattern as H.
+  MatrixXd L = MatrixXd::Identity(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = parents[i]; j >= 0; j = parents[j]) {
+      L(i, j) = 0.1 * (i + 1) - 0.05 * j;
+    }
+  }
+  const VectorXd D = VectorXd::LinSpaced(n, 1.0, 2.0);
+  return L.transpose() * D.asDiagonal() * L;
+}
+
+GTEST_TEST(LtdlFactorizationTest, SolveAndMultiply) {
+  // Two trees: 0 → {1 → {2, 3}, 4 → 5} and 6 → 7.
+  const vector<int> parents = {-1, 0, 1, 1, 0, 4, -1, 6};
+  const MatrixXd H = MakeSparseSpdMatrix(parents);
+  // Sanity check that H has the sparsity pattern we expect.
+  for (int i = 0; i < H.rows(); ++i) {
+    for (int j = 0; j < i; ++j) {
+      if (!IsAncestor(parents, i, j)) {
+        EXPECT_EQ(H(i, j), 0.0);
+      }
+    }
+  }
+
+  LtdlFactorization<double> ltdl(parents);
+  EXPECT_EQ(ltdl.size(), 8);
+  EXPECT_EQ(ltdl.parents(), parents);
+  EXPECT_FALSE(ltdl.is_factored());
+  ASSERT_TRUE(ltdl.Factor(H));
+  EXPECT_TRUE(ltdl.is_factored());
+
+  const VectorXd b = VectorXd::LinSpaced(8, -1.0, 3.0);
+  const VectorXd x_expected = H.ldlt().solve(b);
+  EXPECT_TRUE(CompareMatrices(ltdl.Solve(b), x_expected, 16 * kEpsilon,
+                              MatrixCompareType::relative));
+  VectorXd x = b;
+  ltdl.SolveInPlace(&x);
+  EXPECT_TRUE(CompareMatrices(x, x_expected, 16 * kEpsilon,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(ltdl.Multiply(b), H * b, 16 * kEpsilon,
+                              MatrixCompareType::relative));
+}
+
+GTEST_TEST(LtdlFactorizationTest, NotPositiveDefinite) {
+  const vector<int> parents = {-1, 0, 1};
+  MatrixXd H = MakeSparseSpdMatrix(parents);
+  H(1, 1) = -1.0;
+  LtdlFactorization<double> ltdl(parents);
+  EXPECT_FALSE(ltdl.Factor(H));
+  EXPECT_FALSE(ltdl.is_factored());
+  EXPECT_THROW(ltdl.Factor(MatrixXd::Identity(2, 2)), std::exception);
+}
+
+GTEST_TEST(LtdlFactorizationTest, InvalidParents) {
+  EXPECT_THROW(LtdlFactorization<double>({-1, 1}), std::exception);
+  EXPECT_THROW(LtdlFactorization<double>({-2}), std::exception);
+}
+
+// Fixture for a model with two trees. The first one is: world → A (revolute),
+// A → B (ball rpy), A → C (weld), C → D (prismatic). The second one is:
+// world → E (universal), E → F (revolute).
+class MassMatrixFactorizationTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto tree = std::make_unique<MultibodyTree<double>>();
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.2, 0.3);
+    const RigidTransformd X_PF(Vector3d(0.1, 0.2, 0.3));
+    const RigidTransformd X_BM(Vector3d(-0.1, 0.0, 0.1));
+    const RigidBody<double>& A = tree->AddRigidBody("A", M_BBo_B);
+    const RigidBody<double>& B = tree->AddRigidBody("B", M_BBo_B);
+    const RigidBody<double>& C = tree->AddRigidBody("C", M_BBo_B);
+    const RigidBody<double>& D = tree->AddRigidBody("D", M_BBo_B);
+    const RigidBody<double>& E = tree->AddRigidBody("E", M_BBo_B);
+    const RigidBody<double>& F = tree->AddRigidBody("F", M_BBo_B);
+    joint_a_ = &tree->AddJoint<RevoluteJoint>(
+        "a", tree->world_body(), X_PF, A, X_BM, Vector3d::UnitZ());
+    joint_b_ = &tree->AddJoint<BallRpyJoint>("b", A, X_PF, B, X_BM);
+    tree->AddJoint<WeldJoint>("c", A, X_PF, C, X_BM, RigidTransformd());
+    joint_d_ = &tree->AddJoint<PrismaticJoint>("d", C, X_PF, D, X_BM,
+                                               Vector3d::UnitX());
+    joint_e_ = &tree->AddJoint<UniversalJoint>("e", tree->world_body(), X_PF,
+                                               E, X_BM);
+    joint_f_ = &tree->AddJoint<RevoluteJoint>("f", E, X_PF, F, X_BM,
+                                              Vector3d::UnitY());
+    system_ = std::make_unique<MultibodyTreeSystem<double>>(std::move(tree));
+    context_ = system_->CreateDefaultContext();
+    this->tree().GetMutablePositions(context_.get()) =
+        VectorXd::LinSpaced(this->tree().num_positions(), 0.1, 0.8);
+  }
+
+  const MultibodyTree<double>& tree() const {
+    return GetInternalTree(*system_);
+  }
+
+ protected:
+  std::unique_ptr<MultibodyTreeSystem<double>> system_;
+  std::unique_ptr<Context<double>> context_;
+  const Joint<double>* joint_a_{nullptr};
+  const Joint<double>* joint_b_{nullptr};
+  const Joint<double>* joint_d_{nullptr};
+  const Joint<double>* joint_e_{nullptr};
+  const Joint<double>* joint_f_{nullptr};
+};
+
+TEST_F(MassMatrixFactorizationTest, VelocityParents) {
+  const vector<int> parents =
+      LtdlFactorization<double>::CalcVelocityParents(tree().get_topology());
+  ASSERT_EQ(ssize(parents), 8);
+  const int a = joint_a_->velocity_start();
+  const int b = joint_b_->velocity_start();
+  const int d = joint_d_->velocity_start();
+  const int e = joint_e_->velocity_start();
+  const int f = joint_f_->velocity_start();
+  EXPECT_EQ(parents[a], -1);
+  EXPECT_EQ(parents[b], a);
+  EXPECT_EQ(parents[b + 1], b);
+  EXPECT_EQ(parents[b + 2], b + 1);
+  // Welded bodies are skipped.
+  EXPECT_EQ(parents[d], a);
+  EXPECT_EQ(parents[e], -1);
+  EXPECT_EQ(parents[e + 1], e);
+  EXPECT_EQ(parents[f], e + 1);
+
+  // The mass matrix has the sparsity pattern described by the parents.
+  MatrixXd M(8, 8);
+  tree().CalcMassMatrix(*context_, &M);
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      if (i != j && !IsAncestor(parents, i, j) &&
+          !IsAncestor(parents, j, i)) {
+        EXPECT_EQ(M(i, j), 0.0);
+      }
+    }
+  }
+}
+
+TEST_F(MassMatrixFactorizationTest, Solve) {
+  MatrixXd M(8, 8);
+  tree().CalcMassMatrix(*context_, &M);
+  LtdlFactorization<double> ltdl(tree().get_topology());
+  ASSERT_TRUE(ltdl.Factor(M));
+  const VectorXd b = VectorXd::LinSpaced(8, -2.0, 1.0);
+  EXPECT_TRUE(CompareMatrices(ltdl.Solve(b), M.ldlt().solve(b),
+                              1.0e-12, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(ltdl.Multiply(b), M * b, 1.0e-14,
+                              MatrixCompareType::relative));
+}
+
+// Verifies the factorization of the mass matrix reduced to a subset of its
+// velocities, as when some of the joints are locked.
+TEST_F(MassMatrixFactorizationTest, Submatrix) {
+  MatrixXd M(8, 8);
+  tree().CalcMassMatrix(*context_, &M);
+  // Remove joints a and e, and the first velocity of joint b.
+  vector<int> indices;
+  for (const Joint<double>* joint : {joint_b_, joint_d_, joint_f_}) {
+    for (int i = 0; i < joint->num_velocities(); ++i) {
+      if (joint == joint_b_ && i == 0) continue;
+      indices.push_back(joint->velocity_start() + i);
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+  const int n = indices.size();
+  MatrixXd M_reduced(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      M_reduced(i, j) = M(indices[i], indices[j]);
+    }
+  }
+
+  LtdlFactorization<double> ltdl(tree().get_topology(), indices);
+  ASSERT_EQ(ltdl.size(), n);
+  ASSERT_TRUE(ltdl.Factor(M_reduced));
+  const VectorXd b = VectorXd::LinSpaced(n, -2.0, 1.0);
+  EXPECT_TRUE(CompareMatrices(ltdl.Solve(b), M_reduced.ldlt().solve(b),
+                              1.0e-12, MatrixCompareType::relative));
+
+  EXPECT_THROW(LtdlFactorization<double>(tree().get_topology(), {1, 0}),
+               std::exception);
+  EXPECT_THROW(LtdlFactorization<double>(tree().get_topology(), {8}),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
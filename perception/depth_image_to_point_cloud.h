@@ -44,6 +44,12 @@ namespace perception {
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
 /// the Point Cloud Library (PCL).
 ///
+/// Back-projection, the handling of invalid depths, color attachment, and the
+/// camera pose transform all happen in a single pass over the image, writing
+/// directly into the output PointCloud (whose storage is reused when its size
+/// already matches the image).  For large images, the pass can optionally be
+/// spread across OpenMP threads; see the `parallelize` arguments below.
+///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
  public:
@@ -58,11 +64,14 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///   before projecting to a point cloud.  (This is useful for converting mm
   ///   to meters, etc.)
   /// @param[in] fields The fields the point cloud contains.
+  /// @param[in] parallelize Enables OpenMP parallelization of the conversion
+  ///   (across the rows of the image).
   explicit DepthImageToPointCloud(
       const systems::sensors::CameraInfo& camera_info,
       systems::sensors::PixelType depth_pixel_type =
           systems::sensors::PixelType::kDepth32F,
-      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      bool parallelize = false);
 
   /// Returns the abstract valued input port that expects either an
   /// ImageDepth16U or ImageDepth32F (depending on the constructor argument).
@@ -96,12 +105,14 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
   /// The `cloud` will be resized to match the size of the depth image.  The
   /// `cloud` must have the XYZ channel enabled.
+  /// @param[in] parallelize Enables OpenMP parallelization.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth32F& depth_image,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale, PointCloud* cloud);
+      const std::optional<float>& scale, PointCloud* cloud,
+      bool parallelize = false);
 
   /// Converts a depth image to a point cloud using direct arguments instead of
   /// System input and output ports.  The semantics are the same as documented
@@ -110,12 +121,14 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
   /// The `cloud` will be resized to match the size of the depth image.  The
   /// `cloud` must have the XYZ channel enabled.
+  /// @param[in] parallelize Enables OpenMP parallelization.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth16U& depth_image,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale, PointCloud* cloud);
+      const std::optional<float>& scale, PointCloud* cloud,
+      bool parallelize = false);
 
  private:
   void CalcOutput16U(const systems::Context<double>&, PointCloud*) const;
@@ -125,6 +138,7 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const systems::sensors::PixelType depth_pixel_type_;
   const float scale_;
   const pc_flags::BaseFieldT fields_;
+  const bool parallelize_;
 
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
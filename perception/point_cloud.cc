@@ -2,28 +2,21 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <functional>
-#include <unordered_map>
+#include <limits>
 #include <utility>
 #include <vector>
 
-#include <common_robotics_utilities/dynamic_spatial_hashed_voxel_grid.hpp>
 #include <common_robotics_utilities/openmp_helpers.hpp>
-#include <common_robotics_utilities/voxel_grid.hpp>
-#include <drake_vendor/nanoflann.hpp>
 #include <fmt/format.h>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
-#include "drake/common/unused.h"
 
 using Eigen::Map;
 using Eigen::NoChange;
 using common_robotics_utilities::openmp_helpers::GetNumOmpThreads;
-using common_robotics_utilities::voxel_grid::DSHVGSetType;
-using common_robotics_utilities::voxel_grid::DynamicSpatialHashedVoxelGrid;
-using common_robotics_utilities::voxel_grid::GridIndex;
-using common_robotics_utilities::voxel_grid::GridSizes;
 
 namespace drake {
 namespace perception {
@@ -35,6 +28,39 @@ typedef PointCloud::T T;
 typedef PointCloud::C C;
 typedef PointCloud::D D;
 
+// Voxel coordinates are bounded so that their differences cannot overflow.
+constexpr double kMaxVoxelCoordinate = 1e18;
+
+// Sorts `items` by `less`, optionally by sorting one chunk per OpenMP thread in
+// parallel and then merging the chunks pairwise.
+template <typename Item, typename Less>
+void SortInParallel(std::vector<Item>* items, const Less& less,
+                    bool parallelize) {
+  const int num_chunks = parallelize ? GetNumOmpThreads() : 1;
+  const int size = items->size();
+  if (num_chunks <= 1 || size < 4096) {
+    std::sort(items->begin(), items->end(), less);
+    return;
+  }
+  std::vector<int> bounds(num_chunks + 1);
+  for (int c = 0; c <= num_chunks; ++c) {
+    bounds[c] = static_cast<int64_t>(size) * c / num_chunks;
+  }
+  auto begin = items->begin();
+  CRU_OMP_PARALLEL_FOR_IF(true)
+  for (int c = 0; c < num_chunks; ++c) {
+    std::sort(begin + bounds[c], begin + bounds[c + 1], less);
+  }
+  for (int width = 1; width < num_chunks; width *= 2) {
+    CRU_OMP_PARALLEL_FOR_IF(true)
+    for (int c = 0; c < num_chunks - width; c += 2 * width) {
+      const int last = std::min(c + 2 * width, num_chunks);
+      std::inplace_merge(begin + bounds[c], begin + bounds[c + width],
+                         begin + bounds[last], less);
+    }
+  }
+}
+
 }  // namespace
 
 /*
@@ -476,44 +502,103 @@ PointCloud PointCloud::VoxelizedDownSample(
   DRAKE_THROW_UNLESS(has_xyzs());
   DRAKE_THROW_UNLESS(voxel_size > 0);
 
-  // Create a dynamic-spatial-hashed voxel grid (DSHVG) to bin points. While a
-  // DSHVG usually has each dynamic "chunk" contain multiple voxels, by setting
-  // the chunk size to (voxel_size, 1, 1, 1) each chunk contains a single voxel
-  // and the whole DSHVG behaves as a sparse voxel grid.
-  const GridSizes chunk_sizes(voxel_size, INT64_C(1), INT64_C(1), INT64_C(1));
-  const std::vector<int> default_chunk_value;
-  // By providing an initial estimated number of chunks, we reduce reallocation
-  // and rehashing in the DSHVG.
-  const size_t num_expected_chunks = static_cast<size_t>(size() / 16);
-  DynamicSpatialHashedVoxelGrid<std::vector<int>> dynamic_voxel_grid(
-      chunk_sizes, default_chunk_value, num_expected_chunks);
-
-  // Add points into the voxel grid.
+  // Since the parallel form imposes additional overhead, only use it when
+  // multiple OpenMP threads are available.
+  const bool can_execute_in_parallel = GetNumOmpThreads() > 1;
+  const bool operate_in_parallel = parallelize && can_execute_in_parallel;
+
+  // Find the voxel containing each finite point. Rather than binning the
+  // points with a hash map (and a heap-allocated list per voxel), we sort the
+  // points by voxel so that each voxel's points form a contiguous run.
+  std::vector<int> finite_indices;
+  finite_indices.reserve(size());
   for (int i = 0; i < size(); ++i) {
     if (xyz(i).array().isFinite().all()) {
-      auto chunk_query =
-          dynamic_voxel_grid.GetLocationMutable3d(xyz(i).cast<double>());
-      if (chunk_query) {
-        // If the containing chunk has already been allocated, add the current
-        // point index directly.
-        chunk_query.Value().emplace_back(i);
-      } else {
-        // If the containing chunk hasn't already been allocated, create a new
-        // chunk containing the current point index.
-        dynamic_voxel_grid.SetLocation3d(
-            xyz(i).cast<double>(), DSHVGSetType::SET_CHUNK, {i});
+      finite_indices.push_back(i);
+    }
+  }
+  const int num_finite = finite_indices.size();
+  std::vector<std::pair<Vector3<int64_t>, int>> voxels(num_finite);
+  std::atomic<bool> voxels_in_range(true);
+  CRU_OMP_PARALLEL_FOR_IF(operate_in_parallel)
+  for (int k = 0; k < num_finite; ++k) {
+    const int i = finite_indices[k];
+    const Eigen::Vector3d cell =
+        (xyz(i).cast<double>() / voxel_size).array().floor();
+    if (!(cell.cwiseAbs().maxCoeff() < kMaxVoxelCoordinate)) {
+      voxels_in_range = false;
+    }
+    voxels[k] = {cell.cast<int64_t>(), i};
+  }
+  if (!voxels_in_range) {
+    throw std::logic_error(fmt::format(
+        "PointCloud::VoxelizedDownSample(): voxel_size {} is too small for "
+        "the extent of the cloud",
+        voxel_size));
+  }
+
+  // When the occupied voxels span a small enough grid (as they almost always
+  // do), sort single 64-bit keys instead of coordinate triples.
+  std::vector<int> order(num_finite);
+  std::vector<int> run_starts;
+  const auto collect_runs = [&order, &run_starts](const auto& sorted,
+                                                  const auto& same_voxel) {
+    for (int k = 0; k < static_cast<int>(sorted.size()); ++k) {
+      order[k] = sorted[k].second;
+      if (k == 0 || !same_voxel(sorted[k - 1].first, sorted[k].first)) {
+        run_starts.push_back(k);
       }
     }
+    run_starts.push_back(sorted.size());
+  };
+  Vector3<int64_t> min_cell = Vector3<int64_t>::Zero();
+  Vector3<int64_t> max_cell = Vector3<int64_t>::Zero();
+  for (int k = 0; k < num_finite; ++k) {
+    min_cell = (k == 0) ? voxels[k].first : min_cell.cwiseMin(voxels[k].first);
+    max_cell = (k == 0) ? voxels[k].first : max_cell.cwiseMax(voxels[k].first);
+  }
+  const Vector3<int64_t> span = max_cell - min_cell + Vector3<int64_t>::Ones();
+  if (span.maxCoeff() < (INT64_C(1) << 21)) {
+    std::vector<std::pair<uint64_t, int>> keyed(num_finite);
+    CRU_OMP_PARALLEL_FOR_IF(operate_in_parallel)
+    for (int k = 0; k < num_finite; ++k) {
+      const Vector3<int64_t> offset = voxels[k].first - min_cell;
+      keyed[k] = {(static_cast<uint64_t>(offset[0]) << 42) |
+                      (static_cast<uint64_t>(offset[1]) << 21) |
+                      static_cast<uint64_t>(offset[2]),
+                  voxels[k].second};
+    }
+    SortInParallel(
+        &keyed,
+        [](const auto& a, const auto& b) {
+          return a.first < b.first;
+        },
+        operate_in_parallel);
+    collect_runs(keyed, std::equal_to<uint64_t>());
+  } else {
+    SortInParallel(
+        &voxels,
+        [](const auto& a, const auto& b) {
+          return std::lexicographical_compare(
+              a.first.data(), a.first.data() + 3, b.first.data(),
+              b.first.data() + 3);
+        },
+        operate_in_parallel);
+    collect_runs(voxels, std::equal_to<Vector3<int64_t>>());
   }
+  const int num_voxels = static_cast<int>(run_starts.size()) - 1;
 
   // Initialize downsampled cloud.
-  PointCloud down_sampled(
-      dynamic_voxel_grid.GetImmutableInternalChunks().size(),
-      storage_->fields());
+  PointCloud down_sampled(num_voxels, storage_->fields());
+
+  // Process the voxels, each of which writes only its own output point.
+  CRU_OMP_PARALLEL_FOR_IF(operate_in_parallel)
+  for (int index_in_down_sampled = 0; index_in_down_sampled < num_voxels;
+       ++index_in_down_sampled) {
+    const int run_begin = run_starts[index_in_down_sampled];
+    const int run_end = run_starts[index_in_down_sampled + 1];
+    const int num_in_voxel = run_end - run_begin;
 
-  // Helper lambda to process a single voxel cell.
-  const auto process_voxel = [this, &down_sampled](
-      int index_in_down_sampled, const std::vector<int>& indices_in_this) {
     // Use doubles instead of floats for accumulators to avoid round-off errors.
     Eigen::Vector3d xyz{Eigen::Vector3d::Zero()};
     Eigen::Vector3d normal{Eigen::Vector3d::Zero()};
@@ -523,7 +608,8 @@ PointCloud PointCloud::VoxelizedDownSample(
     int num_normals{0};
     int num_descriptors{0};
 
-    for (int index_in_this : indices_in_this) {
+    for (int k = run_begin; k < run_end; ++k) {
+      const int index_in_this = order[k];
       xyz += xyzs().col(index_in_this).cast<double>();
       if (has_normals() &&
           normals().col(index_in_this).array().isFinite().all()) {
@@ -540,64 +626,19 @@ PointCloud PointCloud::VoxelizedDownSample(
       }
     }
     down_sampled.mutable_xyzs().col(index_in_down_sampled) =
-        (xyz / indices_in_this.size()).cast<T>();
+        (xyz / num_in_voxel).cast<T>();
     if (has_normals()) {
       down_sampled.mutable_normals().col(index_in_down_sampled) =
           (normal / num_normals).normalized().cast<T>();
     }
     if (has_rgbs()) {
       down_sampled.mutable_rgbs().col(index_in_down_sampled) =
-          (rgb / indices_in_this.size()).cast<C>();
+          (rgb / num_in_voxel).cast<C>();
     }
     if (has_descriptors()) {
       down_sampled.mutable_descriptors().col(index_in_down_sampled) =
           (descriptor / num_descriptors).cast<D>();
     }
-  };
-
-  // Since the parallel form imposes additional overhead, only use it when
-  // multiple OpenMP threads are available.
-  const bool can_execute_in_parallel = GetNumOmpThreads() > 1;
-  const bool operate_in_parallel = parallelize && can_execute_in_parallel;
-
-  // Since we specify chunks contain a single voxel, a chunk's lone voxel can be
-  // retrieved with index (0, 0, 0).
-  const GridIndex kSingleVoxel(0, 0, 0);
-
-  // Populate the elements of the down_sampled cloud.
-  if (operate_in_parallel) {
-    // Flatten voxel cells to allow parallel processing.
-    std::vector<const std::vector<int>*> voxel_indices;
-    voxel_indices.reserve(
-        dynamic_voxel_grid.GetImmutableInternalChunks().size());
-    for (const auto& [chunk_region, chunk] :
-            dynamic_voxel_grid.GetImmutableInternalChunks()) {
-      unused(chunk_region);
-      const std::vector<int>& indices_in_this =
-          chunk.GetIndexImmutable(kSingleVoxel).Value();
-      voxel_indices.emplace_back(&indices_in_this);
-    }
-
-    // Process voxel cells in parallel.
-#if defined(_OPENMP)
-#pragma omp parallel for
-#endif
-    for (int index_in_down_sampled = 0;
-         index_in_down_sampled < static_cast<int>(voxel_indices.size());
-         ++index_in_down_sampled) {
-      process_voxel(
-          index_in_down_sampled, *voxel_indices[index_in_down_sampled]);
-    }
-  } else {
-    int index_in_down_sampled = 0;
-    for (const auto& [chunk_region, chunk] :
-            dynamic_voxel_grid.GetImmutableInternalChunks()) {
-      unused(chunk_region);
-      const std::vector<int>& indices_in_this =
-          chunk.GetIndexImmutable(kSingleVoxel).Value();
-      process_voxel(index_in_down_sampled, indices_in_this);
-      ++index_in_down_sampled;
-    }
   }
 
   return down_sampled;
@@ -605,83 +646,74 @@ PointCloud PointCloud::VoxelizedDownSample(
 
 bool PointCloud::EstimateNormals(
     const double radius, const int num_closest, const bool parallelize) {
+  DRAKE_THROW_UNLESS(has_xyzs());
+  return EstimateNormals(PointCloudIndex(xyzs(), parallelize), radius,
+                         num_closest, parallelize);
+}
+
+bool PointCloud::EstimateNormals(const PointCloudIndex& index,
+                                 const double radius, const int num_closest,
+                                 const bool parallelize) {
   DRAKE_DEMAND(radius > 0);
   DRAKE_DEMAND(num_closest >= 3);
   DRAKE_THROW_UNLESS(has_xyzs());
+  DRAKE_THROW_UNLESS(index.size() == size());
   constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
-  const double squared_radius = radius * radius;
 
   if (!has_normals()) {
     storage_->UpdateFields(storage_->fields() | pc_flags::kNormals);
   }
 
-  const Eigen::MatrixX3f data = xyzs().transpose();
-  nanoflann::KDTreeEigenMatrixAdaptor<Eigen::MatrixX3f, 3,
-                                      nanoflann::metric_L2_Simple>
-      kd_tree(3, data);
-
-  // Iterate through all points and compute their normals.
+  // Query the neighbors of a block of points at a time, which bounds the
+  // memory used for the results.
+  constexpr int kBlockSize = 16384;
+  Eigen::MatrixXi indices;
+  Eigen::MatrixXf squared_distances;
   std::atomic<bool> all_points_have_at_least_three_neighbors(true);
-
-  CRU_OMP_PARALLEL_FOR_IF(parallelize)
-  for (int i = 0; i < size(); ++i) {
-    VectorX<Eigen::Index> indices(num_closest);
-    Eigen::VectorXf distances(num_closest);
-
-    // nanoflann allows two types of queries:
-    // 1. search for the num_closest points, and then keep those within radius
-    // 2. search for points within radius, and then keep the num_closest
-    // for dense clouds where the number of points within radius would be high,
-    // approach (1) is considerably faster.
-    const int num_neighbors = kd_tree.index->knnSearch(
-        xyz(i).data(), num_closest, indices.data(), distances.data());
-
-    if (num_neighbors < 3) {
-      all_points_have_at_least_three_neighbors = false;
-    }
-
-    if (num_neighbors < 2) {
-      mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
-      continue;
-    }
-
-    // Compute the covariance matrix.
-    int count = 0;
-    Eigen::Vector3d mean = Eigen::Vector3d::Zero();
-
-    for (int j = 0; j < num_neighbors; ++j) {
-      if (distances[j] <= squared_radius) {
+  for (int block_begin = 0; block_begin < size(); block_begin += kBlockSize) {
+    const int block_size = std::min(kBlockSize, size() - block_begin);
+    // N.B. The query point itself is among its neighbors (when finite).
+    index.FindNearest(xyzs().middleCols(block_begin, block_size), num_closest,
+                      radius, &indices, &squared_distances, parallelize);
+
+    // Estimate the normal of each point in the block.
+    CRU_OMP_PARALLEL_FOR_IF(parallelize)
+    for (int b = 0; b < block_size; ++b) {
+      const int i = block_begin + b;
+      int count = 0;
+      while (count < num_closest && indices(count, b) >= 0) {
         ++count;
-        mean += xyz(indices[j]).cast<double>();
       }
-    }
-
-    if (count < 3) {
-      all_points_have_at_least_three_neighbors = false;
-    }
 
-    if (count < 2) {
-      mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
-      continue;
-    }
+      if (count < 3) {
+        all_points_have_at_least_three_neighbors = false;
+      }
 
-    mean /= count;
+      if (count < 2) {
+        mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
+        continue;
+      }
 
-    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+      // Compute the covariance matrix.
+      Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+      for (int j = 0; j < count; ++j) {
+        mean += xyz(indices(j, b)).cast<double>();
+      }
+      mean /= count;
 
-    for (int j = 0; j < num_neighbors; ++j) {
-      if (distances[j] <= squared_radius) {
-        const Eigen::VectorXd x_minus_mean =
-            xyz(indices[j]).cast<double>() - mean;
+      Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+      for (int j = 0; j < count; ++j) {
+        const Eigen::Vector3d x_minus_mean =
+            xyz(indices(j, b)).cast<double>() - mean;
         covariance += x_minus_mean * x_minus_mean.transpose();
       }
-    }
 
-    // TODO(russt): Open3d implements a "FastEigen3x3" for an optimized version
-    // of this. We probably should, too.
-    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
-    solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
-    mutable_normal(i) = solver.eigenvectors().col(0).cast<float>();
+      // TODO(russt): Open3d implements a "FastEigen3x3" for an optimized
+      // version of this. We probably should, too.
+      Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+      solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
+      mutable_normal(i) = solver.eigenvectors().col(0).cast<float>();
+    }
   }
   return all_points_have_at_least_three_neighbors.load();
 }
@@ -11,6 +11,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/perception/point_cloud_flags.h"
+#include "drake/perception/point_cloud_index.h"
 
 namespace drake {
 namespace perception {
@@ -340,6 +341,8 @@ class PointCloud final {
   /// Equivalent to Open3d's voxel_down_sample or PCL's VoxelGrid filter.
   /// @throws std::exception if has_xyzs() is false.
   /// @throws std::exception if voxel_size <= 0.
+  /// @throws std::exception if voxel_size is so small relative to the extent
+  /// of the cloud that a voxel's integer grid index would overflow.
   PointCloud VoxelizedDownSample(
       double voxel_size, bool parallelize = false) const;
 
@@ -361,6 +364,17 @@ class PointCloud final {
   bool EstimateNormals(
       double radius, int num_closest, bool parallelize = false);
 
+  /// Estimates the normal vectors in `this` exactly as above, but finds the
+  /// closest points using the given `index` rather than building a new one.
+  /// This avoids rebuilding the index when the same cloud's neighborhoods are
+  /// needed repeatedly (e.g., with different radii).
+  ///
+  /// @pre @p radius > 0 and @p num_closest >= 3.
+  /// @throws std::exception if has_xyzs() is false.
+  /// @throws std::exception if index.size() != size().
+  bool EstimateNormals(const PointCloudIndex& index, double radius,
+                       int num_closest, bool parallelize = false);
+
  private:
   void SetDefault(int start, int num);
 
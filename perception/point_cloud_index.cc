@@ -0,0 +1,230 @@
+#include "drake/perception/point_cloud_index.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
+#include <common_robotics_utilities/openmp_helpers.hpp>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+// The maximum number of points in a leaf of the tree.
+constexpr int kLeafSize = 16;
+
+// Below this many points (or queries), parallelizing costs more than it saves.
+constexpr int kMinParallelSize = 4096;
+
+// Every level of the tree at least halves the number of points per node, so
+// no tree over an int-indexed set of points is deeper than this.
+constexpr int kMaxDepth = 32;
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+
+// Returns the squared distance from `q` to the axis-aligned box with corners
+// `lower` and `upper` (zero if q is inside; +∞ if the box is empty).
+template <typename Derived>
+float SquaredDistanceToBox(const Eigen::Vector3f& q,
+                           const Eigen::MatrixBase<Derived>& lower,
+                           const Eigen::MatrixBase<Derived>& upper) {
+  if (lower[0] > upper[0]) {
+    return kInf;
+  }
+  return (lower - q).cwiseMax(q - upper).cwiseMax(0.0f).squaredNorm();
+}
+
+}  // namespace
+
+PointCloudIndex::PointCloudIndex(const Eigen::Ref<const Matrix3X<float>>& xyzs,
+                                 bool parallelize)
+    : size_(xyzs.cols()) {
+  original_indices_.reserve(size_);
+  for (int i = 0; i < size_; ++i) {
+    if (xyzs.col(i).allFinite()) {
+      original_indices_.push_back(i);
+    }
+  }
+  const int num_points = original_indices_.size();
+
+  // Halve the points until each leaf holds at most kLeafSize of them. Since
+  // every split is at the median, all nodes of a level have (within one) the
+  // same number of points, and so all leaves end up at the same depth.
+  int depth = 0;
+  while (((num_points - 1) >> depth) + 1 > kLeafSize) {
+    ++depth;
+  }
+  const int num_nodes = (2 << depth) - 1;
+  first_leaf_ = (1 << depth) - 1;
+  node_begin_.resize(num_nodes);
+  node_end_.resize(num_nodes);
+  node_lower_.resize(3, num_nodes);
+  node_upper_.resize(3, num_nodes);
+  node_begin_[0] = 0;
+  node_end_[0] = num_points;
+
+  // Build the tree one level at a time; the nodes of a level cover disjoint
+  // ranges of points, so they can be processed in parallel.
+  const bool build_in_parallel = parallelize && num_points >= kMinParallelSize;
+  for (int level = 0; level <= depth; ++level) {
+    const int first_node = (1 << level) - 1;
+    const int num_level_nodes = 1 << level;
+    CRU_OMP_PARALLEL_FOR_IF(build_in_parallel)
+    for (int k = 0; k < num_level_nodes; ++k) {
+      const int node = first_node + k;
+      const int begin = node_begin_[node];
+      const int end = node_end_[node];
+      Eigen::Vector3f lower = Eigen::Vector3f::Constant(kInf);
+      Eigen::Vector3f upper = Eigen::Vector3f::Constant(-kInf);
+      for (int j = begin; j < end; ++j) {
+        lower = lower.cwiseMin(xyzs.col(original_indices_[j]));
+        upper = upper.cwiseMax(xyzs.col(original_indices_[j]));
+      }
+      node_lower_.col(node) = lower;
+      node_upper_.col(node) = upper;
+      if (level == depth) {
+        continue;
+      }
+
+      // Split at the median along the box's longest axis.
+      int axis{};
+      (upper - lower).maxCoeff(&axis);
+      const int middle = begin + (end - begin) / 2;
+      std::nth_element(original_indices_.begin() + begin,
+                       original_indices_.begin() + middle,
+                       original_indices_.begin() + end,
+                       [&xyzs, axis](int a, int b) {
+                         return xyzs(axis, a) < xyzs(axis, b);
+                       });
+      node_begin_[2 * node + 1] = begin;
+      node_end_[2 * node + 1] = middle;
+      node_begin_[2 * node + 2] = middle;
+      node_end_[2 * node + 2] = end;
+    }
+  }
+
+  // Store the points in tree order, so that each leaf's points are adjacent.
+  points_.resize(3, num_points);
+  for (int j = 0; j < num_points; ++j) {
+    points_.col(j) = xyzs.col(original_indices_[j]);
+  }
+}
+
+void PointCloudIndex::FindNearest(
+    const Eigen::Ref<const Matrix3X<float>>& queries, int num_closest,
+    double radius, Eigen::MatrixXi* indices,
+    Eigen::MatrixXf* squared_distances, bool parallelize) const {
+  DRAKE_DEMAND(num_closest >= 1);
+  DRAKE_DEMAND(radius >= 0);
+  DRAKE_DEMAND(indices != nullptr);
+  DRAKE_DEMAND(squared_distances != nullptr);
+  const int num_queries = queries.cols();
+  indices->setConstant(num_closest, num_queries, -1);
+  squared_distances->setConstant(num_closest, num_queries, kInf);
+  const float squared_radius = static_cast<float>(radius * radius);
+
+  CRU_OMP_PARALLEL_FOR_IF(parallelize && num_queries >= kMinParallelSize)
+  for (int q = 0; q < num_queries; ++q) {
+    const Eigen::Vector3f query = queries.col(q);
+    if (!query.allFinite()) {
+      continue;
+    }
+    // The best candidates so far are kept sorted in the q'th output columns,
+    // whose last entry is thus the distance any new candidate must beat.
+    int* const best_indices = indices->col(q).data();
+    float* const best_distances = squared_distances->col(q).data();
+    const auto bound = [&]() {
+      return std::min(squared_radius, best_distances[num_closest - 1]);
+    };
+    // Nodes to visit, with the squared distance to their boxes. Each visit
+    // pops one node and pushes at most two, so the stack never holds more
+    // than one node per level.
+    std::array<std::pair<int, float>, kMaxDepth + 1> stack;
+    int stack_size = 0;
+    stack[stack_size++] = {
+        0, SquaredDistanceToBox(query, node_lower_.col(0), node_upper_.col(0))};
+    while (stack_size > 0) {
+      const auto [node, node_distance] = stack[--stack_size];
+      if (node_distance > bound()) {
+        continue;
+      }
+      if (node >= first_leaf_) {
+        for (int j = node_begin_[node]; j < node_end_[node]; ++j) {
+          const float distance = (points_.col(j) - query).squaredNorm();
+          if (distance > bound()) {
+            continue;
+          }
+          // Insertion sort, dropping the farthest candidate.
+          int k = num_closest - 1;
+          for (; k > 0 && best_distances[k - 1] > distance; --k) {
+            best_distances[k] = best_distances[k - 1];
+            best_indices[k] = best_indices[k - 1];
+          }
+          best_distances[k] = distance;
+          best_indices[k] = j;
+        }
+        continue;
+      }
+      // Visit the nearer child first (it is pushed last).
+      const int left = 2 * node + 1;
+      const int right = 2 * node + 2;
+      const float left_distance = SquaredDistanceToBox(
+          query, node_lower_.col(left), node_upper_.col(left));
+      const float right_distance = SquaredDistanceToBox(
+          query, node_lower_.col(right), node_upper_.col(right));
+      if (left_distance <= right_distance) {
+        stack[stack_size++] = {right, right_distance};
+        stack[stack_size++] = {left, left_distance};
+      } else {
+        stack[stack_size++] = {left, left_distance};
+        stack[stack_size++] = {right, right_distance};
+      }
+    }
+    for (int k = 0; k < num_closest && best_indices[k] >= 0; ++k) {
+      best_indices[k] = original_indices_[best_indices[k]];
+    }
+  }
+}
+
+std::vector<std::vector<int>> PointCloudIndex::FindWithinRadius(
+    const Eigen::Ref<const Matrix3X<float>>& queries, double radius,
+    bool parallelize) const {
+  DRAKE_DEMAND(radius >= 0);
+  const int num_queries = queries.cols();
+  std::vector<std::vector<int>> result(num_queries);
+  const float squared_radius = static_cast<float>(radius * radius);
+
+  CRU_OMP_PARALLEL_FOR_IF(parallelize && num_queries >= kMinParallelSize)
+  for (int q = 0; q < num_queries; ++q) {
+    const Eigen::Vector3f query = queries.col(q);
+    if (!query.allFinite()) {
+      continue;
+    }
+    std::vector<int> stack{0};
+    while (!stack.empty()) {
+      const int node = stack.back();
+      stack.pop_back();
+      if (SquaredDistanceToBox(query, node_lower_.col(node),
+                               node_upper_.col(node)) > squared_radius) {
+        continue;
+      }
+      if (node >= first_leaf_) {
+        for (int j = node_begin_[node]; j < node_end_[node]; ++j) {
+          if ((points_.col(j) - query).squaredNorm() <= squared_radius) {
+            result[q].push_back(original_indices_[j]);
+          }
+        }
+        continue;
+      }
+      stack.push_back(2 * node + 1);
+      stack.push_back(2 * node + 2);
+    }
+  }
+  return result;
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace perception {
+
+/// A spatial index (a k-d tree) over a set of points, e.g., the xyzs of a
+/// PointCloud, that answers nearest-neighbor and radius queries for many query
+/// points at once.
+///
+/// Building the index costs O(n log n) for n points; each query then costs
+/// roughly O(log n) plus the number of points reported. An index is therefore
+/// worth keeping whenever the same points are queried repeatedly, e.g., by
+/// PointCloud::EstimateNormals() and by application code that also needs
+/// neighborhoods.
+///
+/// The index holds its own copy of the points, so it remains valid (but
+/// describes the old positions) if the cloud it was built from subsequently
+/// changes. Points with non-finite coordinates are never reported by queries.
+class PointCloudIndex final {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PointCloudIndex)
+
+  /// Builds the index over the columns of `xyzs`; queries report points by
+  /// their column index in `xyzs`. @p parallelize enables OpenMP
+  /// parallelization.
+  explicit PointCloudIndex(const Eigen::Ref<const Matrix3X<float>>& xyzs,
+                           bool parallelize = false);
+
+  /// Returns the number of columns of the `xyzs` this index was built from.
+  int size() const { return size_; }
+
+  /// For each column j of `queries`, finds the (at most) `num_closest` indexed
+  /// points nearest to it that lie within Euclidean distance `radius` (which
+  /// may be infinite). On return, column j of `indices` and of
+  /// `squared_distances` hold those points' indices and squared distances,
+  /// sorted by increasing distance; any remaining entries of the column are
+  /// set to -1 and +∞, respectively. Both outputs are resized to `num_closest`
+  /// rows and one column per query. @p parallelize enables OpenMP
+  /// parallelization across the queries.
+  ///
+  /// @pre @p num_closest >= 1 and @p radius >= 0.
+  /// @pre Neither output is nullptr.
+  void FindNearest(const Eigen::Ref<const Matrix3X<float>>& queries,
+                   int num_closest, double radius, Eigen::MatrixXi* indices,
+                   Eigen::MatrixXf* squared_distances,
+                   bool parallelize = false) const;
+
+  /// For each column j of `queries`, returns (as the j'th element) the indices
+  /// of all indexed points within Euclidean distance `radius` of it, in no
+  /// particular order. @p parallelize enables OpenMP parallelization across
+  /// the queries.
+  ///
+  /// @pre @p radius >= 0.
+  std::vector<std::vector<int>> FindWithinRadius(
+      const Eigen::Ref<const Matrix3X<float>>& queries, double radius,
+      bool parallelize = false) const;
+
+ private:
+  int size_{};
+
+  // The finite points, permuted so that every node of the tree covers a
+  // contiguous range of columns, and the original index of each column.
+  Matrix3X<float> points_;
+  std::vector<int> original_indices_;
+
+  // The tree is complete and balanced: node i has children 2i+1 and 2i+2, and
+  // all leaves are at the same depth. Node i covers the columns
+  // [node_begin_[i], node_end_[i]) of points_, within the axis-aligned box
+  // with corners node_lower_.col(i) and node_upper_.col(i).
+  std::vector<int> node_begin_;
+  std::vector<int> node_end_;
+  Matrix3X<float> node_lower_;
+  Matrix3X<float> node_upper_;
+  int first_leaf_{};
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -482,6 +482,59 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies that the parallel conversion matches the serial one, for both API
+// flavors.
+GTEST_TEST(DepthImageToPointCloudParallelTest, MatchesSerial) {
+  const int kWidth = 64;
+  const int kHeight = 48;
+  const CameraInfo camera(kWidth, kHeight, 500.0, 480.0, 31.5, 23.5);
+  const RigidTransformd pose(RollPitchYawd(0.1, -0.2, 0.3),
+                             Vector3d(1.1, -1.2, 1.3));
+  systems::sensors::ImageDepth16U depth_image(kWidth, kHeight);
+  ImageRgba8U color_image(kWidth, kHeight);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      // Include some kTooClose and kTooFar pixels.
+      depth_image.at(u, v)[0] = (u * 7919 + v * 104729) % 65536;
+      color_image.at(u, v)[0] = u;
+      color_image.at(u, v)[1] = v;
+      color_image.at(u, v)[2] = u + v;
+    }
+  }
+  depth_image.at(3, 4)[0] = 0;
+  depth_image.at(4, 3)[0] = 65535;
+
+  const pc_flags::BaseFieldT fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  PointCloud serial(0, fields);
+  DepthImageToPointCloud::Convert(camera, pose, depth_image, color_image,
+                                  0.001f, &serial);
+  PointCloud parallel(0, fields);
+  DepthImageToPointCloud::Convert(camera, pose, depth_image, color_image,
+                                  0.001f, &parallel, true /* parallelize */);
+  EXPECT_TRUE(CompareMatrices(parallel.xyzs(), serial.xyzs()));
+  EXPECT_EQ(parallel.rgbs(), serial.rgbs());
+  EXPECT_EQ(serial.rgb(kWidth + 2), Vector3<uint8_t>(2, 1, 3));
+  EXPECT_EQ(serial.xyz(3 * kWidth + 4), Vector3f::Constant(kFloatInf));
+  EXPECT_EQ(serial.xyz(4 * kWidth + 3), Vector3f::Constant(kFloatInf));
+
+  const DepthImageToPointCloud dut(camera, PixelType::kDepth16U, 0.001f,
+                                   fields, true /* parallelize */);
+  auto context = dut.CreateDefaultContext();
+  dut.depth_image_input_port().FixValue(context.get(), depth_image);
+  dut.color_image_input_port().FixValue(context.get(), color_image);
+  dut.camera_pose_input_port().FixValue(context.get(), pose);
+  const auto& result = dut.point_cloud_output_port().Eval<PointCloud>(*context);
+  EXPECT_TRUE(CompareMatrices(result.xyzs(), serial.xyzs()));
+  EXPECT_EQ(result.rgbs(), serial.rgbs());
+
+  // The color image must match the depth image's size.
+  const ImageRgba8U wrong_color_image(kWidth, kHeight + 1);
+  EXPECT_THROW(DepthImageToPointCloud::Convert(camera, pose, depth_image,
+                                               wrong_color_image, 0.001f,
+                                               &serial),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
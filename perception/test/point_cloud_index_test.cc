@@ -0,0 +1,158 @@
+#include "drake/perception/point_cloud_index.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/random.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+
+// Returns `num_points` points sampled uniformly from the unit cube, with a few
+// of them replaced by non-finite values.
+Matrix3X<float> MakePoints(int num_points, RandomGenerator* generator) {
+  std::uniform_real_distribution<float> distribution(0, 1);
+  Matrix3X<float> xyzs(3, num_points);
+  for (int i = 0; i < xyzs.size(); ++i) {
+    xyzs.data()[i] = distribution(*generator);
+  }
+  for (int i = 0; i < num_points; i += 97) {
+    xyzs(i % 3, i) = (i % 2) ? kInf : std::numeric_limits<float>::quiet_NaN();
+  }
+  return xyzs;
+}
+
+// Returns the (squared distance, index) pairs of all finite `xyzs` within
+// `radius` of `query`, sorted by increasing distance.
+std::vector<std::pair<float, int>> BruteForceNeighbors(
+    const Matrix3X<float>& xyzs, const Eigen::Vector3f& query, double radius) {
+  std::vector<std::pair<float, int>> result;
+  for (int i = 0; i < xyzs.cols(); ++i) {
+    if (!xyzs.col(i).allFinite()) {
+      continue;
+    }
+    const float distance = (xyzs.col(i) - query).squaredNorm();
+    if (distance <= radius * radius) {
+      result.emplace_back(distance, i);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+class PointCloudIndexTest : public ::testing::TestWithParam<bool> {};
+
+TEST_P(PointCloudIndexTest, FindNearest) {
+  const bool parallelize = GetParam();
+  RandomGenerator generator(1234);
+  const Matrix3X<float> xyzs = MakePoints(10000, &generator);
+  const Matrix3X<float> queries = MakePoints(200, &generator);
+  const PointCloudIndex dut(xyzs, parallelize);
+  EXPECT_EQ(dut.size(), xyzs.cols());
+
+  constexpr double kInfRadius = std::numeric_limits<double>::infinity();
+  for (const double radius : {0.05, 0.2, kInfRadius}) {
+    const int num_closest = 10;
+    Eigen::MatrixXi indices;
+    Eigen::MatrixXf squared_distances;
+    dut.FindNearest(queries, num_closest, radius, &indices, &squared_distances,
+                    parallelize);
+    ASSERT_EQ(indices.rows(), num_closest);
+    ASSERT_EQ(indices.cols(), queries.cols());
+    ASSERT_EQ(squared_distances.rows(), num_closest);
+    ASSERT_EQ(squared_distances.cols(), queries.cols());
+
+    for (int q = 0; q < queries.cols(); ++q) {
+      std::vector<std::pair<float, int>> expected;
+      if (queries.col(q).allFinite()) {
+        expected = BruteForceNeighbors(xyzs, queries.col(q), radius);
+      }
+      const int num_expected = std::min<int>(num_closest, expected.size());
+      for (int k = 0; k < num_closest; ++k) {
+        if (k < num_expected) {
+          // Compare distances rather than indices, which are ambiguous when
+          // two points are equidistant.
+          EXPECT_FLOAT_EQ(squared_distances(k, q), expected[k].first);
+          EXPECT_FLOAT_EQ(
+              (xyzs.col(indices(k, q)) - queries.col(q)).squaredNorm(),
+              expected[k].first);
+        } else {
+          EXPECT_EQ(indices(k, q), -1);
+          EXPECT_EQ(squared_distances(k, q), kInf);
+        }
+      }
+    }
+  }
+}
+
+TEST_P(PointCloudIndexTest, FindWithinRadius) {
+  const bool parallelize = GetParam();
+  RandomGenerator generator(5678);
+  const Matrix3X<float> xyzs = MakePoints(10000, &generator);
+  const Matrix3X<float> queries = MakePoints(200, &generator);
+  const PointCloudIndex dut(xyzs, parallelize);
+
+  const double radius = 0.1;
+  const std::vector<std::vector<int>> result =
+      dut.FindWithinRadius(queries, radius, parallelize);
+  ASSERT_EQ(result.size(), queries.cols());
+  for (int q = 0; q < queries.cols(); ++q) {
+    std::vector<int> expected;
+    if (queries.col(q).allFinite()) {
+      for (const auto& [distance, i] :
+           BruteForceNeighbors(xyzs, queries.col(q), radius)) {
+        expected.push_back(i);
+      }
+    }
+    std::vector<int> actual = result[q];
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+// Small and degenerate inputs still produce a valid index.
+TEST_P(PointCloudIndexTest, Degenerate) {
+  const bool parallelize = GetParam();
+  Eigen::MatrixXi indices;
+  Eigen::MatrixXf squared_distances;
+  const Matrix3X<float> query = Matrix3X<float>::Zero(3, 1);
+
+  // No points at all.
+  const PointCloudIndex empty(Matrix3X<float>(3, 0), parallelize);
+  EXPECT_EQ(empty.size(), 0);
+  empty.FindNearest(query, 3, 1.0, &indices, &squared_distances);
+  EXPECT_TRUE((indices.array() == -1).all());
+  EXPECT_TRUE(empty.FindWithinRadius(query, 1.0)[0].empty());
+
+  // Only non-finite points.
+  const PointCloudIndex non_finite(Matrix3X<float>::Constant(3, 5, kInf),
+                                   parallelize);
+  EXPECT_EQ(non_finite.size(), 5);
+  non_finite.FindNearest(query, 3, 1.0, &indices, &squared_distances);
+  EXPECT_TRUE((indices.array() == -1).all());
+
+  // Many copies of the same point.
+  const PointCloudIndex duplicates(Matrix3X<float>::Ones(3, 100),
+                                   parallelize);
+  duplicates.FindNearest(query, 3, 10.0, &indices, &squared_distances);
+  EXPECT_TRUE((indices.array() >= 0).all());
+  EXPECT_TRUE((squared_distances.array() == 3).all());
+  EXPECT_EQ(duplicates.FindWithinRadius(query, 10.0)[0].size(), 100);
+}
+
+INSTANTIATE_TEST_SUITE_P(Serial, PointCloudIndexTest, ::testing::Values(false));
+INSTANTIATE_TEST_SUITE_P(Parallel, PointCloudIndexTest,
+                         ::testing::Values(true));
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -1,6 +1,11 @@
 #include "drake/perception/point_cloud.h"
 
+#include <algorithm>
+#include <array>
+#include <map>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <common_robotics_utilities/openmp_helpers.hpp>
 #include <gtest/gtest.h>
@@ -628,6 +633,60 @@ GTEST_TEST(PointCloudTest, VoxelizedDownSample) {
   EXPECT_TRUE(found_match_for_cloud_0);
 }
 
+// Checks a larger cloud (large enough to use the parallel sort, when enabled)
+// against a simple reference implementation.
+GTEST_TEST(PointCloudTest, VoxelizedDownSampleMany) {
+  const int kSize{20000};
+  PointCloud cloud(kSize);
+  RandomGenerator generator(1234);
+  std::uniform_real_distribution<float> distribution(-10, 10);
+  for (int i = 0; i < 3 * kSize; ++i) {
+    cloud.mutable_xyzs().data()[i] = distribution(generator);
+  }
+
+  const double voxel_size = 0.5;
+  std::map<std::array<int, 3>, std::pair<Eigen::Vector3d, int>> voxels;
+  for (int i = 0; i < kSize; ++i) {
+    const Eigen::Vector3d xyz = cloud.xyz(i).cast<double>();
+    const std::array<int, 3> key{
+        static_cast<int>(std::floor(xyz[0] / voxel_size)),
+        static_cast<int>(std::floor(xyz[1] / voxel_size)),
+        static_cast<int>(std::floor(xyz[2] / voxel_size))};
+    auto& [sum, count] = voxels[key];
+    if (count == 0) {
+      sum.setZero();
+    }
+    sum += xyz;
+    ++count;
+  }
+
+  const PointCloud down_sampled =
+      cloud.VoxelizedDownSample(voxel_size, ENABLE_PARALLEL_OPS);
+  ASSERT_EQ(down_sampled.size(), static_cast<int>(voxels.size()));
+  std::vector<Eigen::Vector3f> expected;
+  for (const auto& [key, sum_and_count] : voxels) {
+    const auto& [sum, count] = sum_and_count;
+    expected.push_back((sum / count).cast<float>());
+  }
+  std::vector<Eigen::Vector3f> actual;
+  for (int i = 0; i < down_sampled.size(); ++i) {
+    actual.push_back(down_sampled.xyz(i));
+  }
+  const auto less = [](const Eigen::Vector3f& a, const Eigen::Vector3f& b) {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+  };
+  std::sort(expected.begin(), expected.end(), less);
+  std::sort(actual.begin(), actual.end(), less);
+  for (int i = 0; i < down_sampled.size(); ++i) {
+    EXPECT_TRUE(CompareMatrices(actual[i], expected[i], 1e-5));
+  }
+
+  // A voxel size that would overflow the voxel coordinates is rejected.
+  EXPECT_THROW(cloud.VoxelizedDownSample(1e-30, ENABLE_PARALLEL_OPS),
+               std::exception);
+}
+
 // Checks that normal has unit magnitude and that normal == expected up to a
 // sign flip.
 void CheckNormal(const Eigen::Ref<const Vector3f>& normal,
@@ -693,6 +752,28 @@ GTEST_TEST(PointCloudTest, EstimateNormalsSphere) {
   }
 }
 
+// Tests that normals estimated using a prebuilt index match those estimated
+// using an index built internally.
+GTEST_TEST(PointCloudTest, EstimateNormalsWithIndex) {
+  const int kSize{1000};
+  PointCloud cloud(kSize);
+  RandomGenerator generator(1234);
+  std::normal_distribution<double> distribution(0, 1.0);
+  for (int i = 0; i < 3 * kSize; ++i) {
+    cloud.mutable_xyzs().data()[i] = distribution(generator);
+  }
+  const PointCloudIndex index(cloud.xyzs(), ENABLE_PARALLEL_OPS);
+
+  PointCloud expected = cloud;
+  EXPECT_EQ(expected.EstimateNormals(0.5, 10, ENABLE_PARALLEL_OPS),
+            cloud.EstimateNormals(index, 0.5, 10, ENABLE_PARALLEL_OPS));
+  EXPECT_TRUE(CompareMatrices(cloud.normals(), expected.normals()));
+
+  // The index must describe the cloud.
+  const PointCloudIndex wrong_index(cloud.xyzs().leftCols(10));
+  EXPECT_THROW(cloud.EstimateNormals(wrong_index, 0.5, 10), std::exception);
+}
+
 // Tests that you can compute normals with just two neighbors; the normal is
 // ambiguous, but the computed normal will at least be orthogonal.
 GTEST_TEST(PointCloudTest, EstimateNormalsTwoPoints) {
@@ -0,0 +1,364 @@
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/clp_solver.h"
+#include "drake/solvers/csdp_solver.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/nlopt_solver.h"
+#include "drake/solvers/osqp_solver.h"
+#include "drake/solvers/scs_solver.h"
+#include "drake/tools/performance/fixture_common.h"
+
+// This file benchmarks the open-source MathematicalProgram backends on a small
+// corpus of programs that are representative of how Drake uses them. Each
+// program is timed twice: once for its construction alone (BuildProgram/...),
+// and once per backend for the solve (SolveProgram/...). The solve time
+// includes the time each backend spends parsing the MathematicalProgram into
+// its own format. Where the backend reports the time it spent in its own setup
+// and solve, the solve time is split into the counters `parse_time` and
+// `solver_time` (in seconds per solve). Where the backend reports its iteration
+// count, it is added as the counter `iterations`; of the backends here, only
+// OSQP and SCS do (in their SolverDetails). Clp, CSDP, Ipopt, and NLopt don't
+// expose an iteration count through Drake, so their solves have no such
+// counter.
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using symbolic::Expression;
+using symbolic::Polynomial;
+
+using ProgramFactory = std::unique_ptr<MathematicalProgram> (*)();
+using SolverIdGetter = SolverId (*)();
+
+// The convex relaxation of a shortest path problem on a 12x12 grid graph,
+// with an edge flow in [0, 1] for each direction of every edge, as solved by
+// GraphOfConvexSets before rounding. This is a linear program.
+std::unique_ptr<MathematicalProgram> MakeShortestPathRelaxation() {
+  constexpr int kGridSize = 12;
+  constexpr int kNumVertices = kGridSize * kGridSize;
+  auto prog = std::make_unique<MathematicalProgram>();
+  std::vector<Expression> net_outflow(kNumVertices, Expression(0));
+  Expression cost(0);
+  const auto add_edge = [&](int u, int v) {
+    const symbolic::Variable flow = prog->NewContinuousVariables<1>("f")(0);
+    prog->AddBoundingBoxConstraint(0, 1, flow);
+    net_outflow[u] += flow;
+    net_outflow[v] -= flow;
+    cost += (1.5 + std::sin(0.7 * u + 1.3 * v)) * flow;
+  };
+  for (int i = 0; i < kGridSize; ++i) {
+    for (int j = 0; j < kGridSize; ++j) {
+      const int u = i * kGridSize + j;
+      if (i + 1 < kGridSize) {
+        add_edge(u, u + kGridSize);
+        add_edge(u + kGridSize, u);
+      }
+      if (j + 1 < kGridSize) {
+        add_edge(u, u + 1);
+        add_edge(u + 1, u);
+      }
+    }
+  }
+  // One unit of flow leaves the first vertex. The conservation constraint on
+  // the last vertex is implied by the others, so it is omitted to keep the
+  // equality constraints linearly independent.
+  prog->AddLinearEqualityConstraint(net_outflow[0] == 1);
+  for (int u = 1; u < kNumVertices - 1; ++u) {
+    prog->AddLinearEqualityConstraint(net_outflow[u] == 0);
+  }
+  prog->AddLinearCost(cost);
+  return prog;
+}
+
+// A centroidal model predictive control problem: a point mass with a single
+// contact with the ground is driven to a desired position, subject to the
+// discretized dynamics and to a limit on the contact force. If
+// `use_friction_cone` is false, friction is limited by a (linear) pyramid,
+// which makes this a quadratic program; otherwise it is limited by the exact
+// (second-order) cone.
+std::unique_ptr<MathematicalProgram> MakeCentroidalMpc(bool use_friction_cone) {
+  constexpr int kNumSteps = 40;
+  const double h = 0.02;
+  const double mass = 10.0;
+  const double mu = 0.6;
+  const Eigen::Vector3d gravity(0, 0, -9.81);
+  const Eigen::Vector3d p0(0, 0, 1);
+  const Eigen::Vector3d p_desired(0.2, -0.1, 1.1);
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto p = prog->NewContinuousVariables(3, kNumSteps + 1, "p");
+  const auto v = prog->NewContinuousVariables(3, kNumSteps + 1, "v");
+  const auto f = prog->NewContinuousVariables(3, kNumSteps, "f");
+  prog->AddBoundingBoxConstraint(p0, p0, p.col(0));
+  prog->AddBoundingBoxConstraint(Eigen::Vector3d::Zero(),
+                                 Eigen::Vector3d::Zero(), v.col(0));
+  for (int k = 0; k < kNumSteps; ++k) {
+    prog->AddLinearEqualityConstraint(p.col(k + 1) - p.col(k) - h * v.col(k),
+                                      Eigen::Vector3d::Zero());
+    prog->AddLinearEqualityConstraint(
+        mass * (v.col(k + 1) - v.col(k)) - h * f.col(k), h * mass * gravity);
+    prog->AddBoundingBoxConstraint(0, 4 * mass * -gravity(2), f(2, k));
+    if (use_friction_cone) {
+      prog->AddLorentzConeConstraint(Vector3<Expression>(
+          mu * f(2, k), f(0, k), f(1, k)));
+    } else {
+      for (int i = 0; i < 2; ++i) {
+        prog->AddLinearConstraint(f(i, k) <= mu * f(2, k));
+        prog->AddLinearConstraint(-f(i, k) <= mu * f(2, k));
+      }
+    }
+    prog->AddQuadraticErrorCost(Eigen::Matrix3d::Identity(), p_desired,
+                                p.col(k + 1));
+    prog->AddQuadraticErrorCost(1e-4 * Eigen::Matrix3d::Identity(),
+                                -mass * gravity, f.col(k));
+  }
+  return prog;
+}
+
+std::unique_ptr<MathematicalProgram> MakeCentroidalMpcQp() {
+  return MakeCentroidalMpc(false);
+}
+
+std::unique_ptr<MathematicalProgram> MakeCentroidalMpcSocp() {
+  return MakeCentroidalMpc(true);
+}
+
+// A sum-of-squares program that searches for a quartic Lyapunov function V(x)
+// certifying the global stability of
+//   ẋ₀ = −x₀ − 2x₁², ẋ₁ = −x₁ + x₀x₁ − 2x₁³,
+// in the style of systems/analysis/region_of_attraction.cc. This is a
+// semidefinite program.
+std::unique_ptr<MathematicalProgram> MakeLyapunovSos() {
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto x = prog->NewIndeterminates<2>("x");
+  const symbolic::Variables x_vars(x);
+  const Vector2<Polynomial> xdot(
+      Polynomial(-x(0) - 2 * x(1) * x(1), x_vars),
+      Polynomial(-x(1) + x(0) * x(1) - 2 * pow(x(1), 3), x_vars));
+  const Polynomial V = prog->NewFreePolynomial(x_vars, 4);
+  const Polynomial Vdot = V.Jacobian(x).dot(xdot);
+  const Polynomial x_squared(x(0) * x(0) + x(1) * x(1), x_vars);
+  prog->AddSosConstraint(V - 0.1 * x_squared);
+  prog->AddSosConstraint(-Vdot - 0.1 * x_squared);
+  // V(0) = 0, and normalize V, which would otherwise be free to scale.
+  prog->AddLinearEqualityConstraint(
+      V.EvaluatePartial({{x(0), 0}, {x(1), 0}}).ToExpression() == 0);
+  prog->AddLinearEqualityConstraint(
+      V.EvaluatePartial({{x(0), 1}, {x(1), 0}}).ToExpression() == 1);
+  return prog;
+}
+
+// The dynamics of a cart-pole, with the pole's angle θ measured from hanging
+// straight down: returns [ẋ, θ̇, ẍ, θ̈] given the state [x, θ, ẋ, θ̇] and the
+// horizontal force u on the cart.
+Vector4<Expression> CartPoleDynamics(const Vector4<Expression>& state,
+                                     const Expression& u) {
+  const double cart_mass = 10.0;
+  const double pole_mass = 1.0;
+  const double pole_length = 0.5;
+  const double g = 9.81;
+  const Expression s = sin(state(1));
+  const Expression c = cos(state(1));
+  const Expression theta_dot = state(3);
+  const Expression denominator = cart_mass + pole_mass * s * s;
+  const Expression x_ddot =
+      (u + pole_mass * s * (pole_length * theta_dot * theta_dot + g * c)) /
+      denominator;
+  const Expression theta_ddot =
+      (-u * c - pole_mass * pole_length * theta_dot * theta_dot * c * s -
+       (cart_mass + pole_mass) * g * s) /
+      (pole_length * denominator);
+  return Vector4<Expression>(state(2), state(3), x_ddot, theta_ddot);
+}
+
+// A trajectory optimization that swings a cart-pole up from hanging down to
+// balancing upright with the least effort. As in the trajectory optimization
+// classes of planning/trajectory_optimization, the trajectory is transcribed
+// into knot points, here with the trapezoidal rule for the collocation
+// constraints. Those constraints involve the cart-pole's dynamics, so this is
+// a nonlinear program.
+std::unique_ptr<MathematicalProgram> MakeCartPoleSwingUp() {
+  constexpr int kNumKnots = 21;
+  const double h = 0.15;
+  const Eigen::Vector4d initial_state(0, 0, 0, 0);
+  const Eigen::Vector4d final_state(0, M_PI, 0, 0);
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto state = prog->NewContinuousVariables(4, kNumKnots, "state");
+  const auto u = prog->NewContinuousVariables(kNumKnots, "u");
+  prog->AddBoundingBoxConstraint(initial_state, initial_state, state.col(0));
+  prog->AddBoundingBoxConstraint(final_state, final_state,
+                                 state.col(kNumKnots - 1));
+  prog->AddBoundingBoxConstraint(-120, 120, u);
+  Vector4<Expression> state_k = state.col(0).cast<Expression>();
+  Vector4<Expression> state_dot_k = CartPoleDynamics(state_k, u(0));
+  for (int k = 0; k + 1 < kNumKnots; ++k) {
+    const Vector4<Expression> state_next = state.col(k + 1).cast<Expression>();
+    const Vector4<Expression> state_dot_next =
+        CartPoleDynamics(state_next, u(k + 1));
+    prog->AddConstraint(
+        state_next - state_k - h / 2 * (state_dot_k + state_dot_next),
+        Eigen::Vector4d::Zero(), Eigen::Vector4d::Zero());
+    state_k = state_next;
+    state_dot_k = state_dot_next;
+  }
+  prog->AddQuadraticCost(h * Eigen::MatrixXd::Identity(kNumKnots, kNumKnots),
+                         Eigen::VectorXd::Zero(kNumKnots), u);
+  // Start from the straight-line interpolation of the boundary states.
+  Eigen::MatrixXd state_guess(4, kNumKnots);
+  for (int k = 0; k < kNumKnots; ++k) {
+    const double ratio = static_cast<double>(k) / (kNumKnots - 1);
+    state_guess.col(k) = (1 - ratio) * initial_state + ratio * final_state;
+  }
+  prog->SetInitialGuess(state, state_guess);
+  prog->SetInitialGuess(u, Eigen::VectorXd::Zero(kNumKnots));
+  return prog;
+}
+
+// Times the construction of the program.
+void BuildProgram(benchmark::State& state,  // NOLINT
+                  ProgramFactory make_program) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(make_program());
+  }
+}
+
+// Returns the time (in seconds) that the backend reported for its own setup and
+// solve, or nullopt if the backend does not report it.
+std::optional<double> GetBackendTime(const MathematicalProgramResult& result) {
+  if (result.get_solver_id() == OsqpSolver::id()) {
+    return result.get_solver_details<OsqpSolver>().run_time;
+  }
+  if (result.get_solver_id() == ScsSolver::id()) {
+    const auto& details = result.get_solver_details<ScsSolver>();
+    return (details.scs_setup_time + details.scs_solve_time) / 1000.0;
+  }
+  return std::nullopt;
+}
+
+// Returns the number of iterations that the backend reported, or nullopt if
+// the backend does not report it.
+std::optional<int> GetBackendIterations(
+    const MathematicalProgramResult& result) {
+  if (result.get_solver_id() == OsqpSolver::id()) {
+    return result.get_solver_details<OsqpSolver>().iter;
+  }
+  if (result.get_solver_id() == ScsSolver::id()) {
+    return result.get_solver_details<ScsSolver>().iter;
+  }
+  return std::nullopt;
+}
+
+// Times the solve of the program by the given backend, including the
+// backend's parsing of the program.
+void SolveProgram(benchmark::State& state,  // NOLINT
+                  ProgramFactory make_program, SolverIdGetter solver_id) {
+  const std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id());
+  if (!solver->available() || !solver->enabled()) {
+    state.SkipWithError(
+        fmt::format("{} is not available", solver_id()).c_str());
+    return;
+  }
+  const std::unique_ptr<MathematicalProgram> prog = make_program();
+  DRAKE_DEMAND(solver->AreProgramAttributesSatisfied(*prog));
+
+  MathematicalProgramResult result;
+  double total_time = 0;
+  double total_backend_time = 0;
+  bool has_backend_time = true;
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    solver->Solve(*prog, std::nullopt, std::nullopt, &result);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (!result.is_success()) {
+      state.SkipWithError(fmt::format("{} failed with {}", solver_id(),
+                                      result.get_solution_result())
+                              .c_str());
+      break;
+    }
+    total_time += elapsed.count();
+    const std::optional<double> backend_time = GetBackendTime(result);
+    has_backend_time = has_backend_time && backend_time.has_value();
+    total_backend_time += backend_time.value_or(0);
+  }
+  if (state.error_occurred()) {
+    return;
+  }
+
+  if (has_backend_time) {
+    state.counters["parse_time"] = benchmark::Counter(
+        total_time - total_backend_time, benchmark::Counter::kAvgIterations);
+    state.counters["solver_time"] = benchmark::Counter(
+        total_backend_time, benchmark::Counter::kAvgIterations);
+  }
+  if (const std::optional<int> iterations = GetBackendIterations(result)) {
+    state.counters["iterations"] = *iterations;
+  }
+}
+
+BENCHMARK_CAPTURE(BuildProgram, Lp, &MakeShortestPathRelaxation)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BuildProgram, Qp, &MakeCentroidalMpcQp)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BuildProgram, Socp, &MakeCentroidalMpcSocp)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BuildProgram, Sdp, &MakeLyapunovSos)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BuildProgram, Nlp, &MakeCartPoleSwingUp)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(SolveProgram, Lp/Clp, &MakeShortestPathRelaxation,
+                  &ClpSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Lp/Scs, &MakeShortestPathRelaxation,
+                  &ScsSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Lp/Csdp, &MakeShortestPathRelaxation,
+                  &CsdpSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Lp/Ipopt, &MakeShortestPathRelaxation,
+                  &IpoptSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(SolveProgram, Qp/Osqp, &MakeCentroidalMpcQp,
+                  &OsqpSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Qp/Clp, &MakeCentroidalMpcQp, &ClpSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Qp/Scs, &MakeCentroidalMpcQp, &ScsSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Qp/Ipopt, &MakeCentroidalMpcQp,
+                  &IpoptSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(SolveProgram, Socp/Scs, &MakeCentroidalMpcSocp,
+                  &ScsSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Socp/Ipopt, &MakeCentroidalMpcSocp,
+                  &IpoptSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(SolveProgram, Sdp/Scs, &MakeLyapunovSos, &ScsSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Sdp/Csdp, &MakeLyapunovSos, &CsdpSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(SolveProgram, Nlp/Ipopt, &MakeCartPoleSwingUp,
+                  &IpoptSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(SolveProgram, Nlp/Nlopt, &MakeCartPoleSwingUp,
+                  &NloptSolver::id)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
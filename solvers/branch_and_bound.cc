@@ -1,11 +1,17 @@
 #include "drake/solvers/branch_and_bound.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/ssize.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -307,26 +313,50 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
 
 void MixedIntegerBranchAndBoundNode::Branch(
     const symbolic::Variable& binary_variable) {
-  left_child_.reset(new MixedIntegerBranchAndBoundNode(
-      *prog_, remaining_binary_variables_, solver_id_));
-  right_child_.reset(new MixedIntegerBranchAndBoundNode(
-      *prog_, remaining_binary_variables_, solver_id_));
-  left_child_->FixBinaryVariable(binary_variable, 0);
-  right_child_->FixBinaryVariable(binary_variable, 1);
-  left_child_->parent_ = this;
-  right_child_->parent_ = this;
-  left_child_->solution_result_ =
-      SolveProgramWithSolver(*left_child_->prog_, left_child_->solver_id_,
-                             left_child_->prog_result_.get());
-  right_child_->solution_result_ =
-      SolveProgramWithSolver(*right_child_->prog_, right_child_->solver_id_,
-                             right_child_->prog_result_.get());
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
-  }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
+  AttachChildren(CreateAndSolveChildren(binary_variable));
+}
+
+std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+          std::unique_ptr<MixedIntegerBranchAndBoundNode>>
+MixedIntegerBranchAndBoundNode::CreateAndSolveChildren(
+    const symbolic::Variable& binary_variable) {
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> left_child(
+      new MixedIntegerBranchAndBoundNode(*prog_, remaining_binary_variables_,
+                                         solver_id_));
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> right_child(
+      new MixedIntegerBranchAndBoundNode(*prog_, remaining_binary_variables_,
+                                         solver_id_));
+  left_child->FixBinaryVariable(binary_variable, 0);
+  right_child->FixBinaryVariable(binary_variable, 1);
+  left_child->parent_ = this;
+  right_child->parent_ = this;
+  // The child programs share the decision variables (in the same order) with
+  // this node, so its optimal solution warm-starts the children.
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    const Eigen::VectorXd& x_val = prog_result_->get_x_val();
+    left_child->prog_->SetInitialGuessForAllVariables(x_val);
+    right_child->prog_->SetInitialGuessForAllVariables(x_val);
+  }
+  for (MixedIntegerBranchAndBoundNode* child :
+       {left_child.get(), right_child.get()}) {
+    child->solution_result_ = SolveProgramWithSolver(
+        *child->prog_, child->solver_id_, child->prog_result_.get());
+    if (child->solution_result_ == SolutionResult::kSolutionFound) {
+      child->CheckOptimalSolutionIsIntegral();
+    }
   }
+  return {std::move(left_child), std::move(right_child)};
+}
+
+void MixedIntegerBranchAndBoundNode::AttachChildren(
+    std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+              std::unique_ptr<MixedIntegerBranchAndBoundNode>>
+        children) {
+  DRAKE_DEMAND(IsLeaf());
+  DRAKE_DEMAND(children.first->parent_ == this);
+  DRAKE_DEMAND(children.second->parent_ == this);
+  left_child_ = std::move(children.first);
+  right_child_ = std::move(children.second);
 }
 
 MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
@@ -376,28 +406,97 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Each branch will create two new nodes. So if the current number of nodes
-    // + 2 is larger than options_.max_explored_nodes, we don't branch
-    // any more.
-    if (options_.max_explored_nodes >= 1 &&
-        root_->NumExploredNodesInSubtree() + 2 > options_.max_explored_nodes) {
-      return SolutionResult::kIterationLimit;
-    } else {
-      // Found a branching node, branch on this node. If no branching node is
-      // found, then every leaf node is fathomed, the branch-and-bound process
-      // should terminate.
-      // TODO(hongkai.dai) We might need to have a function that picks the
-      // branching node together with the branching variable simultaneously.
-      const symbolic::Variable* branching_variable =
-          PickBranchingVariable(*branching_node);
-      BranchAndUpdate(branching_node, *branching_variable);
-      if (HasConverged()) {
-        return SolutionResult::kSolutionFound;
+  const int num_threads =
+      options_.num_threads > 0
+          ? options_.num_threads
+          : static_cast<int>(std::thread::hardware_concurrency());
+  // Each worker repeatedly picks a leaf node that is not being branched by
+  // another worker, and branches on it. The tree, the bounds, the incumbent
+  // solutions and the user callbacks are only accessed while holding `mutex`;
+  // the programs in the child nodes are solved without holding it.
+  std::mutex mutex;
+  std::condition_variable tree_changed;
+  // Set once a worker decides that the search is over.
+  std::optional<SolutionResult> search_result;
+  std::exception_ptr worker_exception;
+  const auto worker = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    try {
+      while (!search_result && !worker_exception) {
+        MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
+        if (branching_node != nullptr &&
+            nodes_being_branched_.count(branching_node) > 0) {
+          // Only a user-defined node selection can pick a node that is being
+          // branched; wait until that branching is done.
+          branching_node = nullptr;
+        } else if (branching_node != nullptr &&
+                   options_.max_explored_nodes >= 1 &&
+                   root_->NumExploredNodesInSubtree() +
+                           2 * (ssize(nodes_being_branched_) + 1) >
+                       options_.max_explored_nodes) {
+          // Each branch will create two new nodes. So if the current number
+          // of nodes, plus the ones being created, plus 2 is larger than
+          // options_.max_explored_nodes, we don't branch any more.
+          if (nodes_being_branched_.empty()) {
+            search_result = SolutionResult::kIterationLimit;
+            break;
+          }
+          branching_node = nullptr;
+        }
+        if (branching_node == nullptr) {
+          // If no branching node is found and no node is being branched, then
+          // every leaf node is fathomed, the branch-and-bound process should
+          // terminate.
+          if (nodes_being_branched_.empty()) {
+            break;
+          }
+          tree_changed.wait(lock);
+          continue;
+        }
+        // TODO(hongkai.dai) We might need to have a function that picks the
+        // branching node together with the branching variable
+        // simultaneously.
+        const symbolic::Variable* branching_variable =
+            PickBranchingVariable(*branching_node);
+        nodes_being_branched_.insert(branching_node);
+        lock.unlock();
+        auto children =
+            branching_node->CreateAndSolveChildren(*branching_variable);
+        lock.lock();
+        nodes_being_branched_.erase(branching_node);
+        branching_node->AttachChildren(std::move(children));
+        UpdateAfterBranching(*branching_node);
+        if (HasConverged()) {
+          search_result = SolutionResult::kSolutionFound;
+        }
+        tree_changed.notify_all();
+      }
+    } catch (...) {
+      if (!lock.owns_lock()) {
+        lock.lock();
+      }
+      if (!worker_exception) {
+        worker_exception = std::current_exception();
       }
-      branching_node = PickBranchingNode();
     }
+    tree_changed.notify_all();
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  // A worker that throws stops the others after they finish branching their
+  // nodes; the exception is rethrown here.
+  nodes_being_branched_.clear();
+  if (worker_exception) {
+    std::rethrow_exception(worker_exception);
+  }
+  if (search_result) {
+    return *search_result;
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -504,20 +603,26 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickBranchingNode()
 }
 
 namespace {
-// Pick the non-fathomed leaf node in the tree with the smallest optimal cost.
+// Pick the non-fathomed leaf node in the tree with the smallest optimal cost,
+// among the ones not in `excluded_nodes`.
 MixedIntegerBranchAndBoundNode* PickMinLowerBoundNodeInSubTree(
     const MixedIntegerBranchAndBound& bnb,
-    const MixedIntegerBranchAndBoundNode& sub_tree_root) {
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    const std::unordered_set<const MixedIntegerBranchAndBoundNode*>&
+        excluded_nodes) {
   if (sub_tree_root.IsLeaf()) {
-    if (bnb.IsLeafNodeFathomed(sub_tree_root)) {
+    if (bnb.IsLeafNodeFathomed(sub_tree_root) ||
+        excluded_nodes.count(&sub_tree_root) > 0) {
       return nullptr;
     }
     return const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root);
   } else {
     MixedIntegerBranchAndBoundNode* left_min_lower_bound_node =
-        PickMinLowerBoundNodeInSubTree(bnb, *(sub_tree_root.left_child()));
+        PickMinLowerBoundNodeInSubTree(bnb, *(sub_tree_root.left_child()),
+                                       excluded_nodes);
     MixedIntegerBranchAndBoundNode* right_min_lower_bound_node =
-        PickMinLowerBoundNodeInSubTree(bnb, *(sub_tree_root.right_child()));
+        PickMinLowerBoundNodeInSubTree(bnb, *(sub_tree_root.right_child()),
+                                       excluded_nodes);
     if (left_min_lower_bound_node && right_min_lower_bound_node) {
       return (left_min_lower_bound_node->prog_result()->get_optimal_cost() <
               right_min_lower_bound_node->prog_result()->get_optimal_cost())
@@ -532,19 +637,26 @@ MixedIntegerBranchAndBoundNode* PickMinLowerBoundNodeInSubTree(
   }
 }
 
+// Pick the non-fathomed leaf node in the tree with the most binary variables
+// fixed, among the ones not in `excluded_nodes`.
 MixedIntegerBranchAndBoundNode* PickDepthFirstNodeInSubTree(
     const MixedIntegerBranchAndBound& bnb,
-    const MixedIntegerBranchAndBoundNode& sub_tree_root) {
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    const std::unordered_set<const MixedIntegerBranchAndBoundNode*>&
+        excluded_nodes) {
   if (sub_tree_root.IsLeaf()) {
-    if (bnb.IsLeafNodeFathomed(sub_tree_root)) {
+    if (bnb.IsLeafNodeFathomed(sub_tree_root) ||
+        excluded_nodes.count(&sub_tree_root) > 0) {
       return nullptr;
     }
     return const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root);
   } else {
     MixedIntegerBranchAndBoundNode* left_deepest_node =
-        PickDepthFirstNodeInSubTree(bnb, *(sub_tree_root.left_child()));
+        PickDepthFirstNodeInSubTree(bnb, *(sub_tree_root.left_child()),
+                                    excluded_nodes);
     MixedIntegerBranchAndBoundNode* right_deepest_node =
-        PickDepthFirstNodeInSubTree(bnb, *(sub_tree_root.right_child()));
+        PickDepthFirstNodeInSubTree(bnb, *(sub_tree_root.right_child()),
+                                    excluded_nodes);
     if (left_deepest_node && right_deepest_node) {
       return left_deepest_node->remaining_binary_variables().size() >
                      right_deepest_node->remaining_binary_variables().size()
@@ -627,13 +739,14 @@ const symbolic::Variable* PickMostOrLeastAmbivalentAsBranchingVariable(
 
 MixedIntegerBranchAndBoundNode*
 MixedIntegerBranchAndBound::PickMinLowerBoundNode() const {
-  return PickMinLowerBoundNodeInSubTree(*this, *root_);
+  return PickMinLowerBoundNodeInSubTree(*this, *root_,
+                                        nodes_being_branched_);
 }
 
 MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
     const {
   // The deepest node has the largest number of fixed binary variables.
-  return PickDepthFirstNodeInSubTree(*this, *root_);
+  return PickDepthFirstNodeInSubTree(*this, *root_, nodes_being_branched_);
 }
 
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
@@ -680,6 +793,11 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
   node->Branch(branching_variable);
+  UpdateAfterBranching(*node);
+}
+
+void MixedIntegerBranchAndBound::UpdateAfterBranching(
+    const MixedIntegerBranchAndBoundNode& node) {
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -687,7 +805,7 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
+  for (auto& child : {node.left_child(), node.right_child()}) {
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
       const double child_node_optimal_cost =
@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "drake/common/name_value.h"
@@ -74,7 +75,8 @@ class MixedIntegerBranchAndBoundNode {
    * Branches on @p binary_variable, and creates two child nodes. In the left
    * child node, the binary variable is fixed to 0. In the right node, the
    * binary variable is fixed to 1. Solves the optimization program in each
-   * child node.
+   * child node, using the optimal solution of this node (if any) as the
+   * initial guess.
    * @param binary_variable This binary variable is fixed to either 0 or 1 in
    * the child node.
    * @pre binary_variable is in remaining_binary_variables_;
@@ -174,6 +176,10 @@ class MixedIntegerBranchAndBoundNode {
   [[nodiscard]] int NumExploredNodesInSubtree() const;
 
  private:
+  // MixedIntegerBranchAndBound branches on several nodes concurrently through
+  // CreateAndSolveChildren() and AttachChildren().
+  friend class MixedIntegerBranchAndBound;
+
   // If the solution to a binary variable is either less than integral_tol or
   // larger than 1 - integral_tol, then we regard the solution to be binary.
   // This method set this tolerance.
@@ -199,6 +205,23 @@ class MixedIntegerBranchAndBoundNode {
   void FixBinaryVariable(const symbolic::Variable& binary_variable,
                          bool binary_value);
 
+  // Creates the two child nodes of Branch() and solves their programs. The
+  // children point to this node as their parent, but are not attached to it
+  // yet, and this node is only read. Hence the tree can be read (and other
+  // leaf nodes branched) while the children are solved.
+  // @throws std::exception if binary_variable is not in
+  // remaining_binary_variables_.
+  std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+            std::unique_ptr<MixedIntegerBranchAndBoundNode>>
+  CreateAndSolveChildren(const symbolic::Variable& binary_variable);
+
+  // Attaches the children created by CreateAndSolveChildren() to this node.
+  // @pre This node is a leaf.
+  void AttachChildren(
+      std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+                std::unique_ptr<MixedIntegerBranchAndBoundNode>>
+          children);
+
   // Check if the optimal solution to the program in this node satisfies all
   // integral constraints.
   // Only call this function AFTER the program is solved.
@@ -289,6 +312,7 @@ class MixedIntegerBranchAndBound {
     template <typename Archive>
     void Serialize(Archive* a) {
       a->Visit(DRAKE_NVP(max_explored_nodes));
+      a->Visit(DRAKE_NVP(num_threads));
     }
 
     /** The maximal number of explored nodes in the tree. The branch and bound
@@ -296,6 +320,20 @@ class MixedIntegerBranchAndBound {
      * max_explored_nodes <= 0 means that we don't put an upper bound on the
      * number of explored nodes. */
     int max_explored_nodes{-1};
+
+    /** The number of worker threads that branch on nodes concurrently. Each
+     * worker picks a leaf node that no other worker is branching on (with the
+     * node selection method), and solves the programs of its two children
+     * with its own solver instances. The tree, the bounds, the incumbent
+     * solutions and the user functions are only accessed by one worker at a
+     * time, but the user functions can be called from any of the worker
+     * threads. With more than one thread, the order in which the nodes are
+     * explored (and hence the number of explored nodes) can differ from run
+     * to run. num_threads <= 0 means that we use all the available hardware
+     * threads.
+     * @note With more than one thread, the solver must support being called
+     * from multiple threads at once on different programs. */
+    int num_threads{1};
   };
 
   /**
@@ -623,6 +661,13 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Updates the best lower and upper bounds after branching on a node, and
+   * calls the user callback on its children.
+   * @param node. The node that was just branched.
+   */
+  void UpdateAfterBranching(const MixedIntegerBranchAndBoundNode& node);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -717,6 +762,11 @@ class MixedIntegerBranchAndBound {
 
   // The user defined callback function in each node. Default is null.
   NodeCallbackFun node_callback_userfun_ = nullptr;
+
+  // The leaf nodes that the workers in Solve() are currently branching on.
+  // They are skipped by the node selection methods.
+  std::unordered_set<const MixedIntegerBranchAndBoundNode*>
+      nodes_being_branched_;
 };
 }  // namespace solvers
 }  // namespace drake
@@ -1,11 +1,15 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
 
+#include "drake/common/ssize.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/eigen_sparse_triplet.h"
 #include "drake/solvers/mathematical_program.h"
@@ -321,6 +325,332 @@ void SetDualSolution(
 }
 }  // namespace
 
+namespace {
+// Records where the coefficients of each binding of a program go in OSQP's
+// data, so that the data of a program whose bindings are unchanged (i.e. the
+// same evaluators bound to the same variables, but possibly with updated
+// coefficients) can be gathered without parsing the program again.
+class ProgramLayout {
+ public:
+  // Makes the layout of `prog`, given the data P and A parsed from it.
+  ProgramLayout(const MathematicalProgram& prog,
+                const Eigen::SparseMatrix<c_float>& P,
+                const Eigen::SparseMatrix<c_float>& A,
+                std::unordered_map<Binding<Constraint>, int>
+                    constraint_start_row)
+      : decision_variables_(prog.decision_variables()),
+        scale_map_(prog.GetVariableScaling()),
+        scale_(prog.num_vars(), 1.0),
+        constraint_start_row_(std::move(constraint_start_row)) {
+    for (const auto& [index, scale] : scale_map_) {
+      scale_[index] = scale;
+    }
+    for (const auto& cost : prog.quadratic_costs()) {
+      QuadraticCostLayout& layout = quadratic_costs_.emplace_back(
+          cost, prog.FindDecisionVariableIndices(cost.variables()));
+      const int n = layout.x_indices.size();
+      for (int col = 0; col < n; ++col) {
+        for (int row = 0; row <= col; ++row) {
+          layout.P_indices.push_back(FindEntry(
+              P, layout.x_indices[row], layout.x_indices[col]));
+        }
+      }
+    }
+    for (const auto& cost : prog.linear_costs()) {
+      linear_costs_.emplace_back(
+          cost, prog.FindDecisionVariableIndices(cost.variables()));
+    }
+    int num_A_rows = 0;
+    auto add_linear_constraint = [&](const auto& constraint) {
+      const Eigen::SparseMatrix<double>& Ai =
+          constraint.evaluator()->get_sparse_A();
+      LinearConstraintLayout& layout =
+          linear_constraints_.emplace_back(constraint, Ai.rows());
+      const std::vector<int> x_indices =
+          prog.FindDecisionVariableIndices(constraint.variables());
+      for (int col = 0; col < Ai.outerSize(); ++col) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(Ai, col); it;
+             ++it) {
+          layout.Ai_entries.emplace_back(it.row(), it.col());
+          layout.A_indices.push_back(
+              FindEntry(A, num_A_rows + it.row(), x_indices[it.col()]));
+          layout.scales.push_back(scale_[x_indices[it.col()]]);
+        }
+      }
+      num_A_rows += layout.num_rows;
+    };
+    for (const auto& constraint : prog.linear_constraints()) {
+      add_linear_constraint(constraint);
+    }
+    for (const auto& constraint : prog.linear_equality_constraints()) {
+      add_linear_constraint(constraint);
+    }
+    for (const auto& constraint : prog.bounding_box_constraints()) {
+      bounding_box_constraints_.push_back(constraint);
+    }
+  }
+
+  // Returns true iff `prog` has the same decision variables, variable
+  // scaling and bindings as the program this layout was made from.
+  bool Matches(const MathematicalProgram& prog) const {
+    if (prog.num_vars() != decision_variables_.size() ||
+        prog.GetVariableScaling() != scale_map_) {
+      return false;
+    }
+    const auto x = prog.decision_variables();
+    for (int i = 0; i < x.size(); ++i) {
+      if (!x(i).equal_to(decision_variables_(i))) return false;
+    }
+    // The linear and linear equality constraints are stored together.
+    const int num_linear_constraints = prog.linear_constraints().size();
+    const int num_linear_equality_constraints =
+        prog.linear_equality_constraints().size();
+    if (num_linear_constraints + num_linear_equality_constraints !=
+        ssize(linear_constraints_)) {
+      return false;
+    }
+    for (int i = 0; i < num_linear_constraints; ++i) {
+      if (!SameBinding(prog.linear_constraints()[i],
+                       linear_constraints_[i].binding)) {
+        return false;
+      }
+    }
+    for (int i = 0; i < num_linear_equality_constraints; ++i) {
+      if (!SameBinding(
+              prog.linear_equality_constraints()[i],
+              linear_constraints_[num_linear_constraints + i].binding)) {
+        return false;
+      }
+    }
+    return SameBindings(prog.quadratic_costs(), quadratic_costs_) &&
+           SameBindings(prog.linear_costs(), linear_costs_) &&
+           SameBindings(prog.bounding_box_constraints(),
+                        bounding_box_constraints_);
+  }
+
+  // Gathers the data of a program that Matches() this layout into q, l, u,
+  // the constant cost term and the values of P and A, which must hold the data
+  // this layout was made with. Only the values of A set by linear constraints
+  // are overwritten. Returns false, leaving the outputs in an unspecified
+  // state, if the updated coefficients don't fit in the sparsity pattern of P
+  // or A.
+  bool GatherData(Eigen::SparseMatrix<c_float>* P, std::vector<c_float>* q,
+                  Eigen::SparseMatrix<c_float>* A, std::vector<c_float>* l,
+                  std::vector<c_float>* u, double* constant_cost_term) const {
+    std::fill(P->valuePtr(), P->valuePtr() + P->nonZeros(), 0.0);
+    std::fill(q->begin(), q->end(), 0.0);
+    *constant_cost_term = 0;
+    for (const QuadraticCostLayout& layout : quadratic_costs_) {
+      const QuadraticCost& cost = *layout.binding.evaluator();
+      const Eigen::MatrixXd& Q = cost.Q();
+      int k = 0;
+      for (int col = 0; col < Q.cols(); ++col) {
+        for (int row = 0; row <= col; ++row, ++k) {
+          const double value = Q(row, col);
+          if (value == 0.0) continue;
+          const int P_index = layout.P_indices[k];
+          if (P_index < 0) return false;
+          P->valuePtr()[P_index] += value * scale_[layout.x_indices[row]] *
+                                    scale_[layout.x_indices[col]];
+        }
+      }
+      for (int i = 0; i < ssize(layout.x_indices); ++i) {
+        (*q)[layout.x_indices[i]] += cost.b()(i);
+      }
+      *constant_cost_term += cost.c();
+    }
+    for (const LinearCostLayout& layout : linear_costs_) {
+      const LinearCost& cost = *layout.binding.evaluator();
+      for (int i = 0; i < ssize(layout.x_indices); ++i) {
+        (*q)[layout.x_indices[i]] += cost.a()(i);
+      }
+      *constant_cost_term += cost.b();
+    }
+    for (int i = 0; i < ssize(scale_); ++i) {
+      (*q)[i] *= scale_[i];
+    }
+
+    l->clear();
+    u->clear();
+    auto append_bounds = [&](const Constraint& constraint) {
+      for (int i = 0; i < constraint.num_constraints(); ++i) {
+        l->push_back(ConvertInfinity(constraint.lower_bound()(i)));
+        u->push_back(ConvertInfinity(constraint.upper_bound()(i)));
+      }
+    };
+    for (const LinearConstraintLayout& layout : linear_constraints_) {
+      const LinearConstraint& constraint = *layout.binding.evaluator();
+      const Eigen::SparseMatrix<double>& Ai = constraint.get_sparse_A();
+      if (Ai.rows() != layout.num_rows) return false;
+      int k = 0;
+      for (int col = 0; col < Ai.outerSize(); ++col) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(Ai, col); it;
+             ++it, ++k) {
+          if (k == ssize(layout.Ai_entries) ||
+              layout.Ai_entries[k].first != it.row() ||
+              layout.Ai_entries[k].second != it.col()) {
+            return false;
+          }
+          // Each entry of A comes from a single constraint.
+          A->valuePtr()[layout.A_indices[k]] = it.value() * layout.scales[k];
+        }
+      }
+      if (k != ssize(layout.Ai_entries)) return false;
+      append_bounds(constraint);
+    }
+    // The entries of A for the bounding box constraints are the variable
+    // scales, which are unchanged.
+    for (const auto& constraint : bounding_box_constraints_) {
+      append_bounds(*constraint.evaluator());
+    }
+    return true;
+  }
+
+  const std::unordered_map<Binding<Constraint>, int>& constraint_start_row()
+      const {
+    return constraint_start_row_;
+  }
+
+ private:
+  struct QuadraticCostLayout {
+    QuadraticCostLayout(const Binding<QuadraticCost>& binding_in,
+                        std::vector<int> x_indices_in)
+        : binding(binding_in), x_indices(std::move(x_indices_in)) {}
+
+    Binding<QuadraticCost> binding;
+    std::vector<int> x_indices;
+    // The index into the values of P of each entry of the upper triangle of
+    // Q, in column major order, or -1 if the entry is not in the sparsity
+    // pattern of P.
+    std::vector<int> P_indices;
+  };
+
+  struct LinearCostLayout {
+    LinearCostLayout(const Binding<LinearCost>& binding_in,
+                     std::vector<int> x_indices_in)
+        : binding(binding_in), x_indices(std::move(x_indices_in)) {}
+
+    Binding<LinearCost> binding;
+    std::vector<int> x_indices;
+  };
+
+  struct LinearConstraintLayout {
+    LinearConstraintLayout(const Binding<LinearConstraint>& binding_in,
+                           int num_rows_in)
+        : binding(binding_in), num_rows(num_rows_in) {}
+
+    Binding<LinearConstraint> binding;
+    int num_rows{};
+    // The (row, column) of each nonzero of the constraint's sparse A, in
+    // storage order, with its index into the values of OSQP's A and the scale
+    // of its variable.
+    std::vector<std::pair<int, int>> Ai_entries;
+    std::vector<int> A_indices;
+    std::vector<double> scales;
+  };
+
+  template <typename C1, typename C2>
+  static bool SameBinding(const Binding<C1>& a, const Binding<C2>& b) {
+    if (a.evaluator().get() != b.evaluator().get() ||
+        a.variables().size() != b.variables().size()) {
+      return false;
+    }
+    for (int i = 0; i < a.variables().size(); ++i) {
+      if (!a.variables()(i).equal_to(b.variables()(i))) return false;
+    }
+    return true;
+  }
+
+  template <typename C, typename Layout>
+  static bool SameBindings(const std::vector<Binding<C>>& bindings,
+                           const std::vector<Layout>& layouts) {
+    if (bindings.size() != layouts.size()) return false;
+    for (int i = 0; i < ssize(bindings); ++i) {
+      if constexpr (std::is_same_v<Layout, Binding<C>>) {
+        if (!SameBinding(bindings[i], layouts[i])) return false;
+      } else {
+        if (!SameBinding(bindings[i], layouts[i].binding)) return false;
+      }
+    }
+    return true;
+  }
+
+  // Returns the index into the values of `M` of its entry (row, col), or -1
+  // if that entry is not in the sparsity pattern of M.
+  static int FindEntry(const Eigen::SparseMatrix<c_float>& M, int row,
+                       int col) {
+    const int* begin = M.innerIndexPtr() + M.outerIndexPtr()[col];
+    const int* end = M.innerIndexPtr() + M.outerIndexPtr()[col + 1];
+    const int* it = std::lower_bound(begin, end, row);
+    return (it != end && *it == row) ? it - M.innerIndexPtr() : -1;
+  }
+
+  VectorX<symbolic::Variable> decision_variables_;
+  std::unordered_map<int, double> scale_map_;
+  std::vector<double> scale_;
+  std::vector<QuadraticCostLayout> quadratic_costs_;
+  std::vector<LinearCostLayout> linear_costs_;
+  // The linear constraints followed by the linear equality constraints, in
+  // the order their rows are stacked in A.
+  std::vector<LinearConstraintLayout> linear_constraints_;
+  std::vector<Binding<BoundingBoxConstraint>> bounding_box_constraints_;
+  std::unordered_map<Binding<Constraint>, int> constraint_start_row_;
+};
+
+// Updates the coefficients of an OSQP workspace set up with matrices that have
+// the same sparsity patterns as P and A. Returns true on success.
+bool UpdateWorkspace(OSQPWorkspace* work, const Eigen::SparseMatrix<c_float>& P,
+                     const std::vector<c_float>& q,
+                     const Eigen::SparseMatrix<c_float>& A,
+                     const std::vector<c_float>& l,
+                     const std::vector<c_float>& u) {
+  return osqp_update_P_A(work, P.valuePtr(), OSQP_NULL, P.nonZeros(),
+                         A.valuePtr(), OSQP_NULL, A.nonZeros()) == 0 &&
+         osqp_update_lin_cost(work, q.data()) == 0 &&
+         osqp_update_bounds(work, l.data(), u.data()) == 0;
+}
+}  // namespace
+
+struct OsqpSolver::Workspace {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  Workspace(OSQPWorkspace* work_in, const Eigen::SparseMatrix<c_float>& P_in,
+            const Eigen::SparseMatrix<c_float>& A_in,
+            const SolverOptions& options_in)
+      : work(work_in), P(P_in), A(A_in), options(options_in) {}
+
+  ~Workspace() { osqp_cleanup(work); }
+
+  // Returns true iff a program with the given data can be solved by updating
+  // the coefficients of this workspace in place.
+  bool Matches(const Eigen::SparseMatrix<c_float>& P_new,
+               const Eigen::SparseMatrix<c_float>& A_new,
+               const SolverOptions& options_new) const {
+    return HasSameSparsity(P, P_new) && HasSameSparsity(A, A_new) &&
+           options == options_new;
+  }
+
+  static bool HasSameSparsity(const Eigen::SparseMatrix<c_float>& a,
+                              const Eigen::SparseMatrix<c_float>& b) {
+    DRAKE_ASSERT(a.isCompressed() && b.isCompressed());
+    return a.rows() == b.rows() && a.cols() == b.cols() &&
+           a.nonZeros() == b.nonZeros() &&
+           std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.cols() + 1,
+                      b.outerIndexPtr()) &&
+           std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                      b.innerIndexPtr());
+  }
+
+  OSQPWorkspace* const work;
+  // The matrices used to set up (or most recently update) the workspace. Their
+  // values are overwritten when the data is gathered through `layout`.
+  Eigen::SparseMatrix<c_float> P;
+  Eigen::SparseMatrix<c_float> A;
+  const SolverOptions options;
+  // The layout of the program the workspace was set up for, if any.
+  std::optional<ProgramLayout> layout;
+};
+
 bool OsqpSolver::is_available() {
   return true;
 }
@@ -337,54 +667,122 @@ void OsqpSolver::DoSolve(const MathematicalProgram& prog,
   // s.t l ≤ Ax ≤ u
   // OSQP is written in C, so this function will be in C style.
 
-  // Get the cost for the QP.
-  Eigen::SparseMatrix<c_float> P_sparse;
-  std::vector<c_float> q(prog.num_vars(), 0);
-  double constant_cost_term{0};
-
-  ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
-  ParseLinearCosts(prog, &q, &constant_cost_term);
-
-  // linear_constraint_start_row[binding] stores the starting row index in A
-  // corresponding to the linear constraint `binding`.
-  std::unordered_map<Binding<Constraint>, int> constraint_start_row;
-
-  // Parse the linear constraints.
-  Eigen::SparseMatrix<c_float> A_sparse;
-  std::vector<c_float> l, u;
-  ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
-
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
-  // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
-
-  SetOsqpSolverSettings(merged_options, settings);
-
   // If any step fails, it will set the solution_result and skip other steps.
   std::optional<SolutionResult> solution_result;
 
-  // Setup workspace.
   OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
-    const c_int osqp_setup_err = osqp_setup(&work, data, settings);
-    if (osqp_setup_err != 0) {
+  // Owns `work` when the workspace is cached across solves.
+  std::shared_ptr<Workspace> workspace;
+  double constant_cost_term{0};
+  std::vector<c_float> q(prog.num_vars(), 0);
+  std::vector<c_float> l, u;
+  // constraint_start_row[binding] stores the starting row index in A
+  // corresponding to the linear constraint `binding`.
+  const std::unordered_map<Binding<Constraint>, int>* constraint_start_row{};
+  std::unordered_map<Binding<Constraint>, int> uncached_constraint_start_row;
+
+  solver_details.workspace_reused = false;
+  solver_details.program_parse_reused = false;
+  // If the program's bindings are unchanged since the cached workspace was set
+  // up, gather its data straight into the workspace's matrices.
+  if (reuse_workspace_ && workspace_ != nullptr &&
+      workspace_->options == merged_options && workspace_->layout &&
+      workspace_->layout->Matches(prog) &&
+      workspace_->layout->GatherData(&workspace_->P, &q, &workspace_->A, &l,
+                                     &u, &constant_cost_term)) {
+    workspace = workspace_;
+    work = workspace->work;
+    constraint_start_row = &workspace->layout->constraint_start_row();
+    if (UpdateWorkspace(work, workspace->P, q, workspace->A, l, u)) {
+      solver_details.workspace_reused = true;
+      solver_details.program_parse_reused = true;
+    } else {
       solution_result = SolutionResult::kInvalidInput;
+      workspace_.reset();
+    }
+  } else {
+    // Get the cost for the QP.
+    Eigen::SparseMatrix<c_float> P_sparse;
+    std::fill(q.begin(), q.end(), 0.0);
+    constant_cost_term = 0;
+    ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
+    ParseLinearCosts(prog, &q, &constant_cost_term);
+
+    // Parse the linear constraints.
+    std::unordered_map<Binding<Constraint>, int> parsed_constraint_start_row;
+    Eigen::SparseMatrix<c_float> A_sparse;
+    ParseAllLinearConstraints(prog, &A_sparse, &l, &u,
+                              &parsed_constraint_start_row);
+
+    if (reuse_workspace_ && workspace_ != nullptr &&
+        workspace_->Matches(P_sparse, A_sparse, merged_options)) {
+      // Only the coefficients changed; update the cached workspace in place.
+      workspace = workspace_;
+      work = workspace->work;
+      if (UpdateWorkspace(work, P_sparse, q, A_sparse, l, u)) {
+        solver_details.workspace_reused = true;
+      } else {
+        solution_result = SolutionResult::kInvalidInput;
+        workspace_.reset();
+      }
+    } else {
+      // Now pass the constraint and cost to osqp data.
+      OSQPData* data = nullptr;
+
+      // Populate data.
+      data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+
+      data->n = prog.num_vars();
+      data->m = A_sparse.rows();
+      data->P = EigenSparseToCSC(P_sparse);
+      data->q = q.data();
+      data->A = EigenSparseToCSC(A_sparse);
+      data->l = l.data();
+      data->u = u.data();
+
+      // Define Solver settings as default.
+      // Problem settings
+      OSQPSettings* settings =
+          static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+      osqp_set_default_settings(settings);
+
+      SetOsqpSolverSettings(merged_options, settings);
+
+      // Setup workspace. Note that osqp_setup() copies the data and settings
+      // into the workspace, so we can release ours right away.
+      const c_int osqp_setup_err = osqp_setup(&work, data, settings);
+      if (osqp_setup_err != 0) {
+        solution_result = SolutionResult::kInvalidInput;
+      }
+      c_free(data->P->x);
+      c_free(data->P->i);
+      c_free(data->P->p);
+      c_free(data->P);
+      c_free(data->A->x);
+      c_free(data->A->i);
+      c_free(data->A->p);
+      c_free(data->A);
+      c_free(data);
+      c_free(settings);
+
+      workspace = std::make_shared<Workspace>(work, P_sparse, A_sparse,
+                                              merged_options);
+      if (reuse_workspace_) {
+        workspace_ = solution_result ? nullptr : workspace;
+      }
+    }
+
+    // Record the program's layout so that the next solve can skip parsing it
+    // if its bindings don't change.
+    if (reuse_workspace_ && workspace_ != nullptr && !solution_result) {
+      workspace_->P = std::move(P_sparse);
+      workspace_->A = std::move(A_sparse);
+      workspace_->layout.emplace(prog, workspace_->P, workspace_->A,
+                                 std::move(parsed_constraint_start_row));
+      constraint_start_row = &workspace_->layout->constraint_start_row();
+    } else {
+      uncached_constraint_start_row = std::move(parsed_constraint_start_row);
+      constraint_start_row = &uncached_constraint_start_row;
     }
   }
 
@@ -441,11 +839,11 @@ void OsqpSolver::DoSolve(const MathematicalProgram& prog,
             Eigen::Map<Eigen::VectorXd>(work->solution->y, work->data->m);
         solution_result = SolutionResult::kSolutionFound;
         SetDualSolution(prog.linear_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        *constraint_start_row, result);
         SetDualSolution(prog.linear_equality_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        *constraint_start_row, result);
         SetDualSolution(prog.bounding_box_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        *constraint_start_row, result);
 
         break;
       }
@@ -471,19 +869,8 @@ void OsqpSolver::DoSolve(const MathematicalProgram& prog,
     }
   }
   result->set_solution_result(solution_result.value());
-
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  // N.B. Unless it is cached, the workspace is cleaned up when `workspace`
+  // goes out of scope.
 }
 
 }  // namespace solvers
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -35,6 +36,17 @@ struct OsqpSolverDetails {
   /// the problem. Notice that the order of the linear constraints are linear
   /// inequality first, and then linear equality constraints.
   Eigen::VectorXd y{};
+  /// Whether the solve updated the cached OSQP workspace from a previous
+  /// solve in place, instead of setting up a new workspace. See
+  /// OsqpSolver::set_reuse_workspace().
+  bool workspace_reused{false};
+  /// Whether the solve gathered the program's data through the bookkeeping
+  /// recorded when the cached OSQP workspace was set up, instead of parsing
+  /// the program. This happens when the program's bindings (the evaluators
+  /// and the variables they are bound to) are the same as then, even if their
+  /// coefficients were updated. Implies `workspace_reused`. See
+  /// OsqpSolver::set_reuse_workspace().
+  bool program_parse_reused{false};
 };
 
 class OsqpSolver final : public SolverBase {
@@ -59,9 +71,51 @@ class OsqpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// @name Parametric programs
+  /// By default, every call to Solve() parses the program into OSQP's sparse
+  /// matrices, sets up a new OSQP workspace (which allocates memory, scales the
+  /// problem data, and factorizes the KKT matrix from scratch), and then
+  /// discards the workspace.  Controllers that repeatedly solve a program
+  /// whose structure is fixed, and only whose coefficients change, pay for that
+  /// setup at every solve.
+  ///
+  /// When workspace reuse is enabled, this solver keeps the OSQP workspace
+  /// from the most recent successful setup.  If the next program has the same
+  /// number of decision variables, the same sparsity pattern of the (upper
+  /// triangular) Hessian P and the constraint matrix A, and the same solver
+  /// options, the cached workspace is updated in place through OSQP's
+  /// `osqp_update_P_A`, `osqp_update_lin_cost` and `osqp_update_bounds`,
+  /// and is warm-started from the previous primal and dual solution
+  /// (subject to the "warm_start" option).  Otherwise a new workspace is set
+  /// up and cached in place of the old one.  Note that a cost or constraint
+  /// coefficient that becomes exactly zero changes the sparsity pattern.
+  ///
+  /// When the cached workspace is set up, this solver also records where each
+  /// cost and constraint of the program lands in OSQP's data.  If the next
+  /// program has the same bindings (the same evaluators, bound to the same
+  /// variables) and only their coefficients changed, the data is gathered
+  /// straight into the cached matrices and the program is not parsed again.
+  ///
+  /// @warning With workspace reuse enabled, this solver object must not be
+  /// used to solve programs concurrently from multiple threads.
+  //@{
+  /// Enables or disables workspace reuse. Disabling it releases any cached
+  /// workspace.
+  void set_reuse_workspace(bool reuse_workspace);
+
+  /// Returns whether workspace reuse is enabled.
+  bool reuse_workspace() const { return reuse_workspace_; }
+  //@}
+
  private:
+  // The cached OSQP workspace; defined in osqp_solver.cc.
+  struct Workspace;
+
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  bool reuse_workspace_{false};
+  mutable std::shared_ptr<Workspace> workspace_;
 };
 }  // namespace solvers
 }  // namespace drake
@@ -18,6 +18,13 @@ OsqpSolver::OsqpSolver()
 
 OsqpSolver::~OsqpSolver() = default;
 
+void OsqpSolver::set_reuse_workspace(bool reuse_workspace) {
+  reuse_workspace_ = reuse_workspace;
+  if (!reuse_workspace_) {
+    workspace_.reset();
+  }
+}
+
 SolverId OsqpSolver::id() {
   static const never_destroyed<SolverId> singleton{"OSQP"};
   return singleton.access();
@@ -350,6 +350,32 @@ GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch1) {
   EXPECT_THROW(root->Branch(x(3)), std::runtime_error);
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranchWarmStart) {
+  auto prog = ConstructMathematicalProgram1();
+
+  std::unique_ptr<MixedIntegerBranchAndBoundNode> root;
+  std::tie(root, std::ignore) =
+      MixedIntegerBranchAndBoundNode::ConstructRootNode(*prog,
+                                                        GurobiSolver::id());
+  VectorDecisionVariable<4> x = root->prog()->decision_variables();
+
+  root->Branch(x(0));
+  EXPECT_EQ(root->NumExploredNodesInSubtree(), 3);
+  const Eigen::Vector4d x_expected_l0(0, 1, 0, 0.5);
+  const Eigen::Vector4d x_expected_r0(1, 1, 0, 0);
+  const double tol{1E-5};
+  CheckNodeSolution(*(root->left_child()), x, x_expected_l0, 1.5, tol);
+  CheckNodeSolution(*(root->right_child()), x, x_expected_r0, 4, tol);
+  EXPECT_TRUE(root->left_child()->optimal_solution_is_integral());
+  EXPECT_TRUE(root->right_child()->optimal_solution_is_integral());
+
+  // Both children are warm-started from the solution of the root.
+  const Eigen::VectorXd& root_x_val = root->prog_result()->get_x_val();
+  for (const auto* child : {root->left_child(), root->right_child()}) {
+    EXPECT_TRUE(CompareMatrices(child->prog()->initial_guess(), root_x_val));
+  }
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundNodeTest, TestBranch2) {
   // Test branching on the root node for prog 2.
   auto prog = ConstructMathematicalProgram2();
@@ -1358,6 +1384,55 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, MaxNodesInTree) {
   EXPECT_FALSE(dut2.HasConverged());
   EXPECT_EQ(dut2_solution_result, SolutionResult::kIterationLimit);
 }
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, SolveWithMultipleThreads) {
+  // The optimal solution should not depend on the number of worker threads,
+  // although the nodes might be explored in a different order.
+  for (const auto node_selection_method :
+       {MixedIntegerBranchAndBound::NodeSelectionMethod::kMinLowerBound,
+        MixedIntegerBranchAndBound::NodeSelectionMethod::kDepthFirst}) {
+    auto prog = ConstructMathematicalProgram2();
+    const VectorXDecisionVariable x = prog->decision_variables();
+    MixedIntegerBranchAndBound dut1(*prog, GurobiSolver::id());
+    dut1.SetNodeSelectionMethod(node_selection_method);
+    EXPECT_EQ(dut1.Solve(), SolutionResult::kSolutionFound);
+
+    MixedIntegerBranchAndBound::Options options{};
+    options.num_threads = 4;
+    MixedIntegerBranchAndBound dut2(*prog, GurobiSolver::id(), options);
+    dut2.SetNodeSelectionMethod(node_selection_method);
+    int num_callbacks = 0;
+    dut2.SetUserDefinedNodeCallbackFunction(
+        [&num_callbacks](const MixedIntegerBranchAndBoundNode&,
+                         MixedIntegerBranchAndBound*) {
+          ++num_callbacks;
+        });
+    EXPECT_EQ(dut2.Solve(), SolutionResult::kSolutionFound);
+
+    const double tol{1E-6};
+    EXPECT_NEAR(dut2.GetOptimalCost(), dut1.GetOptimalCost(), tol);
+    EXPECT_TRUE(
+        CompareMatrices(dut2.GetSolution(x), dut1.GetSolution(x), tol));
+    // The callback is called once on every explored node.
+    EXPECT_EQ(num_callbacks, dut2.root()->NumExploredNodesInSubtree());
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, MaxNodesWithMultipleThreads) {
+  // The limit on the number of explored nodes also counts the nodes that the
+  // other workers are creating.
+  auto prog = ConstructMathematicalProgram2();
+  MixedIntegerBranchAndBound dut1(*prog, GurobiSolver::id());
+  dut1.Solve();
+  ASSERT_GT(dut1.root()->NumExploredNodesInSubtree(), 3);
+
+  MixedIntegerBranchAndBound::Options options{};
+  options.max_explored_nodes = 3;
+  options.num_threads = 4;
+  MixedIntegerBranchAndBound dut2(*prog, GurobiSolver::id(), options);
+  EXPECT_EQ(dut2.Solve(), SolutionResult::kIterationLimit);
+  EXPECT_EQ(dut2.root()->NumExploredNodesInSubtree(), 3);
+}
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
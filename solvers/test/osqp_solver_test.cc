@@ -220,6 +220,80 @@ GTEST_TEST(OsqpSolverTest, WarmStartPrimalOnly) {
   }
 }
 
+GTEST_TEST(OsqpSolverTest, ReuseWorkspace) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto cost = prog.AddQuadraticCost(2 * Eigen::Matrix2d::Identity(),
+                                    Eigen::Vector2d(-2, 0), x);
+  auto constraint = prog.AddLinearConstraint(
+      Eigen::RowVector2d(1, 1), 2, std::numeric_limits<double>::infinity(), x);
+
+  OsqpSolver solver;
+  EXPECT_FALSE(solver.reuse_workspace());
+  solver.set_reuse_workspace(true);
+  EXPECT_TRUE(solver.reuse_workspace());
+  if (solver.available()) {
+    const double tol = 1E-6;
+    // Solves `prog` (or `other_prog`, if given) and checks the solution and
+    // whether the cached workspace and the parse of the program were reused.
+    auto solve = [&](const Eigen::Vector2d& x_expected, bool reused,
+                     bool parse_reused, const SolverOptions& options = {},
+                     const MathematicalProgram* other_prog = nullptr) {
+      const MathematicalProgramResult result = solver.Solve(
+          other_prog ? *other_prog : prog, std::nullopt, options);
+      EXPECT_TRUE(result.is_success());
+      EXPECT_TRUE(CompareMatrices(result.get_x_val(), x_expected, tol));
+      const OsqpSolverDetails& details =
+          result.get_solver_details<OsqpSolver>();
+      EXPECT_EQ(details.workspace_reused, reused);
+      EXPECT_EQ(details.program_parse_reused, parse_reused);
+    };
+
+    // The first solve sets up the workspace.
+    solve(Eigen::Vector2d(1.5, 0.5), false, false);
+
+    // Changing only the coefficients updates the cached workspace, without
+    // parsing the program again.
+    cost.evaluator()->UpdateCoefficients(2 * Eigen::Matrix2d::Identity(),
+                                         Eigen::Vector2d(0, -2));
+    solve(Eigen::Vector2d(0.5, 1.5), true, true);
+    constraint.evaluator()->UpdateLowerBound(Vector1d(4));
+    solve(Eigen::Vector2d(1.5, 2.5), true, true);
+
+    // Changing the sparsity of the Hessian requires a new workspace, which is
+    // then reused.
+    Eigen::Matrix2d Q;
+    Q << 2, 1, 1, 2;
+    cost.evaluator()->UpdateCoefficients(Q, Eigen::Vector2d(0, -2));
+    solve(Eigen::Vector2d(1, 3), false, false);
+    cost.evaluator()->UpdateCoefficients(Q, Eigen::Vector2d(-2, 0));
+    solve(Eigen::Vector2d(3, 1), true, true);
+
+    // Changing the solver options requires a new workspace.
+    SolverOptions options;
+    options.SetOption(OsqpSolver::id(), "max_iter", 5000);
+    solve(Eigen::Vector2d(3, 1), false, false, options);
+    solve(Eigen::Vector2d(3, 1), true, true, options);
+
+    // A different program with the same sparsity pattern must be parsed, but
+    // it reuses the workspace.
+    MathematicalProgram other_prog;
+    auto y = other_prog.NewContinuousVariables<2>();
+    other_prog.AddQuadraticCost(Q, Eigen::Vector2d(0, -2), y);
+    other_prog.AddLinearConstraint(Eigen::RowVector2d(1, 1), 4,
+                                   std::numeric_limits<double>::infinity(), y);
+    solve(Eigen::Vector2d(1, 3), true, false, options, &other_prog);
+    // Once parsed, the bindings of the other program are the ones recorded.
+    solve(Eigen::Vector2d(1, 3), true, true, options, &other_prog);
+    solve(Eigen::Vector2d(3, 1), true, false, options);
+
+    // Disabling reuse releases the workspace.
+    solver.set_reuse_workspace(false);
+    solve(Eigen::Vector2d(3, 1), false, false, options);
+    solve(Eigen::Vector2d(3, 1), false, false, options);
+  }
+}
+
 /* Tests the solver's processing of the verbosity options. With multiple ways
  to request verbosity (common options and solver-specific options), we simply
  apply a smoke test that none of the means causes runtime errors. Note, we
@@ -2,18 +2,15 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
-#include "drake/planning/trajectory_optimization/direct_transcription.h"
-#include "drake/solvers/solve.h"
+#include "drake/systems/controllers/linear_quadratic_regulator.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
-using planning::trajectory_optimization::DirectTranscription;
-using solvers::VectorXDecisionVariable;
-
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
     std::unique_ptr<systems::System<double>> model,
@@ -66,51 +63,37 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+
+    // The QP over the horizon has a running cost on the samples 0…N-2 and no
+    // cost on the final state, so the problem is the finite-horizon LQR with
+    // N-1 steps and a zero final cost.  (The cost scaling by time_period_ is
+    // common to Q and R, hence does not affect the optimal gains.)
+    const int num_time_samples =
+        static_cast<int>(time_horizon_ / time_period_ + 0.5);
+    DRAKE_DEMAND(num_time_samples > 1);
+    const std::vector<LinearQuadraticRegulatorResult> lqr_result =
+        DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+            linear_model_->A(), linear_model_->B(), Q_, R_,
+            Eigen::MatrixXd::Zero(num_states_, num_states_),
+            num_time_samples - 1);
+    K_ = lqr_result.front().K;
   }
 }
 
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
-  const VectorX<T>& current_state = get_state_port().Eval(context);
-
-  const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
-
-  const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
-
-  control->SetFromVector(current_input + input_ref);
-
-  // TODO(jadecastro) Implement the time-varying case.
-}
-
-template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
   DRAKE_DEMAND(linear_model_ != nullptr);
 
-  const int kNumSampleTimes =
-      static_cast<int>(time_horizon_ / time_period_ + 0.5);
-
-  DirectTranscription dirtran(linear_model_.get(), *base_context_,
-                              kNumSampleTimes);
-  auto& prog = dirtran.prog();
-
-  const auto state_error = dirtran.state();
-  const auto input_error = dirtran.input();
-
-  dirtran.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                         input_error.transpose() * R_ * input_error);
+  const VectorX<T>& current_state = get_state_port().Eval(context);
 
   const VectorX<T> state_ref =
-      base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(dirtran.initial_state() ==
-                           current_state - state_ref);
+      base_context_->get_discrete_state().get_vector().CopyToVector();
+  const VectorX<T> input_ref = model_->get_input_port(0).Eval(*base_context_);
 
-  const auto result = Solve(prog);
-  DRAKE_DEMAND(result.is_success());
+  control->SetFromVector(input_ref - K_ * (current_state - state_ref));
 
-  return dirtran.GetInputSamples(result).col(0);
+  // TODO(jadecastro) Implement the time-varying case.
 }
 
 template class LinearModelPredictiveController<double>;
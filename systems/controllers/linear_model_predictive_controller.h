@@ -23,9 +23,12 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.  Since the present formulation
+/// has no inequality constraints and the linearization is time-invariant, the
+/// optimal u(k) is a fixed linear function of x(k) - xd; the feedback gain is
+/// computed once at construction by a backward Riccati recursion (see
+/// DiscreteTimeFiniteHorizonLinearQuadraticRegulator()), whose cost is linear
+/// in the horizon length N, rather than by solving the QP at every time step.
 ///
 /// @system
 /// name: LinearModelPredictiveController
@@ -84,11 +87,6 @@ class LinearModelPredictiveController : public LeafSystem<T> {
  private:
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
-
   const int state_input_index_{-1};
   const int control_output_index_{-1};
 
@@ -107,6 +105,10 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Description of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The optimal feedback gain for the first step of the horizon, such that
+  // u(k) - ud = -K (x(k) - xd).
+  Eigen::MatrixXd K_;
 };
 
 }  // namespace controllers
@@ -138,6 +138,45 @@ LinearQuadraticRegulatorResult DiscreteTimeLinearQuadraticRegulator(
   return ret;
 }
 
+std::vector<LinearQuadraticRegulatorResult>
+DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& Qf, int num_steps) {
+  Eigen::Index n = A.rows(), m = B.cols();
+  DRAKE_DEMAND(n > 0 && m > 0);
+  DRAKE_DEMAND(B.rows() == n && A.cols() == n);
+  DRAKE_DEMAND(Q.rows() == n && Q.cols() == n);
+  DRAKE_DEMAND(R.rows() == m && R.cols() == m);
+  DRAKE_DEMAND(Qf.rows() == n && Qf.cols() == n);
+  DRAKE_DEMAND(num_steps > 0);
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success)
+    throw std::runtime_error("R must be positive definite");
+
+  std::vector<LinearQuadraticRegulatorResult> ret(num_steps);
+
+  // Backward recursion from the final cost, S[N] = Qf:
+  //   K[n] = (R + BᵀS[n+1]B)⁻¹BᵀS[n+1]A
+  //   S[n] = Q + AᵀS[n+1](A − BK[n])
+  Eigen::MatrixXd S = Qf;
+  for (int i = num_steps - 1; i >= 0; --i) {
+    const Eigen::MatrixXd SB = S * B;
+    const Eigen::MatrixXd tmp = B.transpose() * SB + R;
+    ret[i].K = tmp.llt().solve(SB.transpose() * A);
+    S = Q + A.transpose() * (S * A - SB * ret[i].K);
+    // Guard against the accumulation of asymmetric round-off error.
+    S = 0.5 * (S + S.transpose()).eval();
+    ret[i].S = S;
+  }
+
+  return ret;
+}
+
 std::unique_ptr<systems::LinearSystem<double>> LinearQuadraticRegulator(
     const LinearSystem<double>& system,
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
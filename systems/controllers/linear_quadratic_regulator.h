@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "drake/systems/primitives/linear_system.h"
 
@@ -75,6 +76,39 @@ LinearQuadraticRegulatorResult DiscreteTimeLinearQuadraticRegulator(
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::Ref<const Eigen::MatrixXd>& R);
 
+/// Computes the optimal time-varying feedback controller, u[n]=-K[n]x[n], and
+/// the optimal cost-to-go J[n] = x[n]'S[n]x[n] for the finite-horizon problem:
+///
+///   @f[ x[n+1] = Ax[n] + Bu[n] @f]
+///   @f[ \min_u x[N]'Q_fx[N] + \sum_{n=0}^{N-1} x[n]'Qx[n] + u[n]'Ru[n] @f]
+///
+/// using the backward Riccati recursion.  The cost of the recursion is linear
+/// in the horizon length N, whereas handing the equivalent (block-banded)
+/// quadratic program to a general-purpose solver does not exploit its
+/// stage-wise structure.
+///
+/// @param A The state-space dynamics matrix of size num_states x num_states.
+/// @param B The state-space input matrix of size num_states x num_inputs.
+/// @param Q A symmetric positive semi-definite cost matrix of size num_states x
+/// num_states.
+/// @param R A symmetric positive definite cost matrix of size num_inputs x
+/// num_inputs.
+/// @param Qf A symmetric positive semi-definite final cost matrix of size
+/// num_states x num_states.
+/// @param num_steps The horizon length N; must be positive.
+/// @returns A vector of size `num_steps` whose n'th element contains the
+/// optimal feedback gain K[n] and the quadratic cost-to-go term S[n] at step n.
+///
+/// @throws std::exception if R is not positive definite.
+/// @ingroup control
+std::vector<LinearQuadraticRegulatorResult>
+DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& Qf, int num_steps);
+
 /// Creates a system that implements the optimal time-invariant linear quadratic
 /// regulator (LQR).  If @p system is a continuous-time system, then solves
 /// the continuous-time LQR problem:
@@ -0,0 +1,249 @@
+#include "drake/systems/controllers/nonlinear_model_predictive_controller.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "drake/common/timer.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+struct NonlinearModelPredictiveController::Iterate {
+  // The guess of the state (num_states x N) and input (num_inputs x N-1)
+  // trajectories.
+  Eigen::MatrixXd x;
+  Eigen::MatrixXd u;
+  // The linearization of the dynamics about the guess, such that
+  //   x[i+1] + δx[i+1] ≈ x[i+1] + A[i]δx[i] + B[i]δu[i] + d[i],
+  // where d[i] = f(x[i], u[i]) - x[i+1] is the dynamics defect of the guess.
+  std::vector<Eigen::MatrixXd> A;
+  std::vector<Eigen::MatrixXd> B;
+  Eigen::MatrixXd d;
+  // The optimal affine feedback law for the linear-quadratic subproblem,
+  //   δu[i] = -K[i]δx[i] - k[i].
+  std::vector<Eigen::MatrixXd> K;
+  Eigen::MatrixXd k;
+};
+
+NonlinearModelPredictiveController::NonlinearModelPredictiveController(
+    std::unique_ptr<System<double>> model,
+    std::unique_ptr<Context<double>> base_context, const Eigen::MatrixXd& Q,
+    const Eigen::MatrixXd& R, double time_period, double time_horizon,
+    int num_iterations_per_update)
+    : model_(std::move(model)),
+      base_context_(std::move(base_context)),
+      num_states_(model_->CreateDefaultContext()->get_discrete_state(0).size()),
+      num_inputs_(model_->get_input_port(0).size()),
+      Q_(Q),
+      R_(R),
+      time_period_(time_period),
+      num_time_samples_(static_cast<int>(time_horizon / time_period + 0.5)),
+      num_iterations_per_update_(num_iterations_per_update) {
+  DRAKE_DEMAND(time_period_ > 0.);
+  DRAKE_DEMAND(time_horizon > 0.);
+  DRAKE_DEMAND(num_time_samples_ > 1);
+  DRAKE_DEMAND(num_iterations_per_update_ > 0);
+  DRAKE_DEMAND(base_context_ != nullptr);
+
+  // Check that the model has a single input and discrete states belonging to
+  // a single group that are updated periodically.
+  double model_time_period{};
+  DRAKE_DEMAND(model_->IsDifferenceEquationSystem(&model_time_period));
+  DRAKE_DEMAND(model_->num_input_ports() == 1);
+  if (model_time_period != time_period_) {
+    throw std::runtime_error(fmt::format(
+        "The controller's time_period ({}) must match the model's discrete "
+        "update period ({})",
+        time_period_, model_time_period));
+  }
+
+  // Check that the provided Q, R are consistent with the model.
+  DRAKE_DEMAND(num_states_ > 0 && num_inputs_ > 0);
+  DRAKE_DEMAND(Q.rows() == num_states_ && Q.cols() == num_states_);
+  DRAKE_DEMAND(R.rows() == num_inputs_ && R.cols() == num_inputs_);
+
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success) {
+    throw std::runtime_error("R must be positive definite");
+  }
+
+  model_ad_ = model_->ToAutoDiffXd();
+  state_ref_ = base_context_->get_discrete_state(0).CopyToVector();
+  input_ref_ = model_->get_input_port(0).Eval(*base_context_);
+
+  state_input_index_ =
+      this->DeclareVectorInputPort("state", num_states_).get_index();
+
+  // Scratch space for linearizing the model.
+  auto model_context = model_ad_->CreateDefaultContext();
+  model_context->SetTimeStateAndParametersFrom(*base_context_);
+  model_context_cache_index_ =
+      this->DeclareCacheEntry(
+              "model_context",
+              ValueProducer(*model_context, &ValueProducer::NoopCalc),
+              {this->nothing_ticket()})
+          .cache_index();
+
+  // The initial guess rests at the reference.
+  const int N = num_time_samples_;
+  Iterate iterate;
+  iterate.x = state_ref_.replicate(1, N);
+  iterate.u = input_ref_.replicate(1, N - 1);
+  Prepare(model_context.get(), &iterate);
+  iterate_index_ = this->DeclareAbstractState(Value<Iterate>(iterate));
+  statistics_index_ = this->DeclareAbstractState(
+      Value<NonlinearModelPredictiveControllerStatistics>());
+
+  control_output_index_ =
+      this->DeclareVectorOutputPort(
+              "control", num_inputs_,
+              &NonlinearModelPredictiveController::CalcControl,
+              {this->input_port_ticket(InputPortIndex(state_input_index_)),
+               this->abstract_state_ticket(iterate_index_)})
+          .get_index();
+  statistics_output_index_ =
+      this->DeclareStateOutputPort("statistics", statistics_index_)
+          .get_index();
+
+  this->DeclarePeriodicUnrestrictedUpdateEvent(
+      time_period_, 0.0, &NonlinearModelPredictiveController::Update);
+}
+
+const Eigen::MatrixXd& NonlinearModelPredictiveController::
+    GetStateTrajectoryGuess(const Context<double>& context) const {
+  this->ValidateContext(context);
+  return context.get_abstract_state<Iterate>(iterate_index_).x;
+}
+
+const Eigen::MatrixXd& NonlinearModelPredictiveController::
+    GetInputTrajectoryGuess(const Context<double>& context) const {
+  this->ValidateContext(context);
+  return context.get_abstract_state<Iterate>(iterate_index_).u;
+}
+
+void NonlinearModelPredictiveController::CalcControl(
+    const Context<double>& context, BasicVector<double>* control) const {
+  const Eigen::VectorXd& current_state = get_state_port().Eval(context);
+  const Iterate& iterate = context.get_abstract_state<Iterate>(iterate_index_);
+
+  // The feedback phase of the first SQP iteration.
+  control->SetFromVector(iterate.u.col(0) -
+                         iterate.K[0] * (current_state - iterate.x.col(0)) -
+                         iterate.k.col(0));
+}
+
+EventStatus NonlinearModelPredictiveController::Update(
+    const Context<double>& context, State<double>* state) const {
+  SteadyTimer timer;
+  const Eigen::VectorXd& current_state = get_state_port().Eval(context);
+  Context<AutoDiffXd>& model_context =
+      this->get_cache_entry(model_context_cache_index_)
+          .get_mutable_cache_entry_value(context)
+          .GetMutableValueOrThrow<Context<AutoDiffXd>>();
+
+  Iterate& iterate = state->get_mutable_abstract_state<Iterate>(iterate_index_);
+  // The preparation phase of the first iteration was completed by the previous
+  // update (or at construction).
+  double cost = ApplyFeedback(current_state, &iterate);
+  for (int i = 1; i < num_iterations_per_update_; ++i) {
+    Prepare(&model_context, &iterate);
+    cost = ApplyFeedback(current_state, &iterate);
+  }
+
+  // Shift the solution by one time step, holding the final state and input,
+  // and prepare the first iteration for the next update.
+  const int N = num_time_samples_;
+  iterate.x.leftCols(N - 1) = iterate.x.rightCols(N - 1).eval();
+  iterate.u.leftCols(N - 2) = iterate.u.rightCols(N - 2).eval();
+  Prepare(&model_context, &iterate);
+
+  const double solve_time = timer.Tick();
+  auto& statistics =
+      state->get_mutable_abstract_state<
+          NonlinearModelPredictiveControllerStatistics>(statistics_index_);
+  ++statistics.num_updates;
+  statistics.solve_time = solve_time;
+  statistics.max_solve_time = std::max(statistics.max_solve_time, solve_time);
+  statistics.total_solve_time += solve_time;
+  statistics.cost = cost;
+  return EventStatus::Succeeded();
+}
+
+void NonlinearModelPredictiveController::Prepare(
+    Context<AutoDiffXd>* model_context, Iterate* iterate) const {
+  const int N = num_time_samples_;
+  const int nx = num_states_;
+  iterate->A.resize(N - 1);
+  iterate->B.resize(N - 1);
+  iterate->d.resize(nx, N - 1);
+  iterate->K.resize(N - 1);
+  iterate->k.resize(num_inputs_, N - 1);
+
+  const InputPort<AutoDiffXd>& input_port = model_ad_->get_input_port(0);
+  for (int i = 0; i < N - 1; ++i) {
+    const auto [x_ad, u_ad] =
+        math::InitializeAutoDiffTuple(iterate->x.col(i), iterate->u.col(i));
+    model_context->SetDiscreteState(0, x_ad);
+    input_port.FixValue(model_context, u_ad);
+    const VectorX<AutoDiffXd>& next_state =
+        model_ad_->EvalUniquePeriodicDiscreteUpdate(*model_context).value(0);
+    const Eigen::MatrixXd AB =
+        math::ExtractGradient(next_state, nx + num_inputs_);
+    iterate->A[i] = AB.leftCols(nx);
+    iterate->B[i] = AB.rightCols(num_inputs_);
+    iterate->d.col(i) = math::ExtractValue(next_state) - iterate->x.col(i + 1);
+  }
+
+  // Backward Riccati recursion for the cost-to-go ½δxᵀSδx + sᵀδx of the
+  // linear-quadratic subproblem, starting from zero final cost.
+  Eigen::MatrixXd S = Eigen::MatrixXd::Zero(nx, nx);
+  Eigen::VectorXd s = Eigen::VectorXd::Zero(nx);
+  for (int i = N - 2; i >= 0; --i) {
+    const Eigen::MatrixXd& A = iterate->A[i];
+    const Eigen::MatrixXd& B = iterate->B[i];
+    const Eigen::VectorXd Sd_plus_s = S * iterate->d.col(i) + s;
+    const Eigen::MatrixXd SA = S * A;
+    const Eigen::MatrixXd Quu = R_ + B.transpose() * S * B;
+    const Eigen::MatrixXd Qux = B.transpose() * SA;
+    const Eigen::VectorXd qx =
+        Q_ * (iterate->x.col(i) - state_ref_) + A.transpose() * Sd_plus_s;
+    const Eigen::VectorXd qu =
+        R_ * (iterate->u.col(i) - input_ref_) + B.transpose() * Sd_plus_s;
+    const Eigen::LLT<Eigen::MatrixXd> Quu_cholesky(Quu);
+    iterate->K[i] = Quu_cholesky.solve(Qux);
+    iterate->k.col(i) = Quu_cholesky.solve(qu);
+    S = Q_ + A.transpose() * SA - Qux.transpose() * iterate->K[i];
+    // Guard against the accumulation of asymmetric round-off error.
+    S = 0.5 * (S + S.transpose()).eval();
+    s = qx - Qux.transpose() * iterate->k.col(i);
+  }
+}
+
+double NonlinearModelPredictiveController::ApplyFeedback(
+    const Eigen::VectorXd& current_state, Iterate* iterate) const {
+  const int N = num_time_samples_;
+  double cost = 0.0;
+  Eigen::VectorXd dx = current_state - iterate->x.col(0);
+  for (int i = 0; i < N - 1; ++i) {
+    const Eigen::VectorXd du = -iterate->K[i] * dx - iterate->k.col(i);
+    const Eigen::VectorXd next_dx =
+        iterate->A[i] * dx + iterate->B[i] * du + iterate->d.col(i);
+    iterate->x.col(i) += dx;
+    iterate->u.col(i) += du;
+    const Eigen::VectorXd x_error = iterate->x.col(i) - state_ref_;
+    const Eigen::VectorXd u_error = iterate->u.col(i) - input_ref_;
+    cost += x_error.dot(Q_ * x_error) + u_error.dot(R_ * u_error);
+    dx = next_dx;
+  }
+  iterate->x.col(N - 1) += dx;
+  return cost;
+}
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+/// Solver statistics reported by NonlinearModelPredictiveController on its
+/// `statistics` output port.
+struct NonlinearModelPredictiveControllerStatistics {
+  /// The number of discrete updates (i.e., solves) performed so far.
+  int num_updates{0};
+  /// The wall-clock time (in seconds) spent in the most recent update.
+  double solve_time{0.0};
+  /// The largest `solve_time` over all updates so far.
+  double max_solve_time{0.0};
+  /// The sum of `solve_time` over all updates so far.
+  double total_solve_time{0.0};
+  /// The value of the objective at the most recent solution.
+  double cost{0.0};
+};
+
+/// Implements a nonlinear Model Predictive Controller that regulates a
+/// discrete-time system to a fixed (equilibrium) reference by solving, at each
+/// time step k, the following problem to find an optimal u(k) as a function
+/// of x(k):
+///
+///   @f[ \min_{u(k),\ldots,u(k+N-2),x(k+1),\ldots,x(k+N-1)}
+///          \sum_{i=k}^{k+N-2} ((x(i) - xd)ᵀQ(x(i) - xd) +
+///                              (u(i) - ud)ᵀR(u(i) - ud)) @f]
+///   @f[ \mathrm{s.t. } x(i+1) = f(x(i), u(i)) @f]
+///
+/// where N is the number of time samples in the horizon, f is the model's
+/// discrete update, and xd and ud are the desired state and input.
+///
+/// Rather than solving each problem to convergence, the controller performs
+/// the "real-time iteration" scheme: the solution from the previous time step,
+/// shifted by one step, is used as the initial guess, and only a fixed number
+/// of Gauss-Newton sequential quadratic programming (SQP) iterations are
+/// performed per time step.  Each SQP iteration linearizes the dynamics along
+/// the current guess (using automatic differentiation) and solves the
+/// resulting linear-quadratic subproblem exactly by a backward Riccati
+/// recursion, so its cost is linear in the horizon length.
+///
+/// The work for the first iteration is split in two: the linearization and
+/// Riccati recursion about the shifted guess are performed at the end of the
+/// previous update (the "preparation" phase), which leaves an affine feedback
+/// law in the measured state.  The `control` output evaluates that law for
+/// the current value of the `state` input (the "feedback" phase), so the
+/// output responds to the measurement without any delay and at negligible
+/// cost.  The periodic update then completes the iterations using the same
+/// measurement, and prepares for the next time step.  Note that any SQP
+/// iterations beyond the first only refine the guess carried over to the
+/// next time step; they do not change the control at the current time step.
+///
+/// @system
+/// name: NonlinearModelPredictiveController
+/// input_ports:
+/// - state
+/// output_ports:
+/// - control
+/// - statistics
+/// @endsystem
+///
+/// The `statistics` output port is abstract-valued and reports a
+/// NonlinearModelPredictiveControllerStatistics.
+///
+/// @ingroup control_systems
+class NonlinearModelPredictiveController final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(NonlinearModelPredictiveController)
+
+  /// Constructs the controller.
+  ///
+  /// @param model The plant model of the System to be controlled.  The model
+  /// must support System::ToAutoDiffXd.
+  /// @param base_context The fixed reference point to regulate to; its
+  /// discrete state is xd and its (fixed) input is ud.  Any parameters of the
+  /// model are also taken from this context.
+  /// @param Q A symmetric positive semi-definite state cost matrix of size
+  /// (num_states x num_states).
+  /// @param R A symmetric positive definite control effort cost matrix of size
+  /// (num_inputs x num_inputs).
+  /// @param time_period The discrete time period (in seconds) at which
+  /// controller updates occur; this must match the model's update period.
+  /// @param time_horizon The prediction time horizon (seconds).
+  /// @param num_iterations_per_update The number of SQP iterations performed
+  /// per time step; must be positive.
+  ///
+  /// @pre model must have a single group of discrete states of dimension
+  /// num_states and a single input port of dimension num_inputs.
+  /// @pre The input of base_context must be initialized via
+  /// `input_port.FixValue(base_context, u0)`.
+  ///
+  /// @throws std::exception if R is not positive definite.
+  /// @throws std::exception if time_period does not match the model's discrete
+  /// update period.
+  NonlinearModelPredictiveController(
+      std::unique_ptr<System<double>> model,
+      std::unique_ptr<Context<double>> base_context,
+      const Eigen::MatrixXd& Q, const Eigen::MatrixXd& R, double time_period,
+      double time_horizon, int num_iterations_per_update = 1);
+
+  const InputPort<double>& get_state_port() const {
+    return this->get_input_port(state_input_index_);
+  }
+  const OutputPort<double>& get_control_port() const {
+    return this->get_output_port(control_output_index_);
+  }
+  const OutputPort<double>& get_statistics_port() const {
+    return this->get_output_port(statistics_output_index_);
+  }
+
+  /// Returns the number of time samples N in the horizon.
+  int num_time_samples() const { return num_time_samples_; }
+
+  /// Returns the state trajectory of the most recent solution, shifted by one
+  /// time step to serve as the initial guess for the next update, as a
+  /// (num_states x N) matrix.
+  const Eigen::MatrixXd& GetStateTrajectoryGuess(
+      const Context<double>& context) const;
+
+  /// Returns the input trajectory of the most recent solution, shifted by one
+  /// time step to serve as the initial guess for the next update, as a
+  /// (num_inputs x N-1) matrix.
+  const Eigen::MatrixXd& GetInputTrajectoryGuess(
+      const Context<double>& context) const;
+
+ private:
+  // The current guess of the solution, along with the linearization and the
+  // Riccati recursion about that guess.
+  struct Iterate;
+
+  void CalcControl(const Context<double>& context,
+                   BasicVector<double>* control) const;
+
+  EventStatus Update(const Context<double>& context,
+                     State<double>* state) const;
+
+  // Linearizes the dynamics about the guess in `iterate` and computes the
+  // affine feedback law for the linear-quadratic subproblem.
+  void Prepare(Context<AutoDiffXd>* model_context, Iterate* iterate) const;
+
+  // Applies the affine feedback law in `iterate` starting from
+  // `current_state`, updates the guess with the result, and returns the
+  // resulting cost.
+  double ApplyFeedback(const Eigen::VectorXd& current_state,
+                       Iterate* iterate) const;
+
+  const std::unique_ptr<System<double>> model_;
+  // The base context that contains the reference point to regulate.
+  const std::unique_ptr<Context<double>> base_context_;
+  // The AutoDiff version of the model, used to linearize the dynamics.
+  std::unique_ptr<System<AutoDiffXd>> model_ad_;
+
+  const int num_states_{};
+  const int num_inputs_{};
+
+  const Eigen::MatrixXd Q_;
+  const Eigen::MatrixXd R_;
+  Eigen::VectorXd state_ref_;
+  Eigen::VectorXd input_ref_;
+
+  const double time_period_{};
+  const int num_time_samples_{};
+  const int num_iterations_per_update_{};
+
+  int state_input_index_{-1};
+  int control_output_index_{-1};
+  int statistics_output_index_{-1};
+  AbstractStateIndex iterate_index_;
+  AbstractStateIndex statistics_index_;
+  CacheIndex model_context_cache_index_;
+};
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
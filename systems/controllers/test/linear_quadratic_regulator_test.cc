@@ -295,6 +295,50 @@ GTEST_TEST(TestLqr, DiscreteDoubleIntegrator) {
   TestLqrAffineSystemAgainstKnownSolution(tol, sys, K, Q, R);
 }
 
+GTEST_TEST(TestLqr, DiscreteTimeFiniteHorizon) {
+  Eigen::Matrix2d A;
+  Eigen::Vector2d B;
+  A << 1, 1, 0, 1;
+  B << 0, 1;
+  const Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+  const Vector1d R = Vector1d::Identity();
+
+  const LinearQuadraticRegulatorResult infinite_horizon =
+      DiscreteTimeLinearQuadraticRegulator(A, B, Q, R);
+  const double tol = 1e-10;
+
+  // With the final cost set to the infinite-horizon cost-to-go, the
+  // infinite-horizon solution is stationary under the recursion.
+  const int kNumSteps = 5;
+  std::vector<LinearQuadraticRegulatorResult> result =
+      DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+          A, B, Q, R, infinite_horizon.S, kNumSteps);
+  ASSERT_EQ(static_cast<int>(result.size()), kNumSteps);
+  for (const auto& step : result) {
+    EXPECT_TRUE(CompareMatrices(step.K, infinite_horizon.K, 1e-8));
+    EXPECT_TRUE(CompareMatrices(step.S, infinite_horizon.S, 1e-8));
+  }
+
+  // A single step with zero final cost has nothing to gain from the input.
+  result = DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+      A, B, Q, R, Eigen::Matrix2d::Zero(), 1);
+  ASSERT_EQ(static_cast<int>(result.size()), 1);
+  EXPECT_TRUE(CompareMatrices(result[0].K, Eigen::RowVector2d::Zero(), tol));
+  EXPECT_TRUE(CompareMatrices(result[0].S, Q, tol));
+
+  // Over a long horizon, the initial gain converges to the infinite-horizon
+  // gain.
+  result = DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+      A, B, Q, R, Eigen::Matrix2d::Zero(), 200);
+  EXPECT_TRUE(CompareMatrices(result.front().K, infinite_horizon.K, 1e-8));
+  EXPECT_TRUE(CompareMatrices(result.front().S, infinite_horizon.S, 1e-8));
+
+  // R must be positive definite.
+  EXPECT_THROW(DiscreteTimeFiniteHorizonLinearQuadraticRegulator(
+                   A, B, Q, Vector1d::Zero(), Q, kNumSteps),
+               std::runtime_error);
+}
+
 // Adds test coverage for calling LQR from a LeafSystem and from a
 // MultibodyPlant.
 GTEST_TEST(TestLqr, AcrobotTest) {
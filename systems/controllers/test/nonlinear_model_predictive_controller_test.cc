@@ -0,0 +1,172 @@
+#include "drake/systems/controllers/nonlinear_model_predictive_controller.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/controllers/linear_model_predictive_controller.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/primitives/symbolic_vector_system.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+namespace {
+
+using symbolic::Variable;
+
+// For a linear model and a guess that rests at the reference, the first SQP
+// iteration is exactly the linear MPC problem.
+GTEST_TEST(NonlinearModelPredictiveControllerTest, MatchesLinearMpc) {
+  const double kTimeStep = 0.1;
+  const double kTimeHorizon = 2.;
+
+  Eigen::Matrix2d A;
+  Eigen::Vector2d B;
+  A << 1, 0.1, 0, 1;
+  B << 0.005, 0.1;
+  const auto C = Eigen::Matrix<double, 2, 2>::Identity();
+  const auto D = Eigen::Matrix<double, 2, 1>::Zero();
+  const Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+  const Vector1d R = Vector1d::Constant(1.);
+
+  auto make_context = [](const System<double>& system) {
+    auto context = system.CreateDefaultContext();
+    system.get_input_port(0).FixValue(context.get(), Vector1d::Zero());
+    context->SetDiscreteState(0, Eigen::Vector2d::Zero());
+    return context;
+  };
+
+  auto linear_system =
+      std::make_unique<LinearSystem<double>>(A, B, C, D, kTimeStep);
+  auto linear_context = make_context(*linear_system);
+  const LinearModelPredictiveController<double> linear_mpc(
+      std::move(linear_system), std::move(linear_context), Q, R, kTimeStep,
+      kTimeHorizon);
+
+  auto system = std::make_unique<LinearSystem<double>>(A, B, C, D, kTimeStep);
+  auto context = make_context(*system);
+  const NonlinearModelPredictiveController dut(
+      std::move(system), std::move(context), Q, R, kTimeStep, kTimeHorizon);
+  EXPECT_EQ(dut.num_time_samples(), 20);
+
+  const Eigen::Vector2d x0(1., -0.5);
+  auto linear_mpc_context = linear_mpc.CreateDefaultContext();
+  linear_mpc.get_state_port().FixValue(linear_mpc_context.get(), x0);
+  auto dut_context = dut.CreateDefaultContext();
+  dut.get_state_port().FixValue(dut_context.get(), x0);
+
+  EXPECT_TRUE(CompareMatrices(
+      dut.get_control_port().Eval(*dut_context),
+      linear_mpc.get_control_port().Eval(*linear_mpc_context), 1e-10));
+}
+
+class PendulumSwingUpTest : public ::testing::TestWithParam<int> {};
+
+// Stabilizes a (discretized) pendulum about its upright equilibrium from an
+// initial condition well outside the region where the linearization about the
+// upright is accurate.
+TEST_P(PendulumSwingUpTest, Stabilizes) {
+  const double kTimeStep = 0.05;
+  const Variable theta("theta");
+  const Variable thetadot("thetadot");
+  const Variable tau("tau");
+  const Vector2<symbolic::Expression> next_state(
+      theta + kTimeStep * thetadot,
+      thetadot + kTimeStep * (-10. * sin(theta) - 0.1 * thetadot + tau));
+  auto make_pendulum = [&]() {
+    return SymbolicVectorSystemBuilder()
+        .state(Vector2<Variable>(theta, thetadot))
+        .input(tau)
+        .dynamics(next_state)
+        .output(Vector2<symbolic::Expression>(theta, thetadot))
+        .time_period(kTimeStep)
+        .Build();
+  };
+
+  const Eigen::Vector2d upright(M_PI, 0.);
+  auto model = make_pendulum();
+  auto model_context = model->CreateDefaultContext();
+  model->get_input_port().FixValue(model_context.get(), 0.);
+  model_context->SetDiscreteState(0, upright);
+
+  DiagramBuilder<double> builder;
+  const auto* pendulum = builder.AddSystem(make_pendulum());
+  const auto* controller =
+      builder.AddSystem<NonlinearModelPredictiveController>(
+          std::move(model), std::move(model_context),
+          Eigen::Matrix2d::Identity(), Vector1d::Constant(0.1), kTimeStep,
+          1.0, GetParam());
+  builder.Connect(pendulum->get_output_port(), controller->get_state_port());
+  builder.Connect(controller->get_control_port(), pendulum->get_input_port());
+  const auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  Context<double>& pendulum_context = pendulum->GetMyMutableContextFromRoot(
+      &simulator.get_mutable_context());
+  pendulum_context.SetDiscreteState(0, Eigen::Vector2d(M_PI - 1.0, 0.));
+  simulator.AdvanceTo(5.0);
+
+  EXPECT_TRUE(CompareMatrices(pendulum_context.get_discrete_state(0).value(),
+                              upright, 1e-2));
+
+  const auto& statistics =
+      controller->get_statistics_port()
+          .Eval<NonlinearModelPredictiveControllerStatistics>(
+              controller->GetMyContextFromRoot(simulator.get_context()));
+  EXPECT_GE(statistics.num_updates, 100);
+  EXPECT_GT(statistics.solve_time, 0.);
+  EXPECT_GE(statistics.max_solve_time, statistics.solve_time);
+  EXPECT_GE(statistics.total_solve_time, statistics.max_solve_time);
+  EXPECT_LT(statistics.cost, 1e-3);
+
+  // The guess carried over to the next update has been shifted to the end of
+  // the horizon.
+  const Context<double>& controller_context =
+      controller->GetMyContextFromRoot(simulator.get_context());
+  EXPECT_EQ(controller->GetStateTrajectoryGuess(controller_context).cols(),
+            controller->num_time_samples());
+  EXPECT_EQ(controller->GetInputTrajectoryGuess(controller_context).cols(),
+            controller->num_time_samples() - 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(NumIterationsPerUpdate, PendulumSwingUpTest,
+                         ::testing::Values(1, 3));
+
+GTEST_TEST(NonlinearModelPredictiveControllerTest, ThrowIfRNotPosDef) {
+  auto system = std::make_unique<LinearSystem<double>>(
+      Eigen::Matrix2d::Identity(), Eigen::Matrix2d::Identity(),
+      Eigen::Matrix2d::Identity(), Eigen::Matrix2d::Zero(), 1.);
+  auto context = system->CreateDefaultContext();
+  system->get_input_port().FixValue(context.get(), Eigen::Vector2d::Zero());
+
+  Eigen::Matrix2d R = Eigen::Matrix2d::Identity();
+  R(0, 0) = 0.;
+
+  EXPECT_THROW(NonlinearModelPredictiveController(
+                   std::move(system), std::move(context),
+                   Eigen::Matrix2d::Identity(), R, 1., 2.),
+               std::runtime_error);
+}
+
+GTEST_TEST(NonlinearModelPredictiveControllerTest, ThrowIfPeriodMismatch) {
+  auto system = std::make_unique<LinearSystem<double>>(
+      Eigen::Matrix2d::Identity(), Eigen::Matrix2d::Identity(),
+      Eigen::Matrix2d::Identity(), Eigen::Matrix2d::Zero(), 1.);
+  auto context = system->CreateDefaultContext();
+  system->get_input_port().FixValue(context.get(), Eigen::Vector2d::Zero());
+
+  EXPECT_THROW(NonlinearModelPredictiveController(
+                   std::move(system), std::move(context),
+                   Eigen::Matrix2d::Identity(), Eigen::Matrix2d::Identity(),
+                   0.5, 2.),
+               std::runtime_error);
+}
+
+}  // namespace
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
+#include <memory>
 #include <stdexcept>
 
 #include <zlib.h>
@@ -7,6 +8,7 @@
 #include "drake/lcmt_image.hpp"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/lcm_image_traits.h"
+#include "drake/systems/sensors/shared_memory_image_ring.h"
 
 using std::string;
 
@@ -50,10 +52,23 @@ void Pack(const Image<kPixelType>& image, lcmt_image* msg) {
   memcpy(&msg->data[0], image.at(0, 0), size);
 }
 
-// Overwrites everything in msg except its header.
+// Overwrites the msg's compression_method, size, and data.
+template <PixelType kPixelType>
+void WriteToSharedMemory(const Image<kPixelType>& image,
+                         const internal::SharedMemoryImageWriter& writer,
+                         lcmt_image* msg) {
+  msg->compression_method = lcmt_image::COMPRESSION_METHOD_SHARED_MEMORY;
+  const int size = image.width() * image.height() * image.kPixelSize;
+  writer.Write(image.at(0, 0), size, &msg->data);
+  msg->size = msg->data.size();
+}
+
+// Overwrites everything in msg except its header. When `shared_memory` is
+// non-null, the pixels are written there instead of into the msg.
 template <PixelType kPixelType>
-void PackImageToLcmImageT(const Image<kPixelType>& image, lcmt_image* msg,
-                          bool do_compress) {
+void PackImageToLcmImageT(
+    const Image<kPixelType>& image, lcmt_image* msg, bool do_compress,
+    const internal::SharedMemoryImageWriter* shared_memory) {
   msg->width = image.width();
   msg->height = image.height();
   msg->row_stride = image.kPixelSize * msg->width;
@@ -62,7 +77,9 @@ void PackImageToLcmImageT(const Image<kPixelType>& image, lcmt_image* msg,
       LcmPixelTraits<ImageTraits<kPixelType>::kPixelFormat>::kPixelFormat;
   msg->channel_type = LcmImageTraits<kPixelType>::kChannelType;
 
-  if (do_compress) {
+  if (shared_memory != nullptr) {
+    WriteToSharedMemory(image, *shared_memory, msg);
+  } else if (do_compress) {
     Compress(image, msg);
   } else {
     Pack(image, msg);
@@ -70,56 +87,56 @@ void PackImageToLcmImageT(const Image<kPixelType>& image, lcmt_image* msg,
 }
 
 // Overwrites everything in msg except its header.
-void PackImageToLcmImageT(const AbstractValue& untyped_image,
-                          PixelType pixel_type, lcmt_image* msg,
-                          bool do_compress) {
+void PackImageToLcmImageT(
+    const AbstractValue& untyped_image, PixelType pixel_type, lcmt_image* msg,
+    bool do_compress, const internal::SharedMemoryImageWriter* shared_memory) {
   switch (pixel_type) {
     case PixelType::kRgb8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kRgb8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, shared_memory);
       break;
     }
     case PixelType::kBgr8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kBgr8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, shared_memory);
       break;
     }
     case PixelType::kRgba8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kRgba8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, shared_memory);
       break;
     }
     case PixelType::kBgra8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kBgra8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, shared_memory);
       break;
     }
     case PixelType::kGrey8U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kGrey8U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, shared_memory);
       break;
     }
     case PixelType::kDepth16U: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kDepth16U>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, shared_memory);
       break;
     }
     case PixelType::kDepth32F: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kDepth32F>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, shared_memory);
       break;
     }
     case PixelType::kLabel16I: {
       const auto& image_value =
           untyped_image.get_value<Image<PixelType::kLabel16I>>();
-      PackImageToLcmImageT(image_value, msg, do_compress);
+      PackImageToLcmImageT(image_value, msg, do_compress, shared_memory);
       break;
     }
     case PixelType::kExpr:
@@ -155,6 +172,20 @@ ImageToLcmImageArrayT::ImageToLcmImageArrayT(const string& color_frame_name,
           .get_index();
 }
 
+ImageToLcmImageArrayT::~ImageToLcmImageArrayT() = default;
+
+void ImageToLcmImageArrayT::UseSharedMemory(const std::string& segment_name,
+                                            int64_t capacity) {
+  if (shared_memory_ != nullptr) {
+    throw std::logic_error(fmt::format(
+        "ImageToLcmImageArrayT::UseSharedMemory(): this system already writes "
+        "to the shared-memory segment '{}'",
+        shared_memory_->segment_name()));
+  }
+  shared_memory_ = std::make_unique<internal::SharedMemoryImageWriter>(
+      segment_name, capacity);
+}
+
 const InputPort<double>& ImageToLcmImageArrayT::color_image_input_port() const {
   DRAKE_DEMAND(color_image_input_port_index_ >= 0);
   return this->get_input_port(color_image_input_port_index_);
@@ -203,7 +234,8 @@ void ImageToLcmImageArrayT::CalcImageArray(
     packed.header = {};
     packed.header.utime = utime;
     packed.header.frame_name = name;
-    PackImageToLcmImageT(value, type, &packed, do_compress_);
+    PackImageToLcmImageT(value, type, &packed, do_compress_,
+                         shared_memory_.get());
   }
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -12,6 +13,9 @@
 namespace drake {
 namespace systems {
 namespace sensors {
+namespace internal {
+class SharedMemoryImageWriter;
+}  // namespace internal
 
 // TODO(jwnimmer-tri) Throughout this filename, classname, and method names, the
 // the "_t" or "T" suffix is superfluous and should be removed.
@@ -36,6 +40,19 @@ namespace sensors {
 /// @endsystem
 ///
 /// @note The output message's header field `seq` is always zero.
+///
+/// @anchor image_to_lcm_shared_memory
+/// <h3>Shared-memory transport</h3>
+///
+/// For high-bandwidth streaming to processes on the same host, call
+/// UseSharedMemory() to write the pixels into a POSIX shared-memory ring buffer
+/// instead of into the message. Each lcmt_image then carries
+/// `compression_method = COMPRESSION_METHOD_SHARED_MEMORY` and, in its `data`,
+/// only a small descriptor of where the pixels live; LcmImageArrayToImages
+/// reads them straight out of shared memory. The ring is not locked: a
+/// consumer that falls more than a full ring behind the publisher will find
+/// its images overwritten and discard them, so size the ring to hold a few
+/// messages' worth of images.
 class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageToLcmImageArrayT)
@@ -57,6 +74,21 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
                         const std::string& label_frame_name,
                         bool do_compress = false);
 
+  ~ImageToLcmImageArrayT() override;
+
+  /// Switches this system to the @ref image_to_lcm_shared_memory
+  /// "shared-memory transport", creating (or replacing) the segment named
+  /// `segment_name`, which must start with a '/' and contain no other '/'.
+  /// The segment is unlinked when this system is destroyed. When used,
+  /// `do_compress` is ignored.
+  ///
+  /// @param segment_name The POSIX shared-memory name, e.g., "/drake_images".
+  /// @param capacity The size of the ring buffer in bytes. It must be at least
+  /// as large as any single image.
+  /// @throws std::exception if the segment can't be created, or if this
+  /// system already uses shared memory.
+  void UseSharedMemory(const std::string& segment_name, int64_t capacity);
+
   /// Returns the input port containing a color image.
   /// Note: Only valid if the color/depth/label constructor is used.
   const InputPort<double>& color_image_input_port() const;
@@ -90,6 +122,7 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
 
   std::vector<PixelType> input_port_pixel_type_{};
   const bool do_compress_;
+  std::unique_ptr<internal::SharedMemoryImageWriter> shared_memory_;
 };
 
 }  // namespace sensors
@@ -2,30 +2,62 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
+#include <vtkErrorCode.h>
 #include <vtkImageData.h>
 #include <vtkNew.h>
 #include <vtkPNGWriter.h>
 #include <vtkSmartPointer.h>
 #include <vtkTIFFWriter.h>
 
+#include "drake/common/ssize.h"
+#include "drake/common/text_logging.h"
+#include "drake/common/timer.h"
+
 namespace drake {
 namespace systems {
 namespace sensors {
 
+// @param compression_level  See ImageWriterParams::compression_level.
+// @param throw_on_failure  When true, a failure to write the file throws;
+// otherwise (as for the public SaveTo*() functions) it is silently ignored.
 template <PixelType kPixelType>
 void SaveToFileHelper(const Image<kPixelType>& image,
-                      const std::string& file_path) {
+                      const std::string& file_path,
+                      int compression_level = -1,
+                      bool throw_on_failure = false) {
   const int width = image.width();
   const int height = image.height();
   const int num_channels = Image<kPixelType>::kNumChannels;
 
+  auto make_png_writer = [compression_level]() {
+    auto png_writer = vtkSmartPointer<vtkPNGWriter>::New();
+    if (compression_level >= 0) {
+      png_writer->SetCompressionLevel(compression_level);
+    }
+    return png_writer;
+  };
+  auto make_tiff_writer = [compression_level]() {
+    auto tiff_writer = vtkSmartPointer<vtkTIFFWriter>::New();
+    if (compression_level == 0) {
+      tiff_writer->SetCompressionToNoCompression();
+    }
+    return tiff_writer;
+  };
+
   vtkSmartPointer<vtkImageWriter> writer;
   vtkNew<vtkImageData> vtk_image;
   vtk_image->SetDimensions(width, height, 1);
@@ -35,19 +67,19 @@ void SaveToFileHelper(const Image<kPixelType>& image,
     case PixelType::kRgba8U:
     case PixelType::kGrey8U:
       vtk_image->AllocateScalars(VTK_UNSIGNED_CHAR, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
+      writer = make_png_writer();
       break;
     case PixelType::kDepth16U:
       vtk_image->AllocateScalars(VTK_UNSIGNED_SHORT, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
+      writer = make_png_writer();
       break;
     case PixelType::kDepth32F:
       vtk_image->AllocateScalars(VTK_FLOAT, num_channels);
-      writer = vtkSmartPointer<vtkTIFFWriter>::New();
+      writer = make_tiff_writer();
       break;
     case PixelType::kLabel16I:
       vtk_image->AllocateScalars(VTK_UNSIGNED_SHORT, num_channels);
-      writer = vtkSmartPointer<vtkPNGWriter>::New();
+      writer = make_png_writer();
       break;
     default:
       throw std::logic_error(
@@ -72,6 +104,11 @@ void SaveToFileHelper(const Image<kPixelType>& image,
   writer->SetFileName(file_path.c_str());
   writer->SetInputData(vtk_image.GetPointer());
   writer->Write();
+  if (throw_on_failure && writer->GetErrorCode() != vtkErrorCode::NoError) {
+    throw std::runtime_error(fmt::format(
+        "ImageWriter: failed to write '{}': {}", file_path,
+        vtkErrorCode::GetStringFromErrorCode(writer->GetErrorCode())));
+  }
 }
 
 void SaveToPng(const ImageRgba8U& image, const std::string& file_path) {
@@ -94,7 +131,213 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
 
-ImageWriter::ImageWriter() {
+// The queue is guarded by a single mutex. Publish events push onto its back
+// and the background threads pop from its front; with no background threads,
+// each image is written as soon as it is submitted.
+class ImageWriter::WriteQueue {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(WriteQueue)
+
+  explicit WriteQueue(const ImageWriterParams& params)
+      : max_size_(params.max_queue_size),
+        drop_oldest_(params.drop_oldest_when_full) {
+    for (int i = 0; i < params.num_threads; ++i) {
+      threads_.emplace_back([this]() {
+        WorkerLoop();
+      });
+    }
+  }
+
+  // The background threads write everything remaining in the queue before
+  // exiting.
+  ~WriteQueue() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    task_ready_.notify_all();
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+    // A destructor can't throw, so a write failure not yet reported is logged.
+    if (write_error_ != nullptr) {
+      try {
+        std::rethrow_exception(write_error_);
+      } catch (const std::exception& e) {
+        drake::log()->error("ImageWriter: {}", e.what());
+      } catch (...) {
+        drake::log()->error("ImageWriter: failed to write an image");
+      }
+    }
+  }
+
+  bool is_synchronous() const { return threads_.empty(); }
+
+  // Writes the image by invoking `task`, either immediately or by queueing it
+  // for a background thread.
+  // @throws the first exception thrown while writing a previously queued
+  // image, if not thrown already; the given image is then discarded.
+  void Submit(std::function<void()> task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ThrowIfWriteFailed(&lock);
+    ++statistics_.num_submitted;
+    if (is_synchronous()) {
+      lock.unlock();
+      Run(task);
+      return;
+    }
+    if (ssize(tasks_) >= max_size_) {
+      if (drop_oldest_) {
+        tasks_.pop_front();
+        ++statistics_.num_dropped;
+      } else {
+        SteadyTimer timer;
+        timer.Start();
+        space_ready_.wait(lock, [this]() {
+          return ssize(tasks_) < max_size_;
+        });
+        statistics_.total_blocked_time += timer.Tick();
+      }
+    }
+    tasks_.push_back(std::move(task));
+    statistics_.peak_queue_size =
+        std::max(statistics_.peak_queue_size, static_cast<int>(ssize(tasks_)));
+    lock.unlock();
+    task_ready_.notify_one();
+  }
+
+  // @throws the first exception thrown while writing a queued image, if not
+  // thrown already.
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() {
+      return tasks_.empty() && num_busy_ == 0;
+    });
+    ThrowIfWriteFailed(&lock);
+  }
+
+  ImageWriterStatistics GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ImageWriterStatistics result = statistics_;
+    result.queue_size = static_cast<int>(ssize(tasks_));
+    return result;
+  }
+
+ private:
+  // Invokes the task (without holding the lock), and records its duration.
+  void Run(const std::function<void()>& task) {
+    SteadyTimer timer;
+    timer.Start();
+    task();
+    const double write_time = timer.Tick();
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++statistics_.num_written;
+    statistics_.total_write_time += write_time;
+    statistics_.max_write_time =
+        std::max(statistics_.max_write_time, write_time);
+  }
+
+  // Rethrows (and forgets) the exception recorded by a background thread, if
+  // any.
+  void ThrowIfWriteFailed(std::unique_lock<std::mutex>* lock) {
+    if (write_error_ != nullptr) {
+      std::exception_ptr error = std::move(write_error_);
+      write_error_ = nullptr;
+      lock->unlock();
+      std::rethrow_exception(error);
+    }
+  }
+
+  void WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      task_ready_.wait(lock, [this]() {
+        return stopping_ || !tasks_.empty();
+      });
+      if (tasks_.empty()) {
+        // We must be stopping, and there's nothing left to write.
+        return;
+      }
+      std::function<void()> task = std::move(tasks_.front());
+      tasks_.pop_front();
+      ++num_busy_;
+      lock.unlock();
+      space_ready_.notify_one();
+      // An exception must not escape the thread (that would terminate the
+      // program); it is recorded and rethrown by the next Submit() or Flush().
+      std::exception_ptr error;
+      try {
+        Run(task);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      if (error != nullptr) {
+        ++statistics_.num_failed;
+        if (write_error_ == nullptr) {
+          write_error_ = std::move(error);
+        }
+      }
+      --num_busy_;
+      if (tasks_.empty() && num_busy_ == 0) {
+        idle_.notify_all();
+      }
+    }
+  }
+
+  const int max_size_;
+  const bool drop_oldest_;
+
+  mutable std::mutex mutex_;
+  // Signaled when a task is added to the queue (or the queue is stopping).
+  std::condition_variable task_ready_;
+  // Signaled when a task is removed from the queue.
+  std::condition_variable space_ready_;
+  // Signaled when the queue is empty and no task is running.
+  std::condition_variable idle_;
+
+  // The following are guarded by mutex_.
+  std::deque<std::function<void()>> tasks_;
+  int num_busy_{0};
+  bool stopping_{false};
+  ImageWriterStatistics statistics_;
+  // The first exception thrown by a background write that hasn't been
+  // rethrown yet.
+  std::exception_ptr write_error_;
+
+  std::vector<std::thread> threads_;
+};
+
+ImageWriter::ImageWriter() : ImageWriter(ImageWriterParams{}) {}
+
+namespace {
+
+// Confirms the params are valid, as a prerequisite to constructing the queue.
+const ImageWriterParams& ThrowIfInvalid(
+    const ImageWriterParams& params) {
+  if (params.num_threads < 0) {
+    throw std::logic_error(fmt::format(
+        "ImageWriter: num_threads must be non-negative; given {}",
+        params.num_threads));
+  }
+  if (params.max_queue_size <= 0) {
+    throw std::logic_error(fmt::format(
+        "ImageWriter: max_queue_size must be positive; given {}",
+        params.max_queue_size));
+  }
+  if (params.compression_level < -1 || params.compression_level > 9) {
+    throw std::logic_error(fmt::format(
+        "ImageWriter: compression_level must be in [-1, 9]; given {}",
+        params.compression_level));
+  }
+  return params;
+}
+
+}  // namespace
+
+ImageWriter::ImageWriter(const ImageWriterParams& params)
+    : params_(ThrowIfInvalid(params)),
+      queue_(std::make_unique<WriteQueue>(params_)) {
   // NOTE: This excludes *many* of the defined `PixelType` values.
   labels_[PixelType::kRgba8U] = "color";
   extensions_[PixelType::kRgba8U] = ".png";
@@ -108,6 +351,16 @@ ImageWriter::ImageWriter() {
   extensions_[PixelType::kGrey8U] = ".png";
 }
 
+ImageWriter::~ImageWriter() = default;
+
+void ImageWriter::Flush() const {
+  queue_->Flush();
+}
+
+ImageWriterStatistics ImageWriter::GetStatistics() const {
+  return queue_->GetStatistics();
+}
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -224,9 +477,23 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  SaveToFileHelper(
-      image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                          port.get_name(), data.count++));
+  std::string file_name = MakeFileName(data.format, data.pixel_type,
+                                       context.get_time(), port.get_name(),
+                                       data.count++);
+  const int compression_level = params_.compression_level;
+  if (queue_->is_synchronous()) {
+    // The image is written before Submit() returns; it needn't be copied.
+    queue_->Submit([&image, &file_name, compression_level]() {
+      SaveToFileHelper(image, file_name, compression_level);
+    });
+  } else {
+    queue_->Submit(
+        [image, file_name = std::move(file_name), compression_level]() {
+          // A background failure is rethrown by the next publish or Flush().
+          SaveToFileHelper(image, file_name, compression_level,
+                           /* throw_on_failure = */ true);
+        });
+  }
 }
 
 std::string ImageWriter::MakeFileName(const std::string& format,
@@ -6,12 +6,14 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/name_value.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/sensors/image.h"
 
@@ -30,7 +32,8 @@ namespace sensors {
 
  These function do not do validation on the provided file path (existence,
  writability, correspondence with image type, etc.) It relies on the caller to
- have done so.  */
+ have done so. Nor do they report a failure to write the file; they never
+ throw because of one.  */
 //@{
 
 /** Writes the color (8-bit, RGBA) image data to disk.  */
@@ -55,6 +58,79 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
 
 //@}
 
+/** Configures how ImageWriter encodes and writes its images. See
+ @ref image_writer_background "Writing images in the background".  */
+struct ImageWriterParams {
+  /** Passes this object to an Archive.
+  Refer to @ref yaml_serialization "YAML Serialization" for background. */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(num_threads));
+    a->Visit(DRAKE_NVP(max_queue_size));
+    a->Visit(DRAKE_NVP(drop_oldest_when_full));
+    a->Visit(DRAKE_NVP(compression_level));
+  }
+
+  /** The number of background threads that encode and write images. When
+   zero (the default), each image is written by the publish event that
+   captured it. Must be non-negative.  */
+  int num_threads{0};
+
+  /** The maximum number of images waiting to be written by the background
+   threads. Must be positive; ignored when `num_threads` is zero.  */
+  int max_queue_size{16};
+
+  /** What a publish event does when it finds the queue full. When false (the
+   default), it blocks until a background thread takes an image from the
+   queue, so every image is written. When true, it discards the oldest image
+   waiting in the queue (which is never written) to make room for the new one,
+   so the simulation never waits.  */
+  bool drop_oldest_when_full{false};
+
+  /** The compression level of the written files, trading file size for
+   encoding time. For .png files, this is the zlib level in [0, 9]; lower
+   levels encode faster but produce larger files, and zero stores the pixels
+   uncompressed. For .tiff files, zero stores the pixels uncompressed and any
+   other level uses the default compression. The default (-1) uses each
+   format's default. Must be in [-1, 9].  */
+  int compression_level{-1};
+};
+
+/** Statistics on the images written by an ImageWriter; see
+ ImageWriter::GetStatistics().  */
+struct ImageWriterStatistics {
+  /** The number of images captured by publish events.  */
+  int num_submitted{0};
+
+  /** The number of images that have been written.  */
+  int num_written{0};
+
+  /** The number of images that a background thread failed to write.  */
+  int num_failed{0};
+
+  /** The number of images discarded, unwritten, because the queue was full
+   (see ImageWriterParams::drop_oldest_when_full).  */
+  int num_dropped{0};
+
+  /** The number of images currently waiting in the queue (excluding those
+   being written).  */
+  int queue_size{0};
+
+  /** The largest number of images that have waited in the queue at once.  */
+  int peak_queue_size{0};
+
+  /** The total time (in seconds) spent encoding and writing images.  */
+  double total_write_time{0.0};
+
+  /** The longest time (in seconds) spent encoding and writing a single image.
+   */
+  double max_write_time{0.0};
+
+  /** The total time (in seconds) publish events have spent blocked, waiting
+   for room in the queue.  */
+  double total_blocked_time{0.0};
+};
+
 /** A system for periodically writing images to the file system. The system does
  not have a fixed set of input ports; the system can have an arbitrary number of
  image input ports. Each input port is independently configured with respect to:
@@ -89,14 +165,60 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
  that function's documentation for elaboration on how to configure image output.
  It is important to note, that every declared image input port _must_ be
  connected; otherwise, attempting to write an image from that port, will cause
- an error in the system.  */
+ an error in the system.
+
+ @anchor image_writer_background
+ <h3>Writing images in the background</h3>
+
+ By default, each image is encoded and written to disk by the publish event
+ that captures it, stalling the simulation while it does so. Alternatively,
+ %ImageWriter can be constructed with ImageWriterParams::num_threads
+ background threads. Then, the publish event merely copies the image (and its
+ file name) into a bounded queue, and the background threads encode and write
+ the queued images concurrently with the simulation. When the queue is full,
+ the publish event either waits for room or discards the oldest queued image
+ (see ImageWriterParams::drop_oldest_when_full).
+
+ Because images are written asynchronously, a file may not exist yet when the
+ publish event returns. Call Flush() to wait for all of the captured images to
+ be written; destroying the %ImageWriter does so as well. GetStatistics()
+ reports the queue's depth and the time spent encoding and writing, which can
+ be used to tune the number of threads, queue size, and compression level.
+
+ If a background thread fails to write an image, the exception is rethrown by
+ the next publish event or call to Flush(), whichever comes first. Only the
+ first such failure is reported; the background threads carry on writing the
+ remaining images. Without background threads, as with SaveToPng(), a failure
+ to write an image is not reported.  */
 class ImageWriter : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter)
 
-  /** Constructs default instance with no image ports.  */
+  /** Constructs default instance with no image ports, which writes each image
+   in the publish event that captures it.  */
   ImageWriter();
 
+  /** Constructs an instance with no image ports, which encodes and writes its
+   images as configured by `params`.
+   @throws std::exception if any of the `params` are out of range.  */
+  explicit ImageWriter(const ImageWriterParams& params);
+
+  /** Waits for all captured images to be written, and then destroys the
+   %ImageWriter.  */
+  ~ImageWriter() override;
+
+  /** Returns the parameters given at construction.  */
+  const ImageWriterParams& params() const { return params_; }
+
+  /** Blocks until every image captured so far has been written (or dropped).
+   Returns immediately if there are no background threads.
+   @throws std::exception if a background thread failed to write an image
+   since the failure was last reported.  */
+  void Flush() const;
+
+  /** Reports statistics on the images captured so far.  */
+  ImageWriterStatistics GetStatistics() const;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -219,6 +341,10 @@ class ImageWriter : public LeafSystem<double> {
   friend class ImageWriterTester;
 #endif
 
+  // The queue of images waiting to be written, along with the threads that
+  // write them.
+  class WriteQueue;
+
   // Does the work of writing image indexed by `index` to the disk.
   template <PixelType kPixelType>
   void WriteImage(const Context<double>& context, int index) const;
@@ -268,6 +394,12 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  const ImageWriterParams params_;
+
+  // NOTE: This is declared last so that it is destroyed first; its destructor
+  // waits for the pending images to be written.
+  const std::unique_ptr<WriteQueue> queue_;
 };
 
 }  // namespace sensors
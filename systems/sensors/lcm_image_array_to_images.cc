@@ -1,5 +1,6 @@
 #include "drake/systems/sensors/lcm_image_array_to_images.h"
 
+#include <memory>
 #include <vector>
 
 #include <png.h>
@@ -13,6 +14,7 @@
 #include "drake/common/unused.h"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/lcm_image_traits.h"
+#include "drake/systems/sensors/shared_memory_image_ring.h"
 
 namespace drake {
 namespace systems {
@@ -169,7 +171,27 @@ bool DecompressZlib(const lcmt_image* lcm_image, Image<kPixelType>* image) {
 }
 
 template <PixelType kPixelType>
-bool UnpackLcmImage(const lcmt_image* lcm_image, Image<kPixelType>* image) {
+bool ReadSharedMemory(const lcmt_image* lcm_image,
+                      const internal::SharedMemoryImageReader& shared_memory,
+                      Image<kPixelType>* image) {
+  const int64_t num_bytes =
+      image->width() * image->height() * image->kPixelSize;
+  if (!shared_memory.Copy(lcm_image->data, image->at(0, 0), num_bytes)) {
+    // This is routine when a subscriber falls behind the publisher, so it is
+    // only a warning.
+    drake::log()->warn(
+        "Could not read incoming LCM image '{}' from shared memory",
+        lcm_image->header.frame_name);
+    *image = Image<kPixelType>();
+    return false;
+  }
+  return true;
+}
+
+template <PixelType kPixelType>
+bool UnpackLcmImage(const lcmt_image* lcm_image,
+                    const internal::SharedMemoryImageReader& shared_memory,
+                    Image<kPixelType>* image) {
   DRAKE_DEMAND(lcm_image->pixel_format ==
                LcmPixelTraits<Image<kPixelType>::kPixelFormat>::kPixelFormat);
   DRAKE_DEMAND(lcm_image->channel_type ==
@@ -191,6 +213,9 @@ bool UnpackLcmImage(const lcmt_image* lcm_image, Image<kPixelType>* image) {
     case lcmt_image::COMPRESSION_METHOD_PNG: {
       return DecompressPng(lcm_image, image);
     }
+    case lcmt_image::COMPRESSION_METHOD_SHARED_MEMORY: {
+      return ReadSharedMemory(lcm_image, shared_memory, image);
+    }
     default: {
       break;
     }
@@ -216,11 +241,14 @@ LcmImageArrayToImages::LcmImageArrayToImages()
       depth_image_output_port_index_(
           this->DeclareAbstractOutputPort(
                   "depth_image", &LcmImageArrayToImages::CalcDepthImage)
-              .get_index()) {
+              .get_index()),
+      shared_memory_(std::make_unique<internal::SharedMemoryImageReader>()) {
   // TODO(sammy-tri) Calculating our output ports can be kinda expensive.  We
   // should cache the images.
 }
 
+LcmImageArrayToImages::~LcmImageArrayToImages() = default;
+
 void LcmImageArrayToImages::CalcColorImage(const Context<double>& context,
                                            ImageRgba8U* color_image) const {
   const auto& images =
@@ -242,10 +270,10 @@ void LcmImageArrayToImages::CalcColorImage(const Context<double>& context,
 
   const bool has_alpha = image_has_alpha(lcm_image->pixel_format);
   if (has_alpha) {
-    UnpackLcmImage(lcm_image, color_image);
+    UnpackLcmImage(lcm_image, *shared_memory_, color_image);
   } else {
     ImageRgb8U rgb_image;
-    if (UnpackLcmImage(lcm_image, &rgb_image)) {
+    if (UnpackLcmImage(lcm_image, *shared_memory_, &rgb_image)) {
       color_image->resize(lcm_image->width, lcm_image->height);
       for (int x = 0; x < lcm_image->width; x++) {
         for (int y = 0; y < lcm_image->height; y++) {
@@ -300,10 +328,10 @@ void LcmImageArrayToImages::CalcDepthImage(const Context<double>& context,
   }
 
   if (is_32f) {
-    UnpackLcmImage(lcm_image, depth_image);
+    UnpackLcmImage(lcm_image, *shared_memory_, depth_image);
   } else {
     ImageDepth16U image_16u;
-    if (UnpackLcmImage(lcm_image, &image_16u)) {
+    if (UnpackLcmImage(lcm_image, *shared_memory_, &image_16u)) {
       depth_image->resize(lcm_image->width, lcm_image->height);
       for (int x = 0; x < lcm_image->width; x++) {
         for (int y = 0; y < lcm_image->height; y++) {
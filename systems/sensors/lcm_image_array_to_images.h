@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -9,6 +10,9 @@
 namespace drake {
 namespace systems {
 namespace sensors {
+namespace internal {
+class SharedMemoryImageReader;
+}  // namespace internal
 
 /// An LcmImageArrayToImages takes as input an AbstractValue containing a
 /// `Value<lcmt_image_array>` LCM message that defines an array
@@ -16,6 +20,13 @@ namespace sensors {
 /// an ImageRgba8U and one depth image as ImageDepth32F (intended to be
 /// similar to the API of RgbdCamera, though without the label image port).
 ///
+/// Images published through the @ref image_to_lcm_shared_memory
+/// "shared-memory transport" of ImageToLcmImageArrayT are read directly out of
+/// the publisher's shared memory, which must therefore be on this host. If an
+/// image has already been overwritten by the time it is read (i.e., this
+/// system has fallen too far behind the publisher), a warning is logged and
+/// the corresponding output image is empty.
+///
 /// @system
 /// name: LcmImageArrayToImages
 /// input_ports:
@@ -30,6 +41,8 @@ class LcmImageArrayToImages : public LeafSystem<double> {
 
   LcmImageArrayToImages();
 
+  ~LcmImageArrayToImages() override;
+
   // TODO(jwnimmer-tri) The "_t" or "T" suffix on this method name is
   // superfluous and should be removed.
   /// Returns the abstract valued input port that expects a
@@ -63,6 +76,7 @@ class LcmImageArrayToImages : public LeafSystem<double> {
   const InputPortIndex image_array_t_input_port_index_{};
   const OutputPortIndex color_image_output_port_index_{};
   const OutputPortIndex depth_image_output_port_index_{};
+  const std::unique_ptr<internal::SharedMemoryImageReader> shared_memory_;
 };
 
 }  // namespace sensors
@@ -17,6 +17,12 @@ using geometry::render::ColorRenderCamera;
 using geometry::render::DepthRenderCamera;
 using math::RigidTransformd;
 
+struct RgbdSensor::RenderedImages {
+  ImageRgba8U color;
+  ImageDepth32F depth;
+  ImageLabel16I label;
+};
+
 RgbdSensor::RgbdSensor(FrameId parent_id, const RigidTransformd& X_PB,
                        const DepthRenderCamera& depth_camera,
                        bool show_color_window)
@@ -54,6 +60,16 @@ RgbdSensor::RgbdSensor(FrameId parent_id, const RigidTransformd& X_PB,
   label_image_port_ = &this->DeclareAbstractOutputPort(
       "label_image", label_image, &RgbdSensor::CalcLabelImage);
 
+  // The images are only allocated when the cache entry is first evaluated,
+  // i.e., when the render calls are batched, so that the default model
+  // value costs nothing otherwise.
+  rendered_images_cache_index_ =
+      this->DeclareCacheEntry(
+              "rendered_images", RenderedImages{},
+              &RgbdSensor::CalcRenderedImages,
+              {this->input_port_ticket(query_object_input_port_->get_index())})
+          .cache_index();
+
   body_pose_in_world_output_port_ = &this->DeclareAbstractOutputPort(
       "body_pose_in_world", &RgbdSensor::CalcX_WB);
 
@@ -103,8 +119,48 @@ const OutputPort<double>& RgbdSensor::image_time_output_port() const {
   return *image_time_output_port_;
 }
 
+void RgbdSensor::CalcRenderedImages(const Context<double>& context,
+                                    RenderedImages* images) const {
+  const CameraInfo& color_intrinsics = color_camera_.core().intrinsics();
+  const CameraInfo& depth_intrinsics = depth_camera_.core().intrinsics();
+  if (images->color.width() != color_intrinsics.width() ||
+      images->color.height() != color_intrinsics.height()) {
+    images->color.resize(color_intrinsics.width(), color_intrinsics.height());
+    images->label.resize(color_intrinsics.width(), color_intrinsics.height());
+  }
+  if (images->depth.width() != depth_intrinsics.width() ||
+      images->depth.height() != depth_intrinsics.height()) {
+    images->depth.resize(depth_intrinsics.width(), depth_intrinsics.height());
+  }
+  const QueryObject<double>& query_object = get_query_object(context);
+  // The color and label images are rendered from X_PB * X_BC and the depth
+  // image from X_PB * X_BD; they can only share a call when those coincide.
+  if (X_BC().IsExactlyEqualTo(X_BD())) {
+    query_object.RenderImages(color_camera_, depth_camera_, parent_frame_id_,
+                              X_PB_ * X_BC(), &images->color, &images->depth,
+                              &images->label);
+  } else {
+    query_object.RenderImages(color_camera_, depth_camera_, parent_frame_id_,
+                              X_PB_ * X_BC(), &images->color, nullptr,
+                              &images->label);
+    query_object.RenderImages(color_camera_, depth_camera_, parent_frame_id_,
+                              X_PB_ * X_BD(), nullptr, &images->depth,
+                              nullptr);
+  }
+}
+
+const RgbdSensor::RenderedImages& RgbdSensor::EvalRenderedImages(
+    const Context<double>& context) const {
+  return this->get_cache_entry(rendered_images_cache_index_)
+      .Eval<RenderedImages>(context);
+}
+
 void RgbdSensor::CalcColorImage(const Context<double>& context,
                                 ImageRgba8U* color_image) const {
+  if (batch_image_renders_) {
+    *color_image = EvalRenderedImages(context).color;
+    return;
+  }
   const QueryObject<double>& query_object = get_query_object(context);
   query_object.RenderColorImage(
       color_camera_, parent_frame_id_,
@@ -113,6 +169,10 @@ void RgbdSensor::CalcColorImage(const Context<double>& context,
 
 void RgbdSensor::CalcDepthImage32F(const Context<double>& context,
                                    ImageDepth32F* depth_image) const {
+  if (batch_image_renders_) {
+    *depth_image = EvalRenderedImages(context).depth;
+    return;
+  }
   const QueryObject<double>& query_object = get_query_object(context);
   query_object.RenderDepthImage(
       depth_camera_, parent_frame_id_,
@@ -121,6 +181,10 @@ void RgbdSensor::CalcDepthImage32F(const Context<double>& context,
 
 void RgbdSensor::CalcDepthImage16U(const Context<double>& context,
                                    ImageDepth16U* depth_image) const {
+  if (batch_image_renders_) {
+    ConvertDepth32FTo16U(EvalRenderedImages(context).depth, depth_image);
+    return;
+  }
   ImageDepth32F depth32(depth_image->width(), depth_image->height());
   CalcDepthImage32F(context, &depth32);
   ConvertDepth32FTo16U(depth32, depth_image);
@@ -128,6 +192,10 @@ void RgbdSensor::CalcDepthImage16U(const Context<double>& context,
 
 void RgbdSensor::CalcLabelImage(const Context<double>& context,
                                 ImageLabel16I* label_image) const {
+  if (batch_image_renders_) {
+    *label_image = EvalRenderedImages(context).label;
+    return;
+  }
   const QueryObject<double>& query_object = get_query_object(context);
   query_object.RenderLabelImage(
       color_camera_, parent_frame_id_,
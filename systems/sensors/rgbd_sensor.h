@@ -147,6 +147,28 @@ class RgbdSensor final : public LeafSystem<double> {
   /** Returns the id of the frame to which the body is affixed.  */
   geometry::FrameId parent_frame_id() const { return parent_frame_id_; }
 
+  /** Sets whether the sensor batches the render calls for its color, depth,
+   and label images. By default (`false`), each image output port renders its
+   own image on demand. When `true`, evaluating any of the image output ports
+   requests all three images with a single call to
+   geometry::QueryObject::RenderImages() and caches them, so the remaining
+   image ports (including both depth ports) are served without another call.
+
+   This only batches the calls; it is not a multiple-render-target pass. The
+   render engine still draws each image type in its own pass, and what is
+   saved is the per-call overhead (the camera pose update and the engine's
+   per-request setup). It is profitable when most of the image ports are
+   consumed (e.g., all published or logged every time step), but wasteful when
+   only one of them is. The cached images are only allocated once a batched
+   call first renders them.  */
+  void set_batch_image_renders(bool batch_image_renders) {
+    batch_image_renders_ = batch_image_renders;
+  }
+
+  /** Reports whether the sensor batches the render calls for its images. See
+   set_batch_image_renders().  */
+  bool batch_image_renders() const { return batch_image_renders_; }
+
   /** Returns the geometry::QueryObject<double>-valued input port.  */
   const InputPort<double>& query_object_input_port() const;
 
@@ -185,6 +207,16 @@ class RgbdSensor final : public LeafSystem<double> {
                          ImageDepth16U* depth_image) const;
   void CalcLabelImage(const Context<double>& context,
                       ImageLabel16I* label_image) const;
+  // The images rendered by one batched call in CalcRenderedImages().
+  struct RenderedImages;
+
+  // The calculator method for the cache entry that requests all of the images
+  // with one call.
+  void CalcRenderedImages(const Context<double>& context,
+                          RenderedImages* images) const;
+  const RenderedImages& EvalRenderedImages(
+      const Context<double>& context) const;
+
   void CalcX_WB(const Context<double>& context,
                 math::RigidTransformd* X_WB) const;
   void CalcImageTime(const Context<double>&, BasicVector<double>*) const;
@@ -213,6 +245,9 @@ class RgbdSensor final : public LeafSystem<double> {
   const geometry::render::DepthRenderCamera depth_camera_;
   // The position of the camera's B frame relative to its parent frame P.
   const math::RigidTransformd X_PB_;
+
+  bool batch_image_renders_{false};
+  CacheIndex rendered_images_cache_index_;
 };
 
 }  // namespace sensors
@@ -0,0 +1,341 @@
+#include "drake/systems/sensors/shared_memory_image_ring.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace internal {
+namespace {
+
+constexpr uint64_t kMagic = 0x6472616b65696d67;  // "drakeimg"
+constexpr int64_t kCacheLine = 64;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Shared-memory synchronization requires lock-free atomics.");
+
+// The fixed-size leading part of a descriptor; the segment name follows it.
+struct DescriptorPrefix {
+  uint64_t instance;
+  uint64_t position;
+  int64_t size;
+};
+
+int64_t RoundUpToCacheLine(int64_t value) {
+  return (value + kCacheLine - 1) / kCacheLine * kCacheLine;
+}
+
+// The start of every segment; the ring itself follows at kRingOffset.
+//
+// The writer publishes a block occupying the unwrapped byte range
+// [position, position + size) by first advancing `begin` to position + size
+// (announcing that everything before position + size - capacity may now be
+// clobbered), then copying the data, then advancing `end` to match. A reader
+// holding that block's descriptor copies it out and afterwards checks that
+// `begin` has not moved past position + capacity; this is a seqlock spread
+// over the whole ring.
+struct SegmentHeader {
+  uint64_t magic;
+  uint64_t instance;
+  // The process id of the writer, used to tell whether a segment whose name we
+  // want to reuse has been abandoned.
+  int64_t pid;
+  int64_t capacity;
+  std::atomic<uint64_t> begin;
+  std::atomic<uint64_t> end;
+};
+
+constexpr int64_t kRingOffset = 128;
+static_assert(sizeof(SegmentHeader) <= kRingOffset);
+
+// The writer that created a segment, as recorded in its header.
+struct SegmentOwner {
+  uint64_t instance;
+  int64_t pid;
+};
+
+// Returns the owner of the segment currently bound to `segment_name`, or
+// nullopt if there is no such segment or it doesn't (yet) hold our header.
+std::optional<SegmentOwner> ReadSegmentOwner(const std::string& segment_name) {
+  const int fd = ::shm_open(segment_name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return std::nullopt;
+  }
+  struct stat status {};
+  void* address = MAP_FAILED;
+  if (::fstat(fd, &status) == 0 && status.st_size >= kRingOffset) {
+    address = ::mmap(nullptr, kRingOffset, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    return std::nullopt;
+  }
+  const SegmentHeader& header = *static_cast<const SegmentHeader*>(address);
+  std::optional<SegmentOwner> result;
+  if (header.magic == kMagic) {
+    result = SegmentOwner{.instance = header.instance, .pid = header.pid};
+  }
+  ::munmap(address, kRingOffset);
+  return result;
+}
+
+// Returns true unless the process `pid` is known not to exist.
+bool IsProcessAlive(int64_t pid) {
+  return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+}
+
+}  // namespace
+
+SharedMemoryImageWriter::SharedMemoryImageWriter(std::string segment_name,
+                                                 int64_t capacity)
+    : segment_name_(std::move(segment_name)) {
+  if (segment_name_.size() < 2 || segment_name_[0] != '/' ||
+      segment_name_.find('/', 1) != std::string::npos) {
+    throw std::logic_error(fmt::format(
+        "SharedMemoryImageWriter: the segment name '{}' must start with '/' "
+        "and contain no other '/'",
+        segment_name_));
+  }
+  if (capacity <= 0) {
+    throw std::logic_error(fmt::format(
+        "SharedMemoryImageWriter: the capacity ({}) must be positive",
+        capacity));
+  }
+  capacity_ = RoundUpToCacheLine(capacity);
+  instance_ = (static_cast<uint64_t>(std::random_device{}()) << 32) ^
+              std::random_device{}() ^ static_cast<uint64_t>(::getpid());
+  mapped_size_ = kRingOffset + capacity_;
+
+  int fd = ::shm_open(segment_name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0 && errno == EEXIST) {
+    // The name is taken. We only reclaim it from a writer that exited without
+    // unlinking it (e.g., because it crashed); anything else is left alone.
+    const std::optional<SegmentOwner> owner = ReadSegmentOwner(segment_name_);
+    if (!owner.has_value()) {
+      throw std::runtime_error(fmt::format(
+          "SharedMemoryImageWriter: the segment '{}' already exists and does "
+          "not hold images",
+          segment_name_));
+    }
+    if (IsProcessAlive(owner->pid)) {
+      throw std::runtime_error(fmt::format(
+          "SharedMemoryImageWriter: the segment '{}' is in use by the writer "
+          "in process {}",
+          segment_name_, owner->pid));
+    }
+    // Unlink the stale segment rather than truncating it, so that readers
+    // still mapping it don't fault; they'll notice the new instance and remap.
+    ::shm_unlink(segment_name_.c_str());
+    fd = ::shm_open(segment_name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  }
+  if (fd < 0) {
+    throw std::runtime_error(
+        fmt::format("SharedMemoryImageWriter: could not create '{}': {}",
+                    segment_name_, std::strerror(errno)));
+  }
+  void* address = MAP_FAILED;
+  if (::ftruncate(fd, mapped_size_) == 0) {
+    address = ::mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+  }
+  const int error = errno;
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    ::shm_unlink(segment_name_.c_str());
+    throw std::runtime_error(
+        fmt::format("SharedMemoryImageWriter: could not map '{}': {}",
+                    segment_name_, std::strerror(error)));
+  }
+
+  segment_ = address;
+  new (segment_) SegmentHeader{.magic = kMagic,
+                               .instance = instance_,
+                               .pid = ::getpid(),
+                               .capacity = capacity_,
+                               .begin = 0,
+                               .end = 0};
+  ring_ = static_cast<uint8_t*>(address) + kRingOffset;
+}
+
+SharedMemoryImageWriter::~SharedMemoryImageWriter() {
+  ::munmap(segment_, mapped_size_);
+  // If the name has since been bound to another writer's segment, it's not
+  // ours to remove.
+  const std::optional<SegmentOwner> owner = ReadSegmentOwner(segment_name_);
+  if (owner.has_value() && owner->instance == instance_) {
+    ::shm_unlink(segment_name_.c_str());
+  }
+}
+
+void SharedMemoryImageWriter::Write(const void* data, int64_t size,
+                                    std::vector<uint8_t>* descriptor) const {
+  DRAKE_DEMAND(descriptor != nullptr);
+  if (size < 0 || size > capacity_) {
+    throw std::logic_error(fmt::format(
+        "SharedMemoryImageWriter: cannot write {} bytes into the {}-byte "
+        "segment '{}'; increase its capacity",
+        size, capacity_, segment_name_));
+  }
+
+  SegmentHeader& header = *static_cast<SegmentHeader*>(segment_);
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Blocks start on a cache line and never straddle the end of the ring.
+  uint64_t position = RoundUpToCacheLine(header.end.load());
+  const int64_t offset = position % capacity_;
+  if (offset + size > capacity_) {
+    position += capacity_ - offset;
+  }
+  const uint64_t new_end = position + size;
+  header.begin.store(new_end, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(ring_ + position % capacity_, data, size);
+  header.end.store(new_end, std::memory_order_release);
+
+  const DescriptorPrefix prefix{
+      .instance = instance_, .position = position, .size = size};
+  descriptor->resize(sizeof(prefix) + segment_name_.size());
+  std::memcpy(descriptor->data(), &prefix, sizeof(prefix));
+  std::memcpy(descriptor->data() + sizeof(prefix), segment_name_.data(),
+              segment_name_.size());
+}
+
+struct SharedMemoryImageReader::Mapping {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Mapping)
+
+  Mapping(void* address_in, int64_t mapped_size_in)
+      : address(address_in), mapped_size(mapped_size_in) {}
+
+  ~Mapping() { ::munmap(address, mapped_size); }
+
+  const SegmentHeader& header() const {
+    return *static_cast<const SegmentHeader*>(address);
+  }
+
+  const uint8_t* ring() const {
+    return static_cast<const uint8_t*>(address) + kRingOffset;
+  }
+
+  void* const address;
+  const int64_t mapped_size;
+};
+
+SharedMemoryImageReader::SharedMemoryImageReader() = default;
+
+SharedMemoryImageReader::~SharedMemoryImageReader() = default;
+
+const SharedMemoryImageReader::Mapping* SharedMemoryImageReader::GetMapping(
+    const std::string& segment_name, uint64_t instance) const {
+  std::unique_ptr<Mapping>& mapping = mappings_[segment_name];
+  if (mapping != nullptr && mapping->header().instance == instance) {
+    return mapping.get();
+  }
+
+  // Either we've never seen this segment, or its writer has been replaced
+  // since we mapped it.
+  mapping.reset();
+  const int fd = ::shm_open(segment_name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    // This is expected when the writer has gone away, so we don't report it
+    // as an error.
+    log()->debug("Could not open the shared-memory image segment '{}': {}",
+                 segment_name, std::strerror(errno));
+    return nullptr;
+  }
+  struct stat status {};
+  void* address = MAP_FAILED;
+  if (::fstat(fd, &status) == 0 && status.st_size >= kRingOffset) {
+    address = ::mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    log()->error("Could not map the shared-memory image segment '{}'",
+                 segment_name);
+    return nullptr;
+  }
+  mapping = std::make_unique<Mapping>(address, status.st_size);
+  const SegmentHeader& header = mapping->header();
+  if (header.magic != kMagic ||
+      kRingOffset + header.capacity != mapping->mapped_size) {
+    log()->error("The shared-memory segment '{}' does not hold images",
+                 segment_name);
+    mapping.reset();
+    return nullptr;
+  }
+  if (header.instance != instance) {
+    // The message refers to a writer that no longer exists.
+    return nullptr;
+  }
+  return mapping.get();
+}
+
+bool SharedMemoryImageReader::Visit(
+    const std::vector<uint8_t>& descriptor,
+    const std::function<void(const uint8_t*, int64_t)>& visitor) const {
+  DescriptorPrefix prefix;
+  if (descriptor.size() <= sizeof(prefix)) {
+    log()->error("Malformed shared-memory image descriptor");
+    return false;
+  }
+  std::memcpy(&prefix, descriptor.data(), sizeof(prefix));
+  const std::string segment_name(descriptor.begin() + sizeof(prefix),
+                                 descriptor.end());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const Mapping* mapping = GetMapping(segment_name, prefix.instance);
+  if (mapping == nullptr) {
+    return false;
+  }
+  const SegmentHeader& header = mapping->header();
+  const int64_t capacity = header.capacity;
+  if (prefix.size < 0 || prefix.size > capacity ||
+      static_cast<int64_t>(prefix.position % capacity) + prefix.size >
+          capacity) {
+    log()->error("Malformed shared-memory image descriptor");
+    return false;
+  }
+  const uint64_t limit = prefix.position + capacity;
+  if (header.end.load(std::memory_order_acquire) <
+          prefix.position + prefix.size ||
+      header.begin.load(std::memory_order_relaxed) > limit) {
+    return false;
+  }
+  visitor(mapping->ring() + prefix.position % capacity, prefix.size);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return header.begin.load(std::memory_order_relaxed) <= limit;
+}
+
+bool SharedMemoryImageReader::Copy(const std::vector<uint8_t>& descriptor,
+                                   void* dest, int64_t size) const {
+  bool size_matches = false;
+  const bool intact =
+      Visit(descriptor, [&](const uint8_t* data, int64_t data_size) {
+        size_matches = (data_size == size);
+        if (size_matches) {
+          std::memcpy(dest, data, size);
+        }
+      });
+  return intact && size_matches;
+}
+
+}  // namespace internal
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace internal {
+
+/* Writes image data into a POSIX shared-memory segment that is organized as a
+ ring buffer, so that processes on the same host can read the pixels in place
+ instead of receiving them inside an LCM message.
+
+ Each call to Write() appends one contiguous block to the ring (skipping ahead
+ to the start of the ring rather than splitting a block) and produces a small
+ descriptor -- the segment name, an identifier of this writer, and the block's
+ position and size -- which is what gets published over LCM. Blocks are never
+ locked; once the writer has wrapped around and overwritten a block, readers of
+ a stale descriptor detect that and fail (see SharedMemoryImageReader). The
+ capacity should therefore comfortably exceed the number of bytes published in
+ the time it takes a consumer to process a message.
+
+ The segment is created on construction and unlinked on destruction (unless
+ its name has since been taken over by another writer). A segment of the same
+ name is only replaced if the process that wrote it has exited. This class is
+ thread safe.  */
+class SharedMemoryImageWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SharedMemoryImageWriter)
+
+  /* Creates the segment.
+   @param segment_name The POSIX shared-memory name, e.g., "/drake_images". It
+   must start with a '/' and contain no other '/'.
+   @param capacity The size of the ring in bytes; it is rounded up to a whole
+   number of cache lines.
+   @throws std::exception if the name or capacity is invalid, if a segment of
+   the same name exists and its writer's process is still running (or it does
+   not hold images), or if the segment can't otherwise be created.  */
+  SharedMemoryImageWriter(std::string segment_name, int64_t capacity);
+
+  ~SharedMemoryImageWriter();
+
+  const std::string& segment_name() const { return segment_name_; }
+
+  int64_t capacity() const { return capacity_; }
+
+  /* Copies `size` bytes starting at `data` into the ring and overwrites
+   `descriptor` with the bytes that identify them.
+   @throws std::exception if `size` exceeds the capacity.  */
+  void Write(const void* data, int64_t size,
+             std::vector<uint8_t>* descriptor) const;
+
+ private:
+  const std::string segment_name_;
+  int64_t capacity_{};
+  uint64_t instance_{};
+  int64_t mapped_size_{};
+  // The start of the mapped segment, and the ring buffer within it.
+  void* segment_{};
+  uint8_t* ring_{};
+  mutable std::mutex mutex_;
+};
+
+/* Reads the blocks written by a SharedMemoryImageWriter (possibly in another
+ process) given their descriptors. Segments are mapped read-only on first use
+ and stay mapped for the lifetime of the reader; a segment that has since been
+ recreated by a new writer is remapped automatically. This class is thread
+ safe.  */
+class SharedMemoryImageReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SharedMemoryImageReader)
+
+  SharedMemoryImageReader();
+
+  ~SharedMemoryImageReader();
+
+  /* Calls `visitor` with a pointer to the block named by `descriptor`, in
+   place in shared memory, and its size. Returns true if the block was intact
+   for the duration of the call. Returns false if the descriptor is malformed,
+   the segment can't be mapped, or the block has already been (or was, during
+   the call) overwritten by the writer; in the last case `visitor` may have
+   been called with torn data, and anything it computed must be discarded.  */
+  bool Visit(
+      const std::vector<uint8_t>& descriptor,
+      const std::function<void(const uint8_t* data, int64_t size)>& visitor)
+      const;
+
+  /* Copies the block named by `descriptor` into `dest`, which must have room
+   for exactly `size` bytes. Returns false (leaving `dest` unspecified) under
+   the same conditions as Visit(), or if the block's size differs from
+   `size`.  */
+  bool Copy(const std::vector<uint8_t>& descriptor, void* dest,
+            int64_t size) const;
+
+ private:
+  struct Mapping;
+
+  // Returns the mapping of the named segment for the given writer instance,
+  // (re)mapping it if necessary, or nullptr on failure.
+  const Mapping* GetMapping(const std::string& segment_name,
+                            uint64_t instance) const;
+
+  mutable std::mutex mutex_;
+  mutable std::map<std::string, std::unique_ptr<Mapping>> mappings_;
+};
+
+}  // namespace internal
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
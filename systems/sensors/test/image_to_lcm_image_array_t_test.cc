@@ -1,7 +1,11 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
+#include <unistd.h>
+
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/image.h"
 
@@ -109,6 +113,24 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
       &dut_uncompressed, color_image, depth_image, label_image);
   Verify(dut_uncompressed, image_array_t_uncompressed,
          lcmt_image::COMPRESSION_METHOD_NOT_COMPRESSED);
+
+  ImageToLcmImageArrayT dut_shared_memory(kColorFrameName, kDepthFrameName,
+                                          kLabelFrameName, true);
+  dut_shared_memory.UseSharedMemory(
+      fmt::format("/drake_image_to_lcm_test_{}", ::getpid()), 4096);
+  auto image_array_t_shared_memory = SetUpInputAndOutput(
+      &dut_shared_memory, color_image, depth_image, label_image);
+  Verify(dut_shared_memory, image_array_t_shared_memory,
+         lcmt_image::COMPRESSION_METHOD_SHARED_MEMORY);
+}
+
+GTEST_TEST(ImageToLcmImageArrayT, UseSharedMemoryTwice) {
+  ImageToLcmImageArrayT dut;
+  const std::string name =
+      fmt::format("/drake_image_to_lcm_test_twice_{}", ::getpid());
+  dut.UseSharedMemory(name, 4096);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.UseSharedMemory(name, 4096),
+                              ".*already writes to.*");
 }
 
 }  // namespace
@@ -4,8 +4,11 @@
 
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <vtkImageData.h>
@@ -275,8 +278,8 @@ class ImageWriterTest : public ::testing::Test {
   }
 
   template <PixelType kPixelType>
-  static void TestWritingImageOnPort() {
-    ImageWriter writer;
+  static void TestWritingImageOnPort(const ImageWriterParams& params = {}) {
+    ImageWriter writer(params);
     ImageWriterTester tester(writer);
 
     // Values for port declaration.
@@ -301,11 +304,18 @@ class ImageWriterTest : public ::testing::Test {
     fs::path expected_file(expected_name);
     EXPECT_FALSE(fs::exists(expected_file));
     writer.Publish(*context, events->get_publish_events());
+    // With background threads, the file may not have been written yet.
+    writer.Flush();
     EXPECT_TRUE(fs::exists(expected_file));
     EXPECT_EQ(1, tester.port_count(port.get_index()));
     add_file_for_cleanup(expected_file.string());
+    EXPECT_EQ(writer.GetStatistics().num_written, 1);
 
     EXPECT_TRUE(MatchesFileOnDisk(expected_name, image));
+
+    // Removes the file so that the same image can be written again by a
+    // subsequent invocation with different params.
+    fs::remove(expected_file);
   }
 
  private:
@@ -699,6 +709,156 @@ TEST_F(ImageWriterTest, WritesGreyImage) {
   TestWritingImageOnPort<PixelType::kGrey8U>();
 }
 
+TEST_F(ImageWriterTest, ParamsErrors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter({.num_threads = -1}),
+                              ".*num_threads must be non-negative.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter({.max_queue_size = 0}),
+                              ".*max_queue_size must be positive.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter({.compression_level = -2}),
+                              ".*compression_level must be in.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter({.compression_level = 10}),
+                              ".*compression_level must be in.*");
+}
+
+// Images written by background threads are the same as those written
+// synchronously.
+TEST_F(ImageWriterTest, WritesImagesInBackground) {
+  const ImageWriterParams params{.num_threads = 2};
+  TestWritingImageOnPort<PixelType::kRgba8U>(params);
+  TestWritingImageOnPort<PixelType::kLabel16I>(params);
+  TestWritingImageOnPort<PixelType::kDepth32F>(params);
+  TestWritingImageOnPort<PixelType::kDepth16U>(params);
+  TestWritingImageOnPort<PixelType::kGrey8U>(params);
+}
+
+// Every compression level produces the same image.
+TEST_F(ImageWriterTest, CompressionLevel) {
+  for (int level : {-1, 0, 1, 9}) {
+    SCOPED_TRACE(fmt::format("compression_level = {}", level));
+    const ImageWriterParams params{.compression_level = level};
+    TestWritingImageOnPort<PixelType::kRgba8U>(params);
+    TestWritingImageOnPort<PixelType::kDepth32F>(params);
+  }
+}
+
+// Publishes a burst of images into a small queue, with both policies for a
+// full queue, and confirms the statistics account for every image.
+TEST_F(ImageWriterTest, QueuePolicies) {
+  for (bool drop_oldest : {false, true}) {
+    SCOPED_TRACE(fmt::format("drop_oldest_when_full = {}", drop_oldest));
+    ImageWriter writer({.num_threads = 1,
+                        .max_queue_size = 2,
+                        .drop_oldest_when_full = drop_oldest});
+    ImageWriterTester tester(writer);
+    fs::path path(temp_dir());
+    path.append(fmt::format("queue_policy_{}_{{count}}", drop_oldest));
+    const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+        "port", path.string(), 0.1, 0.0);
+    auto events = writer.AllocateCompositeEventCollection();
+    auto context = writer.AllocateContext();
+    const ImageRgba8U image = test_image<PixelType::kRgba8U>();
+    port.FixValue(context.get(), image);
+    writer.CalcNextUpdateTime(*context, events.get());
+
+    const int kNumImages = 20;
+    std::vector<std::string> file_names;
+    for (int i = 0; i < kNumImages; ++i) {
+      file_names.push_back(tester.MakeFileName(
+          tester.port_format(port.get_index()), PixelType::kRgba8U,
+          context->get_time(), "port", i));
+      add_file_for_cleanup(file_names.back());
+      writer.Publish(*context, events->get_publish_events());
+    }
+    writer.Flush();
+
+    const ImageWriterStatistics statistics = writer.GetStatistics();
+    EXPECT_EQ(statistics.num_submitted, kNumImages);
+    EXPECT_EQ(statistics.num_written + statistics.num_dropped, kNumImages);
+    EXPECT_EQ(statistics.queue_size, 0);
+    EXPECT_LE(statistics.peak_queue_size, 2);
+    EXPECT_GT(statistics.total_write_time, 0);
+    EXPECT_GE(statistics.total_write_time, statistics.max_write_time);
+    int num_files = 0;
+    for (const std::string& file_name : file_names) {
+      if (fs::exists(file_name)) {
+        ++num_files;
+        EXPECT_TRUE(MatchesFileOnDisk(file_name, image));
+      }
+    }
+    EXPECT_EQ(num_files, statistics.num_written);
+    if (drop_oldest) {
+      EXPECT_EQ(statistics.total_blocked_time, 0);
+      // The most recent image is never dropped.
+      EXPECT_TRUE(fs::exists(file_names.back()));
+    } else {
+      EXPECT_EQ(statistics.num_dropped, 0);
+    }
+  }
+}
+
+// Destroying the writer writes the images remaining in its queue.
+TEST_F(ImageWriterTest, DestructorFlushes) {
+  fs::path path(temp_dir());
+  path.append("destructor_{count}");
+  std::vector<std::string> file_names;
+  {
+    auto writer = std::make_unique<ImageWriter>(
+        ImageWriterParams{.num_threads = 1, .max_queue_size = 10});
+    ImageWriterTester tester(*writer);
+    const auto& port = writer->DeclareImageInputPort<PixelType::kRgba8U>(
+        "port", path.string(), 0.1, 0.0);
+    auto events = writer->AllocateCompositeEventCollection();
+    auto context = writer->AllocateContext();
+    port.FixValue(context.get(), test_image<PixelType::kRgba8U>());
+    writer->CalcNextUpdateTime(*context, events.get());
+    for (int i = 0; i < 5; ++i) {
+      file_names.push_back(tester.MakeFileName(
+          tester.port_format(port.get_index()), PixelType::kRgba8U,
+          context->get_time(), "port", i));
+      add_file_for_cleanup(file_names.back());
+      writer->Publish(*context, events->get_publish_events());
+    }
+  }
+  for (const std::string& file_name : file_names) {
+    EXPECT_TRUE(fs::exists(file_name)) << file_name;
+  }
+}
+
+// A failure to write an image on a background thread is rethrown by the next
+// publish event or Flush(), rather than terminating the program.
+TEST_F(ImageWriterTest, BackgroundWriteFailure) {
+  fs::path dir(temp_dir());
+  dir.append("write_failure");
+  ASSERT_TRUE(fs::create_directory(dir));
+  ImageWriter writer({.num_threads = 1});
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      "port", (dir / "{count}").string(), 0.1, 0.0);
+  auto events = writer.AllocateCompositeEventCollection();
+  auto context = writer.AllocateContext();
+  port.FixValue(context.get(), test_image<PixelType::kRgba8U>());
+  writer.CalcNextUpdateTime(*context, events.get());
+
+  // The directory disappears after the port was declared.
+  fs::remove(dir);
+  writer.Publish(*context, events->get_publish_events());
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.Flush(), ".*failed to write.*");
+  // The failure is only reported once.
+  EXPECT_NO_THROW(writer.Flush());
+  EXPECT_EQ(writer.GetStatistics().num_written, 0);
+
+  EXPECT_EQ(writer.GetStatistics().num_failed, 1);
+
+  // A publish event that finds a failure pending rethrows it.
+  writer.Publish(*context, events->get_publish_events());
+  while (writer.GetStatistics().num_failed < 2) {
+    std::this_thread::yield();
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      writer.Publish(*context, events->get_publish_events()),
+      ".*failed to write.*");
+  EXPECT_EQ(writer.GetStatistics().num_submitted, 2);
+}
+
 // Evaluate the stand-alone test for color images.
 TEST_F(ImageWriterTest, SaveToPng_Color) {
   ImageRgba8U color_image = test_image<PixelType::kRgba8U>();
@@ -1,13 +1,17 @@
 #include "drake/systems/sensors/lcm_image_array_to_images.h"
 
+#include <unistd.h>
+
 #include <fstream>
 #include <memory>
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/image.h"
+#include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
 namespace drake {
 namespace systems {
@@ -120,6 +124,104 @@ GTEST_TEST(LcmImageArrayToImagesTest, PngTest) {
   EXPECT_EQ(depth_image.size(), 32 * 32);
 }
 
+GTEST_TEST(LcmImageArrayToImagesTest, SharedMemoryTest) {
+  const int width = 6;
+  const int height = 4;
+  ImageRgba8U color_image(width, height);
+  ImageDepth32F depth_image(width, height);
+  const ImageLabel16I label_image(width, height);
+  for (int x = 0; x < width; ++x) {
+    for (int y = 0; y < height; ++y) {
+      for (int c = 0; c < 4; ++c) {
+        color_image.at(x, y)[c] = 10 * x + y + c;
+      }
+      depth_image.at(x, y)[0] = 0.5f * x + 0.25f * y;
+    }
+  }
+
+  // Publish the images through a ring that holds exactly one set of images
+  // (each padded to whole cache lines).
+  ImageToLcmImageArrayT publisher("color", "depth", "label");
+  publisher.UseSharedMemory(
+      fmt::format("/drake_lcm_image_test_{}", ::getpid()), 128 + 128 + 64);
+  auto publisher_context = publisher.CreateDefaultContext();
+  publisher.color_image_input_port().FixValue(publisher_context.get(),
+                                              color_image);
+  publisher.depth_image_input_port().FixValue(publisher_context.get(),
+                                              depth_image);
+  publisher.label_image_input_port().FixValue(publisher_context.get(),
+                                              label_image);
+  const lcmt_image_array lcm_images =
+      publisher.image_array_t_msg_output_port().Eval<lcmt_image_array>(
+          *publisher_context);
+  for (const lcmt_image& lcm_image : lcm_images.images) {
+    EXPECT_EQ(lcm_image.compression_method,
+              lcmt_image::COMPRESSION_METHOD_SHARED_MEMORY);
+    // Only the descriptor is carried in the message.
+    EXPECT_LT(lcm_image.size, 64);
+  }
+
+  LcmImageArrayToImages dut;
+  ImageRgba8U decoded_color_image;
+  ImageDepth32F decoded_depth_image;
+  DecodeImageArray(&dut, lcm_images, &decoded_color_image,
+                   &decoded_depth_image);
+  EXPECT_EQ(decoded_color_image, color_image);
+  EXPECT_EQ(decoded_depth_image, depth_image);
+
+  // Once the publisher has moved on far enough to overwrite the images, the
+  // stale message decodes to empty images.
+  color_image.at(0, 0)[0] = 255;
+  publisher.color_image_input_port().FixValue(publisher_context.get(),
+                                              color_image);
+  publisher.image_array_t_msg_output_port().Eval<lcmt_image_array>(
+      *publisher_context);
+  DecodeImageArray(&dut, lcm_images, &decoded_color_image,
+                   &decoded_depth_image);
+  EXPECT_EQ(decoded_color_image.size(), 0);
+  EXPECT_EQ(decoded_depth_image.size(), 0);
+}
+
+// Checks that images whose pixels span more than one byte per channel are
+// read back out of shared memory in full; 16-bit depth images are converted
+// to meters in the output.
+GTEST_TEST(LcmImageArrayToImagesTest, SharedMemoryDepth16UTest) {
+  const int width = 6;
+  const int height = 4;
+  ImageDepth16U depth_image(width, height);
+  ImageDepth32F expected_depth_image(width, height);
+  for (int x = 0; x < width; ++x) {
+    for (int y = 0; y < height; ++y) {
+      depth_image.at(x, y)[0] = 1000 * x + 250 * y;
+      expected_depth_image.at(x, y)[0] = x + 0.25f * y;
+    }
+  }
+
+  ImageToLcmImageArrayT publisher;
+  const InputPort<double>& depth_image_input_port =
+      publisher.DeclareImageInputPort<PixelType::kDepth16U>("depth");
+  publisher.UseSharedMemory(
+      fmt::format("/drake_lcm_image_16u_test_{}", ::getpid()), 256);
+  auto publisher_context = publisher.CreateDefaultContext();
+  depth_image_input_port.FixValue(publisher_context.get(), depth_image);
+  const lcmt_image_array lcm_images =
+      publisher.image_array_t_msg_output_port().Eval<lcmt_image_array>(
+          *publisher_context);
+  ASSERT_EQ(lcm_images.num_images, 1);
+  EXPECT_EQ(lcm_images.images[0].compression_method,
+            lcmt_image::COMPRESSION_METHOD_SHARED_MEMORY);
+  EXPECT_EQ(lcm_images.images[0].channel_type,
+            lcmt_image::CHANNEL_TYPE_UINT16);
+
+  LcmImageArrayToImages dut;
+  ImageRgba8U decoded_color_image;
+  ImageDepth32F decoded_depth_image;
+  DecodeImageArray(&dut, lcm_images, &decoded_color_image,
+                   &decoded_depth_image);
+  EXPECT_EQ(decoded_color_image.size(), 0);
+  EXPECT_EQ(decoded_depth_image, expected_depth_image);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
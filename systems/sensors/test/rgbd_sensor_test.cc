@@ -402,6 +402,45 @@ TEST_F(RgbdSensorTest, ConstructCameraWithNonTrivialOffsetsDeprecated) {
 // produce the X_PC matrix (which is implicitly tested in the construction tests
 // above).
 
+// When batching the render calls, evaluating any one of the image ports
+// renders all of the images, once, and the remaining ports reuse them.
+TEST_F(RgbdSensorTest, BatchImageRenders) {
+  const RigidTransformd X_WB(RollPitchYawd(M_PI / 2, 0, 0), Vector3d(1, 2, 3));
+  auto make_sensor = [this, &X_WB](SceneGraph<double>*) {
+    return make_unique<RgbdSensor>(SceneGraph<double>::world_frame_id(), X_WB,
+                                   color_camera_, depth_camera_);
+  };
+  MakeCameraDiagram(make_sensor);
+  context_->EnableCaching();
+
+  EXPECT_FALSE(sensor_->batch_image_renders());
+  sensor_->set_batch_image_renders(true);
+  EXPECT_TRUE(sensor_->batch_image_renders());
+
+  const auto& color =
+      sensor_->color_image_output_port().Eval<ImageRgba8U>(*sensor_context_);
+  EXPECT_EQ(render_engine_->num_color_renders(), 1);
+  EXPECT_EQ(render_engine_->num_depth_renders(), 1);
+  EXPECT_EQ(render_engine_->num_label_renders(), 1);
+  EXPECT_TRUE(
+      CompareMatrices(render_engine_->last_updated_X_WC().GetAsMatrix4(),
+                      (X_WB * sensor_->X_BC()).GetAsMatrix4()));
+  EXPECT_EQ(color.width(), color_camera_.core().intrinsics().width());
+
+  const auto& depth32 = sensor_->depth_image_32F_output_port()
+                            .Eval<ImageDepth32F>(*sensor_context_);
+  const auto& depth16 = sensor_->depth_image_16U_output_port()
+                            .Eval<ImageDepth16U>(*sensor_context_);
+  const auto& label =
+      sensor_->label_image_output_port().Eval<ImageLabel16I>(*sensor_context_);
+  EXPECT_EQ(render_engine_->num_color_renders(), 1);
+  EXPECT_EQ(render_engine_->num_depth_renders(), 1);
+  EXPECT_EQ(render_engine_->num_label_renders(), 1);
+  EXPECT_EQ(depth32.width(), depth_camera_.core().intrinsics().width());
+  EXPECT_EQ(depth16.width(), depth_camera_.core().intrinsics().width());
+  EXPECT_EQ(label.width(), color_camera_.core().intrinsics().width());
+}
+
 // TODO(jwnimmer-tri) The body_pose_in_world_output_port should have unit test
 // coverage of its output value, not just its name. It ends up being indirectly
 // tested in sim_rgbd_sensor_test.cc but it would be better to identify bugs in
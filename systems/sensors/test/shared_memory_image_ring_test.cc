@@ -0,0 +1,228 @@
+#include "drake/systems/sensors/shared_memory_image_ring.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace internal {
+namespace {
+
+// Segment names are shared by every process on the host, so we make ours
+// unique to this process.
+std::string MakeSegmentName(const std::string& suffix) {
+  return fmt::format("/drake_shm_ring_test_{}_{}", ::getpid(), suffix);
+}
+
+std::vector<uint8_t> MakeData(int size, uint8_t first) {
+  std::vector<uint8_t> data(size);
+  std::iota(data.begin(), data.end(), first);
+  return data;
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, WriteAndRead) {
+  const std::string name = MakeSegmentName("write_and_read");
+  const SharedMemoryImageWriter writer(name, 1000);
+  EXPECT_EQ(writer.segment_name(), name);
+  // The capacity is rounded up to a whole number of cache lines.
+  EXPECT_EQ(writer.capacity(), 1024);
+
+  const std::vector<uint8_t> data = MakeData(100, 7);
+  std::vector<uint8_t> descriptor;
+  writer.Write(data.data(), data.size(), &descriptor);
+  EXPECT_LT(descriptor.size(), data.size());
+
+  const SharedMemoryImageReader reader;
+  std::vector<uint8_t> copy(data.size());
+  EXPECT_TRUE(reader.Copy(descriptor, copy.data(), copy.size()));
+  EXPECT_EQ(copy, data);
+
+  // The reader can also visit the data in place.
+  bool visited = false;
+  EXPECT_TRUE(reader.Visit(descriptor, [&](const uint8_t* ptr, int64_t size) {
+    visited = true;
+    EXPECT_EQ(std::vector<uint8_t>(ptr, ptr + size), data);
+  }));
+  EXPECT_TRUE(visited);
+
+  // A size mismatch is reported.
+  EXPECT_FALSE(reader.Copy(descriptor, copy.data(), copy.size() - 1));
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, Wraparound) {
+  const std::string name = MakeSegmentName("wraparound");
+  const SharedMemoryImageWriter writer(name, 256);
+  const SharedMemoryImageReader reader;
+
+  // Each block occupies two of the ring's four cache lines, so every block is
+  // overwritten by the second block written after it.
+  std::vector<std::vector<uint8_t>> descriptors(5);
+  for (int i = 0; i < 5; ++i) {
+    const std::vector<uint8_t> data = MakeData(100, i);
+    writer.Write(data.data(), data.size(), &descriptors[i]);
+
+    std::vector<uint8_t> copy(data.size());
+    EXPECT_TRUE(reader.Copy(descriptors[i], copy.data(), copy.size()));
+    EXPECT_EQ(copy, data);
+  }
+  std::vector<uint8_t> copy(100);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_FALSE(reader.Copy(descriptors[i], copy.data(), copy.size()));
+  }
+  EXPECT_TRUE(reader.Copy(descriptors[3], copy.data(), copy.size()));
+  EXPECT_EQ(copy, MakeData(100, 3));
+
+  // A block that doesn't fit before the end of the ring starts over at the
+  // beginning instead of being split.
+  const std::vector<uint8_t> data = MakeData(200, 9);
+  std::vector<uint8_t> descriptor;
+  writer.Write(data.data(), data.size(), &descriptor);
+  copy.resize(data.size());
+  EXPECT_TRUE(reader.Copy(descriptor, copy.data(), copy.size()));
+  EXPECT_EQ(copy, data);
+  EXPECT_FALSE(reader.Copy(descriptors[4], copy.data(), 100));
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, ReplacedWriter) {
+  const std::string name = MakeSegmentName("replaced_writer");
+  const SharedMemoryImageReader reader;
+  const std::vector<uint8_t> data = MakeData(10, 0);
+  std::vector<uint8_t> copy(data.size());
+
+  std::vector<uint8_t> old_descriptor;
+  {
+    const SharedMemoryImageWriter writer(name, 64);
+    writer.Write(data.data(), data.size(), &old_descriptor);
+    EXPECT_TRUE(reader.Copy(old_descriptor, copy.data(), copy.size()));
+  }
+
+  // The reader notices that the segment now belongs to a different writer,
+  // and remaps it.
+  const SharedMemoryImageWriter writer(name, 128);
+  std::vector<uint8_t> descriptor;
+  writer.Write(data.data(), data.size(), &descriptor);
+  EXPECT_TRUE(reader.Copy(descriptor, copy.data(), copy.size()));
+  EXPECT_EQ(copy, data);
+
+  // Messages from the old writer are no longer readable.
+  EXPECT_FALSE(reader.Copy(old_descriptor, copy.data(), copy.size()));
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, SegmentInUse) {
+  const std::string name = MakeSegmentName("in_use");
+  const SharedMemoryImageWriter writer(name, 64);
+  std::vector<uint8_t> descriptor;
+  const std::vector<uint8_t> data = MakeData(10, 0);
+  writer.Write(data.data(), data.size(), &descriptor);
+
+  // A live writer's segment is never taken over.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SharedMemoryImageWriter(name, 64),
+      fmt::format(".*'{}' is in use by the writer in process {}.*", name,
+                  ::getpid()));
+  const SharedMemoryImageReader reader;
+  std::vector<uint8_t> copy(data.size());
+  EXPECT_TRUE(reader.Copy(descriptor, copy.data(), copy.size()));
+
+  // Nor is a segment that isn't ours at all.
+  const std::string foreign = MakeSegmentName("foreign");
+  const int fd = ::shm_open(foreign.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  ASSERT_GE(fd, 0);
+  ::close(fd);
+  DRAKE_EXPECT_THROWS_MESSAGE(SharedMemoryImageWriter(foreign, 64),
+                              ".*already exists and does not hold images.*");
+  ::shm_unlink(foreign.c_str());
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, StaleSegment) {
+  const std::string name = MakeSegmentName("stale");
+  // A child process creates the segment and exits without unlinking it, as
+  // though it had crashed.
+  const pid_t child = ::fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    try {
+      static_cast<void>(new SharedMemoryImageWriter(name, 64));
+    } catch (...) {
+      ::_exit(1);
+    }
+    ::_exit(0);
+  }
+  int status{};
+  ASSERT_EQ(::waitpid(child, &status, 0), child);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+
+  // The abandoned segment is reclaimed.
+  const SharedMemoryImageWriter writer(name, 128);
+  EXPECT_EQ(writer.capacity(), 128);
+  const std::vector<uint8_t> data = MakeData(100, 0);
+  std::vector<uint8_t> descriptor;
+  writer.Write(data.data(), data.size(), &descriptor);
+  const SharedMemoryImageReader reader;
+  std::vector<uint8_t> copy(data.size());
+  EXPECT_TRUE(reader.Copy(descriptor, copy.data(), copy.size()));
+  EXPECT_EQ(copy, data);
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, DestroyAfterNameReused) {
+  const std::string name = MakeSegmentName("name_reused");
+  auto first = std::make_unique<SharedMemoryImageWriter>(name, 64);
+  // Someone else removes the name, and a new writer claims it.
+  ::shm_unlink(name.c_str());
+  const SharedMemoryImageWriter second(name, 64);
+
+  // Destroying the first writer leaves the second writer's segment alone.
+  first.reset();
+  const std::vector<uint8_t> data = MakeData(10, 0);
+  std::vector<uint8_t> descriptor;
+  second.Write(data.data(), data.size(), &descriptor);
+  const SharedMemoryImageReader reader;
+  std::vector<uint8_t> copy(data.size());
+  EXPECT_TRUE(reader.Copy(descriptor, copy.data(), copy.size()));
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(SharedMemoryImageWriter("no_slash", 64),
+                              ".*must start with '/'.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(SharedMemoryImageWriter("/a/b", 64),
+                              ".*must start with '/'.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SharedMemoryImageWriter(MakeSegmentName("errors"), 0),
+      ".*capacity.*must be positive.*");
+
+  const SharedMemoryImageWriter writer(MakeSegmentName("errors"), 64);
+  const std::vector<uint8_t> data = MakeData(65, 0);
+  std::vector<uint8_t> descriptor;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      writer.Write(data.data(), data.size(), &descriptor),
+      ".*cannot write 65 bytes.*increase its capacity.*");
+
+  const SharedMemoryImageReader reader;
+  std::vector<uint8_t> copy(data.size());
+  EXPECT_FALSE(reader.Copy({1, 2, 3}, copy.data(), copy.size()));
+
+  // A descriptor naming a segment that doesn't exist.
+  writer.Write(data.data(), 10, &descriptor);
+  descriptor.push_back('x');
+  EXPECT_FALSE(reader.Copy(descriptor, copy.data(), 10));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake